@@ -949,4 +949,11 @@ namespace stl {
         }
         return xdl_enumerate_exports(this->handler, callback, user_data);
     }
+
+    void Library::enumerate_symbols(symbol_callback_t callback, void *user_data) {
+        if (this->handler == nullptr || callback == nullptr) {
+            return;
+        }
+        return xdl_enumerate_symbols(this->handler, callback, user_data);
+    }
 } // rt
\ No newline at end of file
@@ -30,6 +30,8 @@ SOFTWARE.*/
 namespace stl {
 
     typedef void(*export_callback_t)(const char *symbol_name, uintptr_t address, void *user_data);
+    typedef void(*symbol_callback_t)(const char *symbol_name, uintptr_t address, size_t size,
+                                     void *user_data);
     class Library {
     public:
         static std::unique_ptr<Library> find_library(const std::string &library_name);
@@ -38,6 +40,9 @@ namespace stl {
 
         void enumerate_exports(export_callback_t callback, void *user_data);
 
+        // enumerate_exports with the size of every symbol, 0 when the ELF does not record one
+        void enumerate_symbols(symbol_callback_t callback, void *user_data);
+
         Library(std::string library_name, void *so_info);
 
         explicit Library(const std::string &library_name);
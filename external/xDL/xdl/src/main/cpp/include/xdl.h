@@ -69,6 +69,8 @@ void *xdl_sym(void *handle, const char *symbol, size_t *symbol_size);
 void *xdl_dsym(void *handle, const char *symbol, size_t *symbol_size);
 typedef void(*xdl_export_callback_t)(const char *symbol_name, uintptr_t address, void *user_data);
 void xdl_enumerate_exports(void *handle, xdl_export_callback_t callback, void *user_data);
+typedef void(*xdl_symbol_callback_t)(const char *symbol_name, uintptr_t address, size_t size, void *user_data);
+void xdl_enumerate_symbols(void *handle, xdl_symbol_callback_t callback, void *user_data);
 //
 // Enhanced dladdr().
 //
@@ -59,6 +59,8 @@
 #define XDL_DYNSYM_IS_EXPORT_SYM(shndx) (SHN_UNDEF != (shndx))
 #define XDL_SYMTAB_IS_EXPORT_SYM(shndx) \
   (SHN_UNDEF != (shndx) && !((shndx) >= SHN_LORESERVE && (shndx) <= SHN_HIRESERVE))
+// imports and absolute zero entries resolve to the load bias, they name no code
+#define XDL_SYM_HAS_ADDRESS(sym) (SHN_UNDEF != (sym)->st_shndx && 0 != (sym)->st_value)
 
 extern __attribute((weak)) unsigned long int getauxval(unsigned long int);
 
@@ -726,9 +728,9 @@ static void *xdl_resolve_symbol_address(xdl_t *self, ElfW(Sym) *sym, size_t *sym
     }
 }
 
-void xdl_enumerate_exports(void *handle, xdl_export_callback_t callback, void *user_data) {
-    xdl_t *self = (xdl_t *) handle;
-
+// exactly one of callback and sized_callback is set
+static void xdl_enumerate(xdl_t *self, xdl_export_callback_t callback,
+                          xdl_symbol_callback_t sized_callback, void *user_data) {
     // load .dynsym only once
     if (!self->dynsym_try_load) {
         self->dynsym_try_load = true;
@@ -743,16 +745,31 @@ void xdl_enumerate_exports(void *handle, xdl_export_callback_t callback, void *u
             do {
                 ElfW(Sym) *sym = self->dynsym + n;
                 const char *symbol_name = self->dynstr + sym->st_name;
-                callback(symbol_name, (uintptr_t) xdl_resolve_symbol_address(self, sym, NULL),
-                         user_data);
+                if (NULL != sized_callback) {
+                    if (XDL_SYM_HAS_ADDRESS(sym)) {
+                        size_t size = 0;
+                        uintptr_t addr = (uintptr_t) xdl_resolve_symbol_address(self, sym, &size);
+                        sized_callback(symbol_name, addr, size, user_data);
+                    }
+                } else {
+                    callback(symbol_name, (uintptr_t) xdl_resolve_symbol_address(self, sym, NULL),
+                             user_data);
+                }
             } while ((chains_all[n++] & 1) == 0);
         }
     } else if (self->sysv_hash.chains_cnt > 0) {
         for (size_t i = 0; i < self->sysv_hash.chains_cnt; i++) {
             ElfW(Sym) *sym = self->dynsym + i;
             const char *symbol_name = self->dynstr + sym->st_name;
-            callback(symbol_name, (uintptr_t) xdl_resolve_symbol_address(self, sym, NULL),
-                     user_data);
+            if (NULL != sized_callback) {
+                if (!XDL_SYM_HAS_ADDRESS(sym)) continue;
+                size_t size = 0;
+                uintptr_t addr = (uintptr_t) xdl_resolve_symbol_address(self, sym, &size);
+                sized_callback(symbol_name, addr, size, user_data);
+            } else {
+                callback(symbol_name, (uintptr_t) xdl_resolve_symbol_address(self, sym, NULL),
+                         user_data);
+            }
         }
     }
     // load .symtab only once
@@ -767,12 +784,24 @@ void xdl_enumerate_exports(void *handle, xdl_export_callback_t callback, void *u
         // if (0 != strncmp(self->strtab + sym->st_name, symbol, self->strtab_sz - sym->st_name)) continue;
         const char *symbol_name = self->strtab + sym->st_name;
         uintptr_t addr = self->load_bias + sym->st_value;
-        callback(symbol_name, addr,
-                 user_data);
+        if (NULL != sized_callback) {
+            if (XDL_SYM_HAS_ADDRESS(sym)) sized_callback(symbol_name, addr, sym->st_size, user_data);
+        } else {
+            callback(symbol_name, addr,
+                     user_data);
+        }
 
     }
 }
 
+void xdl_enumerate_exports(void *handle, xdl_export_callback_t callback, void *user_data) {
+    xdl_enumerate((xdl_t *) handle, callback, NULL, user_data);
+}
+
+void xdl_enumerate_symbols(void *handle, xdl_symbol_callback_t callback, void *user_data) {
+    xdl_enumerate((xdl_t *) handle, NULL, callback, user_data);
+}
+
 void *xdl_sym(void *handle, const char *symbol, size_t *symbol_size) {
     if (NULL == handle || NULL == symbol) return NULL;
     if (NULL != symbol_size) *symbol_size = 0;
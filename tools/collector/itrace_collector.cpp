@@ -0,0 +1,647 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * itrace-collector: drains the shared memory trace rings and trace streams of
+ * traced apps to disk, so the app only pays for copying records into the ring
+ * or queueing them for its socket.
+ *
+ *   itrace-collector [-n socket_name] [-o output_dir] [-t tcp_port]
+ *
+ * Every session ends up in <output_dir>/<session>_<pid>/itrace.bin. The data
+ * survives the traced app being killed, whatever reached the ring is written.
+ * A stream that reconnects is appended to the file of its session.
+ */
+
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <netinet/in.h>
+#include <poll.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <vector>
+#include "trace/record/trace_format.h"
+#include "trace/sink/collector_protocol.h"
+#include "trace/sink/shm_ring.h"
+
+#define LOGI(fmt, ...) fprintf(stdout, "[I] " fmt "\n", ##__VA_ARGS__)
+#define LOGE(fmt, ...) fprintf(stderr, "[E] " fmt "\n", ##__VA_ARGS__)
+
+// largest frame accepted on a stream, anything bigger is a broken stream
+static constexpr uint32_t kMaxStreamFrameSize = 64 * 1024 * 1024;
+// a connection that did not send its whole hello by then is dropped
+static constexpr int kHandshakeTimeoutMs = 2000;
+
+typedef struct collector_session {
+    int socket_fd = -1;
+    int out_fd = -1;
+    // streaming sessions receive frames on socket_fd instead of a ring
+    bool stream = false;
+    std::vector<uint8_t> stream_buffer;
+    void *map = nullptr;
+    size_t map_size = 0;
+    shm_ring_header_t *ring = nullptr;
+    const uint8_t *data = nullptr;
+    std::string path;
+    serialize_file_t file_header{};
+    bool header_written = false;
+    bool hung_up = false;
+    uint64_t inst_count = 0;
+    uint64_t bytes = 0;
+    // ring->capacity as validated when the session was accepted
+    uint64_t capacity = 0;
+} collector_session_t;
+
+static volatile sig_atomic_t running = 1;
+
+static void on_signal(int) {
+    running = 0;
+}
+
+static bool write_fully(int fd, const void *buffer, size_t size) {
+    auto cursor = reinterpret_cast<const uint8_t *>(buffer);
+    while (size > 0) {
+        ssize_t written = write(fd, cursor, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        cursor += written;
+        size -= written;
+    }
+    return true;
+}
+
+static bool mkdirs(const std::string &path) {
+    for (size_t pos = 1; pos <= path.size(); ++pos) {
+        if (pos != path.size() && path[pos] != '/') {
+            continue;
+        }
+        auto dir = path.substr(0, pos);
+        if (mkdir(dir.c_str(), 0755) != 0 && errno != EEXIST) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int listen_tcp(int port) {
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    // adb forward connects over loopback, streams are not authenticated
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(static_cast<uint16_t>(port));
+    if (bind(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0 ||
+        listen(fd, 16) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static int listen_collector(const std::string &name) {
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    struct sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    size_t name_size = std::min(name.size(), sizeof(addr.sun_path) - 1);
+    memcpy(addr.sun_path + 1, name.data(), name_size);
+    auto addr_size = static_cast<socklen_t>(offsetof(struct sockaddr_un, sun_path) + 1 + name_size);
+    if (bind(fd, reinterpret_cast<struct sockaddr *>(&addr), addr_size) != 0 ||
+        listen(fd, 16) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static std::string session_dir(const std::string &out_dir, char *session_name, uint32_t pid) {
+    session_name[127] = 0;
+    // the session name comes from the app, keep it inside out_dir
+    std::string name = session_name;
+    for (auto &c: name) {
+        if (c == '/' || c == '.') {
+            c = '_';
+        }
+    }
+    return out_dir + "/" + name + "_" + std::to_string(pid);
+}
+
+/**
+ * A connection whose hello did not fully arrive yet. Hellos are read without
+ * blocking as the bytes come in, a client that stops sending is dropped at
+ * its deadline instead of stalling the other sessions.
+ */
+typedef struct pending_connection {
+    int fd = -1;
+    // the ring memfd, passed along with the first bytes of a ring hello
+    int mem_fd = -1;
+    size_t received = 0;
+    union {
+        uint32_t magic;
+        trace_stream_hello_t stream;
+        shm_ring_hello_t ring;
+    } hello{};
+    std::chrono::steady_clock::time_point deadline;
+} pending_connection_t;
+
+typedef enum handshake_result {
+    kHandshakeWaiting,
+    kHandshakeDone,
+    kHandshakeFailed,
+} handshake_result_t;
+
+static void close_pending(pending_connection_t &pending) {
+    if (pending.mem_fd >= 0) {
+        close(pending.mem_fd);
+    }
+    close(pending.fd);
+}
+
+static std::unique_ptr<collector_session_t> accept_stream(int fd,
+                                                          const trace_stream_hello_t &stream_hello,
+                                                          const std::string &out_dir) {
+    auto hello = stream_hello;
+    if (hello.version != kStreamVersion) {
+        LOGE("rejecting stream, bad hello");
+        close(fd);
+        return nullptr;
+    }
+    auto session = std::make_unique<collector_session_t>();
+    session->socket_fd = fd;
+    session->stream = true;
+    auto dir = session_dir(out_dir, hello.session_name, hello.pid);
+    session->path = dir + "/itrace.bin";
+    if (!mkdirs(dir)) {
+        LOGE("mkdir %s failed: %s", dir.c_str(), strerror(errno));
+    }
+    bool resume = (hello.flags & kStreamResume) != 0;
+    int flags = O_RDWR | O_CREAT | O_CLOEXEC | (resume ? 0 : O_TRUNC);
+    session->out_fd = open(session->path.c_str(), flags, 0644);
+    if (session->out_fd < 0) {
+        LOGE("open %s failed: %s", session->path.c_str(), strerror(errno));
+    } else if (resume) {
+        // continue after the last complete chunk, the header is already there
+        serialize_file_t header{};
+        if (pread(session->out_fd, &header, sizeof(header), 0) == sizeof(header) &&
+            header.magic == kTraceMagic) {
+            session->file_header = header;
+            session->header_written = true;
+            session->inst_count = header.inst_count;
+        }
+        lseek(session->out_fd, 0, SEEK_END);
+    }
+    LOGI("stream %s pid %u -> %s%s", hello.session_name, hello.pid, session->path.c_str(),
+         resume ? " (resumed)" : "");
+    return session;
+}
+
+static std::unique_ptr<collector_session_t> accept_ring(int fd, int mem_fd,
+                                                        const shm_ring_hello_t &ring_hello,
+                                                        const std::string &out_dir) {
+    auto hello = ring_hello;
+    struct stat mem_stat{};
+    // map_size comes from the app, pages past the end of the memfd would fault
+    if (mem_fd < 0 || hello.version != kShmRingVersion || hello.map_size <= kShmRingDataOffset ||
+        fstat(mem_fd, &mem_stat) != 0 || static_cast<uint64_t>(mem_stat.st_size) < hello.map_size) {
+        LOGE("rejecting connection, bad hello");
+        if (mem_fd >= 0) {
+            close(mem_fd);
+        }
+        close(fd);
+        return nullptr;
+    }
+    void *map = mmap(nullptr, hello.map_size, PROT_READ | PROT_WRITE, MAP_SHARED, mem_fd, 0);
+    close(mem_fd);
+    if (map == MAP_FAILED) {
+        LOGE("mmap ring of pid %u failed: %s", hello.pid, strerror(errno));
+        close(fd);
+        return nullptr;
+    }
+    auto ring = reinterpret_cast<shm_ring_header_t *>(map);
+    // the app can rewrite the header at any time, capacity is read once and kept
+    uint64_t capacity = ring->capacity;
+    if (ring->magic != kShmRingMagic || ring->version != kShmRingVersion || capacity == 0 ||
+        capacity > hello.map_size - kShmRingDataOffset) {
+        LOGE("rejecting ring of pid %u, bad header, capacity %llu", hello.pid,
+             static_cast<unsigned long long>(capacity));
+        munmap(map, hello.map_size);
+        close(fd);
+        return nullptr;
+    }
+    auto session = std::make_unique<collector_session_t>();
+    session->socket_fd = fd;
+    session->map = map;
+    session->map_size = hello.map_size;
+    session->ring = ring;
+    session->capacity = capacity;
+    session->data = reinterpret_cast<const uint8_t *>(map) + kShmRingDataOffset;
+    auto dir = session_dir(out_dir, hello.session_name, hello.pid);
+    session->path = dir + "/itrace.bin";
+    if (!mkdirs(dir)) {
+        LOGE("mkdir %s failed: %s", dir.c_str(), strerror(errno));
+    }
+    session->out_fd = open(session->path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (session->out_fd < 0) {
+        LOGE("open %s failed: %s", session->path.c_str(), strerror(errno));
+    }
+    LOGI("session %s pid %u -> %s", hello.session_name, hello.pid, session->path.c_str());
+    return session;
+}
+
+static bool accept_connection(int listen_fd, std::vector<pending_connection_t> &pending) {
+    int fd = accept4(listen_fd, nullptr, nullptr, SOCK_CLOEXEC | SOCK_NONBLOCK);
+    if (fd < 0) {
+        return false;
+    }
+    pending_connection_t connection;
+    connection.fd = fd;
+    connection.deadline = std::chrono::steady_clock::now() +
+                          std::chrono::milliseconds(kHandshakeTimeoutMs);
+    pending.push_back(connection);
+    return true;
+}
+
+/**
+ * Reads what arrived of the hello. The first four bytes tell a stream hello
+ * from a ring hello, the ring memfd comes as SCM_RIGHTS with its first bytes.
+ */
+static handshake_result_t read_hello(pending_connection_t &pending) {
+    auto buffer = reinterpret_cast<uint8_t *>(&pending.hello);
+    while (true) {
+        size_t expected = sizeof(uint32_t);
+        if (pending.received >= sizeof(uint32_t)) {
+            if (pending.hello.magic == kStreamMagic) {
+                expected = sizeof(trace_stream_hello_t);
+            } else if (pending.hello.magic == kShmRingMagic) {
+                expected = sizeof(shm_ring_hello_t);
+            } else {
+                return kHandshakeFailed;
+            }
+        }
+        if (pending.received == expected && expected != sizeof(uint32_t)) {
+            return kHandshakeDone;
+        }
+        struct iovec iov{};
+        iov.iov_base = buffer + pending.received;
+        iov.iov_len = expected - pending.received;
+        char control[CMSG_SPACE(sizeof(int))] = {};
+        struct msghdr msg{};
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+        ssize_t received = recvmsg(pending.fd, &msg, MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return kHandshakeWaiting;
+        }
+        if (received <= 0) {
+            return kHandshakeFailed;
+        }
+        struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+        if (cmsg != nullptr && cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS) {
+            int mem_fd;
+            memcpy(&mem_fd, CMSG_DATA(cmsg), sizeof(int));
+            if (pending.mem_fd >= 0) {
+                close(mem_fd);
+                return kHandshakeFailed;
+            }
+            pending.mem_fd = mem_fd;
+        }
+        pending.received += received;
+    }
+}
+
+static std::unique_ptr<collector_session_t> finish_handshake(pending_connection_t &pending,
+                                                             const std::string &out_dir) {
+    if (pending.hello.magic == kStreamMagic) {
+        if (pending.mem_fd >= 0) {
+            close(pending.mem_fd);
+        }
+        return accept_stream(pending.fd, pending.hello.stream, out_dir);
+    }
+    // the socket stays readable only to notice the hang up of the app
+    return accept_ring(pending.fd, pending.mem_fd, pending.hello.ring, out_dir);
+}
+
+static void write_frame(collector_session_t *session, const trace_frame_header_t &frame,
+                        const uint8_t *payload) {
+    if (frame.type == kFrameHeader && frame.size >= sizeof(serialize_file_t)) {
+        memcpy(&session->file_header, payload, sizeof(serialize_file_t));
+        if (!session->header_written && session->out_fd >= 0) {
+            write_fully(session->out_fd, payload, sizeof(serialize_file_t));
+            session->header_written = true;
+        }
+        session->bytes += frame.size;
+    } else if (frame.type == kFrameChunk && frame.size >= sizeof(trace_chunk_header_t)) {
+        trace_chunk_header_t chunk;
+        memcpy(&chunk, payload, sizeof(chunk));
+        session->inst_count += chunk.inst_count;
+        if (session->out_fd >= 0) {
+            write_fully(session->out_fd, payload, frame.size);
+        }
+        session->bytes += frame.size;
+    }
+}
+
+/**
+ * Reads whatever the stream has and writes every complete frame. A partial
+ * frame stays buffered, it is dropped if the connection ends before the rest
+ * arrives and the tracer sends it again after reconnecting.
+ */
+static uint64_t drain_stream(collector_session_t *session) {
+    auto &buffer = session->stream_buffer;
+    uint8_t read_buffer[64 * 1024];
+    uint64_t received_bytes = 0;
+    while (true) {
+        ssize_t received = recv(session->socket_fd, read_buffer, sizeof(read_buffer), 0);
+        if (received > 0) {
+            buffer.insert(buffer.end(), read_buffer, read_buffer + received);
+            received_bytes += received;
+            continue;
+        }
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+            session->hung_up = true;
+        }
+        break;
+    }
+    size_t offset = 0;
+    while (buffer.size() - offset >= sizeof(trace_frame_header_t)) {
+        trace_frame_header_t frame;
+        memcpy(&frame, buffer.data() + offset, sizeof(frame));
+        if (frame.size > kMaxStreamFrameSize) {
+            LOGE("%s: corrupted stream, frame of %u bytes", session->path.c_str(), frame.size);
+            session->hung_up = true;
+            offset = buffer.size();
+            break;
+        }
+        uint64_t frame_size = trace_frame_size(frame.size);
+        if (buffer.size() - offset < frame_size) {
+            break;
+        }
+        write_frame(session, frame, buffer.data() + offset + sizeof(frame));
+        offset += frame_size;
+    }
+    buffer.erase(buffer.begin(), buffer.begin() + static_cast<ptrdiff_t>(offset));
+    return received_bytes;
+}
+
+/**
+ * Copies every complete frame between tail and head to the output file.
+ * Returns the number of bytes consumed.
+ */
+static uint64_t drain_session(collector_session_t *session) {
+    if (session->stream) {
+        return drain_stream(session);
+    }
+    auto ring = session->ring;
+    uint64_t capacity = session->capacity;
+    uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+    uint64_t head = ring->head.load(std::memory_order_acquire);
+    uint64_t consumed = 0;
+    if (head > tail && head - tail > capacity) {
+        LOGE("%s: corrupted ring, head %llu tail %llu", session->path.c_str(),
+             static_cast<unsigned long long>(head), static_cast<unsigned long long>(tail));
+        ring->tail.store(head, std::memory_order_release);
+        return 0;
+    }
+    while (tail < head) {
+        uint64_t offset = tail % capacity;
+        trace_frame_header_t frame;
+        if (offset + sizeof(frame) > capacity || sizeof(frame) > head - tail) {
+            LOGE("%s: corrupted frame at %llu", session->path.c_str(),
+                 static_cast<unsigned long long>(tail));
+            ring->tail.store(head, std::memory_order_release);
+            break;
+        }
+        memcpy(&frame, session->data + offset, sizeof(frame));
+        auto payload = session->data + offset + sizeof(frame);
+        uint64_t frame_size = trace_frame_size(frame.size);
+        // a torn or corrupt length would read past what the tracer published
+        if (offset + frame_size > capacity || frame_size > head - tail) {
+            LOGE("%s: corrupted frame at %llu", session->path.c_str(),
+                 static_cast<unsigned long long>(tail));
+            ring->tail.store(head, std::memory_order_release);
+            break;
+        }
+        write_frame(session, frame, payload);
+        tail += frame_size;
+        consumed += frame_size;
+        ring->tail.store(tail, std::memory_order_release);
+    }
+    return consumed;
+}
+
+static void close_session(collector_session_t *session) {
+    drain_session(session);
+    if (session->out_fd >= 0) {
+        if (session->header_written) {
+            session->file_header.inst_count = session->inst_count;
+            pwrite(session->out_fd, &session->file_header, sizeof(serialize_file_t), 0);
+        }
+        close(session->out_fd);
+    }
+    if (session->stream) {
+        LOGI("stream %s closed, %llu instructions, %llu bytes%s", session->path.c_str(),
+             static_cast<unsigned long long>(session->inst_count),
+             static_cast<unsigned long long>(session->bytes),
+             session->stream_buffer.empty() ? "" : ", partial frame dropped");
+    } else {
+        auto dropped = session->ring->dropped_frames.load();
+        LOGI("session %s closed, %llu instructions, %llu bytes, %llu dropped frames%s",
+             session->path.c_str(), static_cast<unsigned long long>(session->inst_count),
+             static_cast<unsigned long long>(session->bytes),
+             static_cast<unsigned long long>(dropped), session->hung_up ? ", app gone" : "");
+        munmap(session->map, session->map_size);
+    }
+    close(session->socket_fd);
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "usage: %s [-n socket_name] [-o output_dir] [-t tcp_port]\n", name);
+}
+
+int main(int argc, char **argv) {
+    std::string name = kDefaultCollectorName;
+    std::string out_dir = "/data/local/tmp/itrace";
+    int tcp_port = 0;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:o:t:h")) != -1) {
+        switch (opt) {
+            case 'n':
+                name = optarg;
+                break;
+            case 'o':
+                out_dir = optarg;
+                break;
+            case 't':
+                tcp_port = atoi(optarg);
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (!mkdirs(out_dir)) {
+        LOGE("mkdir %s failed: %s", out_dir.c_str(), strerror(errno));
+        return 1;
+    }
+    int listen_fd = listen_collector(name);
+    if (listen_fd < 0) {
+        LOGE("listen on @%s failed: %s", name.c_str(), strerror(errno));
+        return 1;
+    }
+    int tcp_fd = -1;
+    if (tcp_port > 0) {
+        tcp_fd = listen_tcp(tcp_port);
+        if (tcp_fd < 0) {
+            LOGE("listen on tcp port %d failed: %s", tcp_port, strerror(errno));
+            close(listen_fd);
+            return 1;
+        }
+        LOGI("listening on tcp port %d", tcp_port);
+    }
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+    signal(SIGPIPE, SIG_IGN);
+    LOGI("listening on @%s, writing to %s", name.c_str(), out_dir.c_str());
+
+    std::vector<std::unique_ptr<collector_session_t>> sessions;
+    std::vector<pending_connection_t> pending;
+    std::vector<struct pollfd> pfds;
+    int idle_ms = 1;
+    while (running) {
+        uint64_t consumed = 0;
+        for (auto &session: sessions) {
+            consumed += drain_session(session.get());
+        }
+        // back off while every ring is empty, stay hot while data flows
+        idle_ms = consumed != 0 ? 0 : std::min(idle_ms == 0 ? 1 : idle_ms * 2, 20);
+
+        pfds.clear();
+        pfds.push_back({listen_fd, POLLIN, 0});
+        pfds.push_back({tcp_fd, POLLIN, 0});
+        for (auto &session: sessions) {
+            pfds.push_back({session->socket_fd, POLLIN, 0});
+        }
+        for (auto &connection: pending) {
+            pfds.push_back({connection.fd, POLLIN, 0});
+        }
+        if (poll(pfds.data(), pfds.size(), idle_ms) < 0 && errno != EINTR) {
+            LOGE("poll failed: %s", strerror(errno));
+            break;
+        }
+        for (size_t i = 0; i < sessions.size(); ++i) {
+            auto session = sessions[i].get();
+            auto revents = pfds[i + 2].revents;
+            if (session->stream) {
+                if (revents != 0) {
+                    drain_stream(session);
+                    idle_ms = 0;
+                }
+            } else if (revents != 0) {
+                // the tracer never writes to the ring socket, readable means closed
+                session->hung_up = true;
+            }
+        }
+        auto now = std::chrono::steady_clock::now();
+        size_t pending_base = 2 + sessions.size();
+        std::vector<pending_connection_t> waiting;
+        for (size_t i = 0; i < pending.size(); ++i) {
+            auto &connection = pending[i];
+            auto result = pfds[pending_base + i].revents != 0 ? read_hello(connection) :
+                          kHandshakeWaiting;
+            if (result == kHandshakeDone) {
+                auto session = finish_handshake(connection, out_dir);
+                if (session != nullptr) {
+                    sessions.push_back(std::move(session));
+                    idle_ms = 0;
+                }
+            } else if (result == kHandshakeFailed) {
+                LOGE("rejecting connection, bad hello");
+                close_pending(connection);
+            } else if (now >= connection.deadline) {
+                LOGE("rejecting connection, no hello within %d ms", kHandshakeTimeoutMs);
+                close_pending(connection);
+            } else {
+                waiting.push_back(connection);
+            }
+        }
+        pending.swap(waiting);
+        for (auto it = sessions.begin(); it != sessions.end();) {
+            auto session = it->get();
+            bool closed = !session->stream &&
+                          session->ring->state.load(std::memory_order_acquire) == kRingClosed;
+            if (session->hung_up || closed) {
+                close_session(session);
+                it = sessions.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        for (size_t i = 0; i < 2; ++i) {
+            if ((pfds[i].revents & POLLIN) && accept_connection(pfds[i].fd, pending)) {
+                idle_ms = 0;
+            }
+        }
+    }
+    for (auto &connection: pending) {
+        close_pending(connection);
+    }
+    for (auto &session: sessions) {
+        close_session(session.get());
+    }
+    if (tcp_fd >= 0) {
+        close(tcp_fd);
+    }
+    close(listen_fd);
+    return 0;
+}
@@ -0,0 +1,385 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * itrace-index: converts a binary trace into the columnar store queried by
+ * itrace-query.
+ *
+ *   itrace-index [-s segment_size] [-v] itrace.bin [itrace.col]
+ *
+ * The output defaults to the input path with a .col extension. Chunks are
+ * decoded on a prefetch thread while the main thread cuts the trace into
+ * segments, so the conversion runs at about the speed of one decode.
+ *
+ * Only general purpose registers are indexed; their values are the full
+ * register slot, so W0 and X0 read the same 64-bit value.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "common/chunk_prefetcher.h"
+#include "common/column_store.h"
+#include "common/trace_reader.h"
+
+#define LOGI(fmt, ...) fprintf(stderr, "[I] " fmt "\n", ##__VA_ARGS__)
+#define LOGE(fmt, ...) fprintf(stderr, "[E] " fmt "\n", ##__VA_ARGS__)
+
+typedef struct index_value {
+    // instruction number inside the chunk
+    uint32_t inst;
+    uint8_t slot;
+    // the value was in the register before the instruction ran
+    bool pre;
+    uint64_t value;
+} index_value_t;
+
+typedef struct index_access {
+    uint32_t inst;
+    uint32_t meta;
+    uint64_t address;
+    uint64_t value;
+} index_access_t;
+
+/**
+ * One chunk reduced to what the columns need, built on the prefetch thread.
+ */
+typedef struct index_chunk {
+    uint64_t first_index = 0;
+    std::vector<uint64_t> offsets;
+    std::vector<index_value_t> values;
+    std::vector<index_access_t> accesses;
+    std::vector<std::pair<uint32_t, std::string>> calls;
+    // register names seen for the first time, with their slot
+    std::vector<std::pair<std::string, uint8_t>> registers;
+    std::string error;
+} index_chunk_t;
+
+/**
+ * Cuts the instruction stream into segments and tracks the register file
+ * across them, so every segment starts with a complete snapshot.
+ */
+class SegmentBuilder {
+public:
+    SegmentBuilder(ColumnStoreWriter &writer, uint32_t segment_size)
+            : writer(writer), segment_size(segment_size) {
+        reset();
+    }
+
+    bool add_chunk(const index_chunk_t &chunk, std::string *error) {
+        size_t value_pos = 0;
+        size_t access_pos = 0;
+        size_t call_pos = 0;
+        if (chunk.first_index != next_index && !chunk.offsets.empty()) {
+            // a dropped chunk, rows only count on within a segment and the registers are stale
+            if (!flush(error)) {
+                return false;
+            }
+            state = col_reg_state_t{};
+            reset();
+        }
+        next_index = chunk.first_index + chunk.offsets.size();
+        for (uint32_t i = 0; i < chunk.offsets.size(); ++i) {
+            if (data.offsets.size() == segment_size && !flush(error)) {
+                return false;
+            }
+            if (data.offsets.empty()) {
+                first_index = chunk.first_index + i;
+            }
+            auto row = static_cast<uint32_t>(data.offsets.size());
+            data.offsets.push_back(chunk.offsets[i]);
+            for (; value_pos < chunk.values.size() && chunk.values[value_pos].inst == i; ++value_pos) {
+                const auto &value = chunk.values[value_pos];
+                // a value written by the instruction is in the register before the next row
+                set_register(value.slot, value.value, value.pre ? row : row + 1);
+            }
+            for (; access_pos < chunk.accesses.size() && chunk.accesses[access_pos].inst == i;
+                   ++access_pos) {
+                const auto &access = chunk.accesses[access_pos];
+                data.mem_rows.push_back(row);
+                data.mem_addresses.push_back(access.address);
+                data.mem_values.push_back(access.value);
+                data.mem_meta.push_back(access.meta);
+            }
+            for (; call_pos < chunk.calls.size() && chunk.calls[call_pos].first == i; ++call_pos) {
+                data.call_rows.push_back(row);
+                data.call_names.push_back(function_id(chunk.calls[call_pos].second));
+            }
+        }
+        return true;
+    }
+
+    bool flush(std::string *error) {
+        if (data.offsets.empty()) {
+            return true;
+        }
+        auto row_count = static_cast<uint32_t>(data.offsets.size());
+        for (uint32_t slot = 0; slot < kColumnMaxRegs; ++slot) {
+            for (const auto &delta: deltas[slot]) {
+                // the value left by the last row belongs to the next snapshot
+                if (delta.first >= row_count) {
+                    break;
+                }
+                data.delta_rows.push_back(delta.first);
+                data.delta_regs.push_back(static_cast<uint8_t>(slot));
+                data.delta_values.push_back(delta.second);
+            }
+            if (zones[slot].min <= zones[slot].max) {
+                data.reg_zones.push_back(zones[slot]);
+            }
+        }
+        auto call_count = data.call_rows.size();
+        if (!writer.append_segment(first_index, first_call, data, error)) {
+            return false;
+        }
+        first_call += call_count;
+        reset();
+        return true;
+    }
+
+    void write_names() {
+        for (const auto &item: functions) {
+            writer.add_name(kNameFunction, item.second, item.first);
+        }
+    }
+
+private:
+    void reset() {
+        data = col_segment_data_t{};
+        data.snapshot = state;
+        for (uint32_t slot = 0; slot < kColumnMaxRegs; ++slot) {
+            deltas[slot].clear();
+            zones[slot].reg = slot;
+            zones[slot].min = UINT64_MAX;
+            zones[slot].max = 0;
+            if (state.known & (1ull << slot)) {
+                update_zone(slot, state.values[slot]);
+            }
+        }
+    }
+
+    void update_zone(uint8_t slot, uint64_t value) {
+        zones[slot].min = std::min(zones[slot].min, value);
+        zones[slot].max = std::max(zones[slot].max, value);
+    }
+
+    void set_register(uint8_t slot, uint64_t value, uint32_t row) {
+        auto bit = 1ull << slot;
+        if ((state.known & bit) && state.values[slot] == value) {
+            return;
+        }
+        state.known |= bit;
+        state.values[slot] = value;
+        if (row >= segment_size) {
+            return;
+        }
+        auto &list = deltas[slot];
+        // a pre value of this row replaces the post value of the row before
+        if (!list.empty() && list.back().first == row) {
+            list.back().second = value;
+        } else {
+            list.emplace_back(row, value);
+        }
+        update_zone(slot, value);
+    }
+
+    uint32_t function_id(const std::string &name) {
+        auto it = functions.find(name);
+        if (it != functions.end()) {
+            return it->second;
+        }
+        auto id = static_cast<uint32_t>(functions.size());
+        functions.emplace(name, id);
+        return id;
+    }
+
+private:
+    ColumnStoreWriter &writer;
+    uint32_t segment_size;
+    uint64_t first_index = 0;
+    // index the next chunk starts at unless chunks were dropped in between
+    uint64_t next_index = 0;
+    uint64_t first_call = 0;
+    col_reg_state_t state{};
+    col_segment_data_t data;
+    std::vector<std::pair<uint32_t, uint64_t>> deltas[kColumnMaxRegs];
+    col_reg_zone_t zones[kColumnMaxRegs]{};
+    std::unordered_map<std::string, uint32_t> functions;
+};
+
+static void reduce_chunk(const TraceReader &reader, size_t index, index_chunk_t &chunk,
+                         std::unordered_set<std::string> &seen_registers) {
+    thread_local TraceChunkDecoder decoder;
+    thread_local std::vector<uint8_t> raw;
+    if (!reader.read_chunk(index, raw, &chunk.error)) {
+        return;
+    }
+    const auto &header = reader.get_chunks()[index].header;
+    uint64_t module_base = reader.get_header().module_base;
+    chunk.first_index = header.first_index;
+    chunk.offsets.reserve(header.inst_count);
+    decoder.decode(header, raw.data(), raw.size(), [&](const trace_inst_view_t &inst) {
+        auto row = static_cast<uint32_t>(chunk.offsets.size());
+        const auto &desc = *inst.desc;
+        chunk.offsets.push_back(desc.desc->address - module_base);
+        for (size_t i = 0; i < desc.desc->operand_count; ++i) {
+            const auto &operand = desc.operands[i];
+            if (operand.kind != kOperandGpr || operand.size == 0 || operand.size > 8) {
+                continue;
+            }
+            uint32_t slot = operand.state_offset / operand.size;
+            if (slot >= kColumnMaxRegs) {
+                continue;
+            }
+            std::string name(operand.name, strnlen(operand.name, sizeof(operand.name)));
+            if (seen_registers.insert(name).second) {
+                chunk.registers.emplace_back(name, slot);
+            }
+            index_value_t value{row, static_cast<uint8_t>(slot), false, 0};
+            if (operand.flags & kOperandPreValue) {
+                value.pre = true;
+                memcpy(&value.value, trace_operand_value(inst, i, true), operand.size);
+                chunk.values.push_back(value);
+                value.pre = false;
+                value.value = 0;
+            }
+            memcpy(&value.value, trace_operand_value(inst, i, false), operand.size);
+            chunk.values.push_back(value);
+        }
+        for (uint16_t i = 0; i < inst.access_count; ++i) {
+            trace_memory_access_t ma;
+            memcpy(&ma, inst.accesses + i, sizeof(ma));
+            chunk.accesses.push_back({row, (static_cast<uint32_t>(ma.type) << 16) | ma.size,
+                                      ma.address, ma.value});
+        }
+        if (inst.call != nullptr) {
+            chunk.calls.emplace_back(row, std::string(inst.call->fun_name));
+        }
+        return true;
+    }, &chunk.error);
+}
+
+static std::string default_output(const std::string &input) {
+    auto slash = input.find_last_of('/');
+    auto dot = input.find_last_of('.');
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+        return input + ".col";
+    }
+    return input.substr(0, dot) + ".col";
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "usage: %s [-s segment_size] [-v] itrace.bin [itrace.col]\n", name);
+}
+
+int main(int argc, char **argv) {
+    uint32_t segment_size = kDefaultSegmentSize;
+    bool verbose = false;
+    int opt;
+    while ((opt = getopt(argc, argv, "s:vh")) != -1) {
+        switch (opt) {
+            case 's':
+                segment_size = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+                if (segment_size == 0) {
+                    LOGE("bad segment size %s", optarg);
+                    return 1;
+                }
+                break;
+            case 'v':
+                verbose = true;
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (optind != argc - 1 && optind != argc - 2) {
+        usage(argv[0]);
+        return 1;
+    }
+    std::string input = argv[optind];
+    std::string output = optind + 1 < argc ? argv[optind + 1] : default_output(input);
+    std::string error;
+    auto reader = TraceReader::open(input, &error);
+    if (reader == nullptr) {
+        LOGE("%s", error.c_str());
+        return 1;
+    }
+    if (!reader->is_complete()) {
+        LOGI("%s ends in a partial chunk, indexing the complete ones", input.c_str());
+    }
+    auto writer = ColumnStoreWriter::create(output, &error);
+    if (writer == nullptr) {
+        LOGE("%s", error.c_str());
+        return 1;
+    }
+    const auto &trace_header = reader->get_header();
+    writer->set_module(trace_header.module_base, trace_header.module_name);
+
+    auto start = std::chrono::steady_clock::now();
+    std::unordered_set<std::string> seen_registers;
+    ChunkPrefetcher<index_chunk_t> prefetcher(reader->get_chunks().size(),
+                                              [&](size_t i, index_chunk_t &chunk) {
+                                                  reduce_chunk(*reader, i, chunk, seen_registers);
+                                              });
+    SegmentBuilder builder(*writer, segment_size);
+    index_chunk_t chunk;
+    bool failed = false;
+    while (prefetcher.next(chunk)) {
+        if (!chunk.error.empty()) {
+            LOGE("%s", chunk.error.c_str());
+            failed = true;
+        }
+        for (const auto &item: chunk.registers) {
+            writer->add_name(kNameRegister, item.second, item.first);
+        }
+        if (!builder.add_chunk(chunk, &error)) {
+            LOGE("%s", error.c_str());
+            return 2;
+        }
+    }
+    if (!builder.flush(&error)) {
+        LOGE("%s", error.c_str());
+        return 2;
+    }
+    builder.write_names();
+    if (!writer->finish(&error)) {
+        LOGE("%s", error.c_str());
+        return 2;
+    }
+    if (verbose) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start).count();
+        LOGI("%s: %llu instructions in %zu chunks -> %s, %lld ms", trace_header.module_name,
+             static_cast<unsigned long long>(reader->get_inst_count()),
+             reader->get_chunks().size(), output.c_str(), static_cast<long long>(elapsed));
+    }
+    return failed ? 2 : 0;
+}
@@ -0,0 +1,680 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * itrace-query: searches the columnar store written by itrace-index.
+ *
+ *   itrace-query [-j threads] [-r offset_begin-offset_end] [-e reg<op>value]...
+ *                [-W address_begin-address_end] [-R address_begin-address_end]
+ *                [-c first_call:last_call] [-w first:last] [-F function]
+ *                [-t itrace.bin] [-l limit] [-n] [-v] itrace.col
+ *
+ * All predicates must match:
+ *   -r  pc offset from the module base in [begin, end), a single value is
+ *       one offset
+ *   -e  register value before the instruction runs, op is one of
+ *       == != < <= > >=, e.g. -e x0==0; may be repeated
+ *   -W  the instruction writes memory in [begin, end)
+ *   -R  the instruction reads memory in [begin, end)
+ *   -c  from call number first up to call number last, counted from 0
+ *   -w  instruction numbers in [first, last)
+ *   -F  instructions calling a function whose name contains the string
+ *
+ * Segments whose zone maps exclude a predicate are never inflated. The
+ * others are scanned on a thread pool: every predicate narrows a selection
+ * vector over the rows of the segment with a branch free loop on one column.
+ * Matches print as "index offset", or as full itrace.txt lines when the
+ * original trace is given with -t.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include "common/column_store.h"
+#include "common/ordered_executor.h"
+#include "common/trace_reader.h"
+#include "common/trace_renderer.h"
+
+#define LOGI(fmt, ...) fprintf(stderr, "[I] " fmt "\n", ##__VA_ARGS__)
+#define LOGE(fmt, ...) fprintf(stderr, "[E] " fmt "\n", ##__VA_ARGS__)
+
+typedef enum compare_op {
+    kCompareEqual,
+    kCompareNotEqual,
+    kCompareLess,
+    kCompareLessEqual,
+    kCompareGreater,
+    kCompareGreaterEqual,
+} compare_op_t;
+
+typedef struct reg_predicate {
+    uint8_t slot;
+    compare_op_t op;
+    uint64_t value;
+} reg_predicate_t;
+
+typedef struct query {
+    uint64_t offset_begin = 0;
+    uint64_t offset_end = UINT64_MAX;
+    uint64_t index_begin = 0;
+    uint64_t index_end = UINT64_MAX;
+    bool has_write = false;
+    uint64_t write_begin = 0;
+    uint64_t write_end = UINT64_MAX;
+    bool has_read = false;
+    uint64_t read_begin = 0;
+    uint64_t read_end = UINT64_MAX;
+    std::vector<reg_predicate_t> registers;
+    std::string function;
+    // ids of the functions matching function, filled once the store is open
+    std::vector<uint8_t> function_ids;
+} query_t;
+
+typedef struct segment_result {
+    std::vector<uint64_t> indices;
+    std::vector<uint64_t> offsets;
+    std::string text;
+    bool scanned = false;
+    std::string error;
+} segment_result_t;
+
+static bool parse_u64(const char *str, uint64_t &value) {
+    char *end = nullptr;
+    errno = 0;
+    value = strtoull(str, &end, 0);
+    return errno == 0 && end != str && *end == 0;
+}
+
+static bool parse_range(const char *arg, char separator, uint64_t &begin, uint64_t &end) {
+    std::string str = arg;
+    auto pos = str.find(separator);
+    if (pos == std::string::npos) {
+        return false;
+    }
+    auto begin_str = str.substr(0, pos);
+    auto end_str = str.substr(pos + 1);
+    // an empty side leaves the range open
+    if (!begin_str.empty() && !parse_u64(begin_str.c_str(), begin)) {
+        return false;
+    }
+    if (!end_str.empty() && !parse_u64(end_str.c_str(), end)) {
+        return false;
+    }
+    return begin <= end;
+}
+
+static bool parse_register(const ColumnStore &store, const char *arg, reg_predicate_t &predicate) {
+    static const struct {
+        const char *text;
+        compare_op_t op;
+    } ops[] = {
+            // two character operators first, "<" is a prefix of "<="
+            {"==", kCompareEqual},
+            {"!=", kCompareNotEqual},
+            {"<=", kCompareLessEqual},
+            {">=", kCompareGreaterEqual},
+            {"<",  kCompareLess},
+            {">",  kCompareGreater},
+    };
+    std::string str = arg;
+    for (const auto &item: ops) {
+        auto pos = str.find(item.text);
+        if (pos == std::string::npos || pos == 0) {
+            continue;
+        }
+        int slot = store.find_register(str.substr(0, pos));
+        if (slot < 0) {
+            LOGE("the trace has no register %s", str.substr(0, pos).c_str());
+            return false;
+        }
+        predicate.slot = static_cast<uint8_t>(slot);
+        predicate.op = item.op;
+        return parse_u64(str.c_str() + pos + strlen(item.text), predicate.value);
+    }
+    return false;
+}
+
+static inline bool zone_overlaps(uint64_t min, uint64_t max, uint64_t begin, uint64_t end) {
+    return min <= max && max >= begin && min < end;
+}
+
+static bool zone_may_match(const col_reg_zone_t &zone, const reg_predicate_t &predicate) {
+    switch (predicate.op) {
+        case kCompareEqual:
+            return zone.min <= predicate.value && predicate.value <= zone.max;
+        case kCompareNotEqual:
+            return !(zone.min == predicate.value && zone.max == predicate.value);
+        case kCompareLess:
+            return zone.min < predicate.value;
+        case kCompareLessEqual:
+            return zone.min <= predicate.value;
+        case kCompareGreater:
+            return zone.max > predicate.value;
+        case kCompareGreaterEqual:
+            return zone.max >= predicate.value;
+    }
+    return true;
+}
+
+/**
+ * Evaluates a query over one segment. Columns are inflated lazily and only
+ * once, the selection vector holds 1 for rows still matching.
+ */
+class SegmentScan {
+public:
+    SegmentScan(const ColumnStore &store, const col_segment_t &segment)
+            : store(store), segment(segment) {}
+
+    // false when the zone maps rule the segment out
+    [[nodiscard]] bool may_match(const query_t &query) const {
+        uint64_t last_index = segment.first_index + segment.row_count;
+        if (segment.row_count == 0 || last_index <= query.index_begin ||
+            segment.first_index >= query.index_end) {
+            return false;
+        }
+        if (!zone_overlaps(segment.offset_min, segment.offset_max, query.offset_begin,
+                           query.offset_end)) {
+            return false;
+        }
+        if (query.has_write && !zone_overlaps(segment.write_min, segment.write_max,
+                                              query.write_begin, query.write_end)) {
+            return false;
+        }
+        if (query.has_read && !zone_overlaps(segment.read_min, segment.read_max,
+                                             query.read_begin, query.read_end)) {
+            return false;
+        }
+        if (!query.function.empty() && segment.call_count == 0) {
+            return false;
+        }
+        return true;
+    }
+
+    bool run(const query_t &query, std::vector<uint32_t> &rows, std::string *error) {
+        if (!query.registers.empty()) {
+            if (!store.read_column(segment, kColRegZone, reg_zones, error)) {
+                return false;
+            }
+            for (const auto &predicate: query.registers) {
+                auto zone = std::find_if(reg_zones.begin(), reg_zones.end(),
+                                         [&](const col_reg_zone_t &item) {
+                                             return item.reg == predicate.slot;
+                                         });
+                if (zone == reg_zones.end() || !zone_may_match(*zone, predicate)) {
+                    return true;
+                }
+            }
+        }
+        auto row_count = segment.row_count;
+        selection.assign(row_count, 1);
+        if (query.index_begin > segment.first_index) {
+            auto skip = std::min<uint64_t>(query.index_begin - segment.first_index, row_count);
+            std::fill(selection.begin(), selection.begin() + skip, 0);
+        }
+        if (query.index_end < segment.first_index + row_count) {
+            std::fill(selection.begin() + (query.index_end - segment.first_index),
+                      selection.end(), 0);
+        }
+        if (query.offset_begin != 0 || query.offset_end != UINT64_MAX) {
+            if (!load_offsets(error)) {
+                return false;
+            }
+            // unsigned wrap turns the range check into one compare
+            uint64_t width = query.offset_end - query.offset_begin;
+            uint64_t begin = query.offset_begin;
+            const uint64_t *offset = offsets.data();
+            uint8_t *sel = selection.data();
+            for (uint32_t row = 0; row < row_count; ++row) {
+                sel[row] &= static_cast<uint8_t>(offset[row] - begin < width);
+            }
+        }
+        for (const auto &predicate: query.registers) {
+            if (!apply_register(predicate, error)) {
+                return false;
+            }
+        }
+        if (query.has_write && !apply_access(kAccessWrite, query.write_begin, query.write_end,
+                                             error)) {
+            return false;
+        }
+        if (query.has_read && !apply_access(kAccessRead, query.read_begin, query.read_end,
+                                            error)) {
+            return false;
+        }
+        if (!query.function.empty() && !apply_function(query, error)) {
+            return false;
+        }
+        for (uint32_t row = 0; row < row_count; ++row) {
+            if (selection[row]) {
+                rows.push_back(row);
+            }
+        }
+        return true;
+    }
+
+    bool load_offsets(std::string *error) {
+        if (offsets.size() == segment.row_count) {
+            return true;
+        }
+        return store.read_column(segment, kColOffset, offsets, error);
+    }
+
+    [[nodiscard]] const std::vector<uint64_t> &get_offsets() const {
+        return offsets;
+    }
+
+private:
+    bool load_deltas(std::string *error) {
+        if (deltas_loaded) {
+            return true;
+        }
+        deltas_loaded = store.read_snapshot(segment, snapshot, error) &&
+                        store.read_column(segment, kColDeltaRow, delta_rows, error) &&
+                        store.read_column(segment, kColDeltaReg, delta_regs, error) &&
+                        store.read_column(segment, kColDeltaValue, delta_values, error);
+        return deltas_loaded;
+    }
+
+    // expands the deltas of one register into a value per row
+    void materialize(uint8_t slot) {
+        auto row_count = segment.row_count;
+        reg_values.resize(row_count);
+        reg_known.resize(row_count);
+        uint64_t current = snapshot.values[slot];
+        auto known = static_cast<uint8_t>((snapshot.known >> slot) & 1);
+        // deltas are sorted by register, then row
+        auto range = std::equal_range(delta_regs.begin(), delta_regs.end(), slot);
+        uint32_t row = 0;
+        for (auto it = range.first; it != range.second; ++it) {
+            auto i = it - delta_regs.begin();
+            auto until = std::min(delta_rows[i], row_count);
+            std::fill(reg_values.begin() + row, reg_values.begin() + until, current);
+            std::fill(reg_known.begin() + row, reg_known.begin() + until, known);
+            current = delta_values[i];
+            known = 1;
+            row = until;
+        }
+        std::fill(reg_values.begin() + row, reg_values.end(), current);
+        std::fill(reg_known.begin() + row, reg_known.end(), known);
+    }
+
+    template<typename Compare>
+    void select(uint64_t value, Compare compare) {
+        const uint64_t *values = reg_values.data();
+        const uint8_t *known = reg_known.data();
+        uint8_t *sel = selection.data();
+        for (uint32_t row = 0; row < segment.row_count; ++row) {
+            sel[row] &= known[row] & static_cast<uint8_t>(compare(values[row], value));
+        }
+    }
+
+    bool apply_register(const reg_predicate_t &predicate, std::string *error) {
+        if (!load_deltas(error)) {
+            return false;
+        }
+        materialize(predicate.slot);
+        switch (predicate.op) {
+            case kCompareEqual:
+                select(predicate.value, [](uint64_t a, uint64_t b) { return a == b; });
+                break;
+            case kCompareNotEqual:
+                select(predicate.value, [](uint64_t a, uint64_t b) { return a != b; });
+                break;
+            case kCompareLess:
+                select(predicate.value, [](uint64_t a, uint64_t b) { return a < b; });
+                break;
+            case kCompareLessEqual:
+                select(predicate.value, [](uint64_t a, uint64_t b) { return a <= b; });
+                break;
+            case kCompareGreater:
+                select(predicate.value, [](uint64_t a, uint64_t b) { return a > b; });
+                break;
+            case kCompareGreaterEqual:
+                select(predicate.value, [](uint64_t a, uint64_t b) { return a >= b; });
+                break;
+        }
+        return true;
+    }
+
+    bool apply_access(uint8_t type, uint64_t begin, uint64_t end, std::string *error) {
+        if (!accesses_loaded) {
+            accesses_loaded = store.read_column(segment, kColMemRow, mem_rows, error) &&
+                              store.read_column(segment, kColMemAddress, mem_addresses, error) &&
+                              store.read_column(segment, kColMemMeta, mem_meta, error);
+            if (!accesses_loaded) {
+                return false;
+            }
+        }
+        mask.assign(segment.row_count, 0);
+        uint64_t width = end - begin;
+        for (size_t i = 0; i < mem_rows.size(); ++i) {
+            auto hit = (mem_meta[i] >> 16) == type && mem_addresses[i] - begin < width;
+            mask[mem_rows[i]] |= static_cast<uint8_t>(hit);
+        }
+        apply_mask();
+        return true;
+    }
+
+    bool apply_function(const query_t &query, std::string *error) {
+        if (!store.read_column(segment, kColCallRow, call_rows, error) ||
+            !store.read_column(segment, kColCallName, call_names, error)) {
+            return false;
+        }
+        mask.assign(segment.row_count, 0);
+        for (size_t i = 0; i < call_rows.size(); ++i) {
+            auto id = call_names[i];
+            mask[call_rows[i]] |= id < query.function_ids.size() ? query.function_ids[id] : 0;
+        }
+        apply_mask();
+        return true;
+    }
+
+    void apply_mask() {
+        uint8_t *sel = selection.data();
+        const uint8_t *hit = mask.data();
+        for (uint32_t row = 0; row < segment.row_count; ++row) {
+            sel[row] &= hit[row];
+        }
+    }
+
+private:
+    const ColumnStore &store;
+    const col_segment_t &segment;
+    std::vector<uint8_t> selection;
+    std::vector<uint8_t> mask;
+    std::vector<uint64_t> offsets;
+    std::vector<col_reg_zone_t> reg_zones;
+    bool deltas_loaded = false;
+    col_reg_state_t snapshot{};
+    std::vector<uint32_t> delta_rows;
+    std::vector<uint8_t> delta_regs;
+    std::vector<uint64_t> delta_values;
+    std::vector<uint64_t> reg_values;
+    std::vector<uint8_t> reg_known;
+    bool accesses_loaded = false;
+    std::vector<uint32_t> mem_rows;
+    std::vector<uint64_t> mem_addresses;
+    std::vector<uint32_t> mem_meta;
+    std::vector<uint32_t> call_rows;
+    std::vector<uint32_t> call_names;
+};
+
+// instruction number of a call, UINT64_MAX when the trace has fewer calls
+static uint64_t find_call_index(const ColumnStore &store, uint64_t ordinal, std::string *error) {
+    auto segment_index = store.find_call_segment(ordinal);
+    if (segment_index >= store.get_segments().size()) {
+        return UINT64_MAX;
+    }
+    const auto &segment = store.get_segments()[segment_index];
+    std::vector<uint32_t> rows;
+    if (!store.read_column(segment, kColCallRow, rows, error) ||
+        ordinal - segment.first_call >= rows.size()) {
+        return UINT64_MAX;
+    }
+    return segment.first_index + rows[ordinal - segment.first_call];
+}
+
+// renders the matched instructions of a segment from the original trace
+static bool render_matches(const TraceReader &reader, const TraceRenderer &renderer,
+                           segment_result_t &result) {
+    thread_local TraceChunkDecoder decoder;
+    thread_local std::vector<uint8_t> raw;
+    size_t next = 0;
+    while (next < result.indices.size()) {
+        auto chunk_index = reader.find_chunk(result.indices[next]);
+        if (chunk_index >= reader.get_chunks().size()) {
+            result.error = "instruction " + std::to_string(result.indices[next]) +
+                           " is not in the trace";
+            return false;
+        }
+        if (!reader.read_chunk(chunk_index, raw, &result.error)) {
+            return false;
+        }
+        const auto &header = reader.get_chunks()[chunk_index].header;
+        decoder.decode(header, raw.data(), raw.size(), [&](const trace_inst_view_t &inst) {
+            if (inst.index == result.indices[next]) {
+                renderer.render(result.text, inst);
+                ++next;
+            }
+            return next < result.indices.size() &&
+                   result.indices[next] < header.first_index + header.inst_count;
+        }, &result.error);
+        if (!result.error.empty()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void usage(const char *name) {
+    fprintf(stderr,
+            "usage: %s [-j threads] [-r offset_begin-offset_end] [-e reg<op>value]...\n"
+            "          [-W address_begin-address_end] [-R address_begin-address_end]\n"
+            "          [-c first_call:last_call] [-w first:last] [-F function]\n"
+            "          [-t itrace.bin] [-l limit] [-n] [-v] itrace.col\n", name);
+}
+
+int main(int argc, char **argv) {
+    unsigned threads = OrderedExecutor<segment_result_t>::default_threads();
+    query_t query;
+    std::vector<std::string> register_args;
+    bool has_call_window = false;
+    uint64_t call_begin = 0;
+    uint64_t call_end = UINT64_MAX;
+    std::string trace_path;
+    uint64_t limit = UINT64_MAX;
+    bool count_only = false;
+    bool verbose = false;
+    int opt;
+    while ((opt = getopt(argc, argv, "j:r:e:W:R:c:w:F:t:l:nvh")) != -1) {
+        switch (opt) {
+            case 'j':
+                threads = static_cast<unsigned>(atoi(optarg));
+                break;
+            case 'r':
+                if (strchr(optarg, '-') == nullptr && parse_u64(optarg, query.offset_begin)) {
+                    query.offset_end = query.offset_begin + 1;
+                } else if (!parse_range(optarg, '-', query.offset_begin, query.offset_end)) {
+                    LOGE("bad offset range %s", optarg);
+                    return 1;
+                }
+                break;
+            case 'e':
+                register_args.emplace_back(optarg);
+                break;
+            case 'W':
+                query.has_write = true;
+                if (!parse_range(optarg, '-', query.write_begin, query.write_end)) {
+                    LOGE("bad address range %s", optarg);
+                    return 1;
+                }
+                break;
+            case 'R':
+                query.has_read = true;
+                if (!parse_range(optarg, '-', query.read_begin, query.read_end)) {
+                    LOGE("bad address range %s", optarg);
+                    return 1;
+                }
+                break;
+            case 'c':
+                has_call_window = true;
+                if (!parse_range(optarg, ':', call_begin, call_end)) {
+                    LOGE("bad call window %s", optarg);
+                    return 1;
+                }
+                break;
+            case 'w':
+                if (!parse_range(optarg, ':', query.index_begin, query.index_end)) {
+                    LOGE("bad instruction window %s", optarg);
+                    return 1;
+                }
+                break;
+            case 'F':
+                query.function = optarg;
+                break;
+            case 't':
+                trace_path = optarg;
+                break;
+            case 'l':
+                if (!parse_u64(optarg, limit)) {
+                    LOGE("bad limit %s", optarg);
+                    return 1;
+                }
+                break;
+            case 'n':
+                count_only = true;
+                break;
+            case 'v':
+                verbose = true;
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (optind != argc - 1) {
+        usage(argv[0]);
+        return 1;
+    }
+    std::string error;
+    auto store = ColumnStore::open(argv[optind], &error);
+    if (store == nullptr) {
+        LOGE("%s", error.c_str());
+        return 1;
+    }
+    for (const auto &arg: register_args) {
+        reg_predicate_t predicate{};
+        if (!parse_register(*store, arg.c_str(), predicate)) {
+            LOGE("bad register predicate %s", arg.c_str());
+            return 1;
+        }
+        query.registers.push_back(predicate);
+    }
+    if (!query.function.empty()) {
+        const auto &functions = store->get_functions();
+        query.function_ids.resize(functions.size());
+        for (size_t i = 0; i < functions.size(); ++i) {
+            query.function_ids[i] = functions[i].find(query.function) != std::string::npos;
+        }
+    }
+    if (has_call_window) {
+        // narrows the instruction window, both calls are resolved through the call columns
+        auto begin = find_call_index(*store, call_begin, &error);
+        auto end = call_end == UINT64_MAX ? UINT64_MAX : find_call_index(*store, call_end, &error);
+        if (!error.empty()) {
+            LOGE("%s", error.c_str());
+            return 2;
+        }
+        query.index_begin = std::max(query.index_begin, begin);
+        query.index_end = std::min(query.index_end, end);
+    }
+    std::unique_ptr<TraceReader> reader;
+    std::unique_ptr<TraceRenderer> renderer;
+    if (!trace_path.empty()) {
+        reader = TraceReader::open(trace_path, &error);
+        if (reader == nullptr) {
+            LOGE("%s", error.c_str());
+            return 1;
+        }
+        renderer = std::make_unique<TraceRenderer>(reader->get_header(), kRenderText);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    const auto &segments = store->get_segments();
+    std::atomic<uint64_t> scanned{0};
+    uint64_t matched = 0;
+    bool failed = false;
+    OrderedExecutor<segment_result_t> executor(threads);
+    executor.run(segments.size(), [&](size_t i, segment_result_t &result) {
+        result.indices.clear();
+        result.offsets.clear();
+        result.text.clear();
+        result.error.clear();
+        SegmentScan scan(*store, segments[i]);
+        if (!scan.may_match(query)) {
+            return;
+        }
+        scanned++;
+        thread_local std::vector<uint32_t> rows;
+        rows.clear();
+        if (!scan.run(query, rows, &result.error) || rows.empty() || count_only) {
+            result.indices.resize(rows.size());
+            return;
+        }
+        if (renderer == nullptr && !scan.load_offsets(&result.error)) {
+            return;
+        }
+        for (auto row: rows) {
+            result.indices.push_back(segments[i].first_index + row);
+            if (renderer == nullptr) {
+                result.offsets.push_back(scan.get_offsets()[row]);
+            }
+        }
+        if (renderer != nullptr) {
+            render_matches(*reader, *renderer, result);
+        }
+    }, [&](size_t i, segment_result_t &result) {
+        if (!result.error.empty()) {
+            LOGE("segment %zu: %s", i, result.error.c_str());
+            failed = true;
+        }
+        auto count = std::min<uint64_t>(result.indices.size(), limit - matched);
+        matched += count;
+        if (!count_only && renderer != nullptr) {
+            // a rendered line per match, cut at the limit
+            size_t end = 0;
+            for (uint64_t line = 0; line < count && end != std::string::npos; ++line) {
+                end = result.text.find('\n', end);
+                end = end == std::string::npos ? end : end + 1;
+            }
+            fwrite(result.text.data(), 1, std::min(end, result.text.size()), stdout);
+        } else if (!count_only) {
+            for (uint64_t j = 0; j < count; ++j) {
+                printf("%llu 0x%llx\n", static_cast<unsigned long long>(result.indices[j]),
+                       static_cast<unsigned long long>(result.offsets[j]));
+            }
+        }
+        return matched < limit;
+    });
+    if (count_only) {
+        printf("%llu\n", static_cast<unsigned long long>(matched));
+    }
+    fflush(stdout);
+    if (verbose) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start).count();
+        LOGI("%s: %llu/%zu segments scanned, %llu matched, %u threads, %lld ms",
+             store->get_header().module_name, static_cast<unsigned long long>(scanned.load()),
+             segments.size(), static_cast<unsigned long long>(matched), threads,
+             static_cast<long long>(elapsed));
+    }
+    return failed ? 2 : 0;
+}
@@ -0,0 +1,115 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_CHUNK_PREFETCHER_H
+#define QBDI_TRACER_CHUNK_PREFETCHER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/**
+ * Pull style counterpart of OrderedExecutor for tools that walk a trace
+ * sequentially and need to pause, like the diff that advances two traces at
+ * different speeds. A background thread runs produce(index, batch) for index
+ * in [0, count) and keeps at most depth batches ready; next() hands them out
+ * in order.
+ */
+template<typename Batch>
+class ChunkPrefetcher {
+public:
+    typedef std::function<void(size_t, Batch &)> produce_t;
+
+    ChunkPrefetcher(size_t count, produce_t produce, size_t depth = 4)
+            : count(count), produce(std::move(produce)), depth(depth != 0 ? depth : 1) {
+        worker = std::thread(&ChunkPrefetcher::run, this);
+    }
+
+    ~ChunkPrefetcher() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        space_cond.notify_all();
+        worker.join();
+    }
+
+    ChunkPrefetcher(const ChunkPrefetcher &) = delete;
+
+    ChunkPrefetcher &operator=(const ChunkPrefetcher &) = delete;
+
+    // false once every batch was handed out
+    bool next(Batch &batch) {
+        std::unique_lock<std::mutex> lock(mutex);
+        ready_cond.wait(lock, [&] { return !ready.empty() || produced == count; });
+        if (ready.empty()) {
+            return false;
+        }
+        batch = std::move(ready.front());
+        ready.pop_front();
+        space_cond.notify_one();
+        return true;
+    }
+
+private:
+    void run() {
+        for (size_t index = 0; index < count; ++index) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                space_cond.wait(lock, [&] { return stopping || ready.size() < depth; });
+                if (stopping) {
+                    break;
+                }
+            }
+            Batch batch{};
+            produce(index, batch);
+            std::lock_guard<std::mutex> lock(mutex);
+            ready.push_back(std::move(batch));
+            produced = index + 1;
+            ready_cond.notify_one();
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        produced = count;
+        ready_cond.notify_all();
+    }
+
+private:
+    size_t count;
+    produce_t produce;
+    size_t depth;
+    std::deque<Batch> ready;
+    size_t produced = 0;
+    bool stopping = false;
+    std::mutex mutex;
+    std::condition_variable ready_cond;
+    std::condition_variable space_cond;
+    std::thread worker;
+};
+
+
+#endif //QBDI_TRACER_CHUNK_PREFETCHER_H
@@ -0,0 +1,144 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_COLUMN_FORMAT_H
+#define QBDI_TRACER_COLUMN_FORMAT_H
+
+#include <cstdint>
+
+/*
+ * Columnar trace store (itrace.col), built from itrace.bin by itrace-index.
+ *
+ *   col_file_header_t
+ *   column blobs of every segment, zlib compressed
+ *   col_segment_t[segment_count]
+ *   col_name_t[name_count]
+ *
+ * The trace is cut into segments of segment_size instructions. Each segment
+ * stores its columns separately and keeps min/max zone maps in its
+ * col_segment_t, so a query only inflates the columns of segments that can
+ * match. Rows are instruction numbers relative to the segment.
+ *
+ * Registers are stored as deltas: the snapshot holds every known general
+ * purpose register before the first row, a delta (row, reg, value) says reg
+ * holds value before row and onwards. Deltas are sorted by register, then
+ * row, so one register can be materialized with a single pass.
+ */
+
+// "ICOL"
+static constexpr uint32_t kColumnMagic = 0x4C4F4349;
+static constexpr uint32_t kColumnVersion = 1;
+static constexpr uint32_t kDefaultSegmentSize = 64 * 1024;
+// general purpose register slots tracked, indexed by the GPRState slot
+static constexpr uint32_t kColumnMaxRegs = 64;
+
+typedef struct col_file_header {
+    uint32_t magic = kColumnMagic;
+    uint32_t version = kColumnVersion;
+    uint32_t segment_size = kDefaultSegmentSize;
+    uint32_t segment_count = 0;
+    uint64_t inst_count = 0;
+    uint64_t call_count = 0;
+    uint64_t module_base = 0;
+    uint64_t segments_offset = 0;
+    uint32_t name_count = 0;
+    uint32_t reserved = 0;
+    char module_name[64] = {};
+} col_file_header_t;
+
+typedef enum col_column_id {
+    // uint64_t pc offset from the module base, one per row
+    kColOffset = 0,
+    // col_reg_state_t, registers before the first row
+    kColSnapshot,
+    // uint32_t row, uint8_t reg, uint64_t value of the register deltas
+    kColDeltaRow,
+    kColDeltaReg,
+    kColDeltaValue,
+    // col_reg_zone_t for every register known in the segment
+    kColRegZone,
+    // memory accesses, sorted by row
+    kColMemRow,
+    kColMemAddress,
+    kColMemValue,
+    // uint32_t, type << 16 | size
+    kColMemMeta,
+    // call records, uint32_t row and uint32_t name id
+    kColCallRow,
+    kColCallName,
+    kColumnCount,
+} col_column_id_t;
+
+typedef struct col_column_ref {
+    uint64_t offset;
+    uint32_t stored_size;
+    uint32_t raw_size;
+} col_column_ref_t;
+
+typedef struct col_reg_state {
+    // bit n set when slot n is known
+    uint64_t known;
+    uint64_t values[kColumnMaxRegs];
+} col_reg_state_t;
+
+typedef struct col_reg_zone {
+    uint32_t reg;
+    uint32_t reserved;
+    uint64_t min;
+    uint64_t max;
+} col_reg_zone_t;
+
+typedef struct col_segment {
+    uint64_t first_index;
+    uint32_t row_count;
+    uint32_t delta_count;
+    uint32_t access_count;
+    uint32_t call_count;
+    // ordinal of the first call record in the segment
+    uint64_t first_call;
+    // zone maps, min > max when the segment has no such value
+    uint64_t offset_min;
+    uint64_t offset_max;
+    uint64_t read_min;
+    uint64_t read_max;
+    uint64_t write_min;
+    uint64_t write_max;
+    col_column_ref_t columns[kColumnCount];
+} col_segment_t;
+
+typedef enum col_name_kind {
+    // a register name and the slot it lives in, W0 and X0 share a slot
+    kNameRegister = 1,
+    // a called function, referenced by kColCallName
+    kNameFunction = 2,
+} col_name_kind_t;
+
+typedef struct col_name {
+    uint32_t kind;
+    uint32_t id;
+    char name[120];
+} col_name_t;
+
+#endif //QBDI_TRACER_COLUMN_FORMAT_H
@@ -0,0 +1,340 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "column_store.h"
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <zlib.h>
+#include "trace/record/trace_format.h"
+
+// sanity bounds for the tables loaded on open
+static constexpr uint32_t kMaxSegments = 16 * 1024 * 1024;
+static constexpr uint32_t kMaxNames = 1024 * 1024;
+
+static inline void set_error(std::string *error, const std::string &message) {
+    if (error != nullptr) {
+        *error = message;
+    }
+}
+
+static std::string to_lower(const std::string &str) {
+    std::string out(str);
+    std::transform(out.begin(), out.end(), out.begin(),
+                   [](unsigned char c) { return static_cast<char>(tolower(c)); });
+    return out;
+}
+
+static bool pread_fully(int fd, void *buffer, size_t size, uint64_t offset) {
+    auto cursor = reinterpret_cast<uint8_t *>(buffer);
+    while (size > 0) {
+        ssize_t result = pread(fd, cursor, size, static_cast<off_t>(offset));
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            return false;
+        }
+        cursor += result;
+        size -= result;
+        offset += result;
+    }
+    return true;
+}
+
+std::unique_ptr<ColumnStoreWriter> ColumnStoreWriter::create(const std::string &path,
+                                                             std::string *error) {
+    auto writer = std::unique_ptr<ColumnStoreWriter>(new ColumnStoreWriter());
+    writer->fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (writer->fd < 0) {
+        set_error(error, "open " + path + ": " + strerror(errno));
+        return nullptr;
+    }
+    // the header is rewritten by finish, reserve its room now
+    if (!writer->write_all(&writer->header, sizeof(writer->header), error)) {
+        return nullptr;
+    }
+    return writer;
+}
+
+ColumnStoreWriter::~ColumnStoreWriter() {
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+void ColumnStoreWriter::set_module(uint64_t module_base, const char *module_name) {
+    header.module_base = module_base;
+    strncpy(header.module_name, module_name, sizeof(header.module_name) - 1);
+}
+
+bool ColumnStoreWriter::write_all(const void *data, size_t size, std::string *error) {
+    auto cursor = reinterpret_cast<const uint8_t *>(data);
+    while (size > 0) {
+        ssize_t result = write(fd, cursor, size);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            set_error(error, std::string("write failed: ") + strerror(errno));
+            return false;
+        }
+        cursor += result;
+        size -= result;
+        position += result;
+    }
+    return true;
+}
+
+bool ColumnStoreWriter::write_column(col_column_ref_t &ref, const void *data, size_t size,
+                                     std::string *error) {
+    ref.offset = position;
+    ref.raw_size = static_cast<uint32_t>(size);
+    ref.stored_size = 0;
+    if (size == 0) {
+        return true;
+    }
+    uLongf stored_size = compressBound(size);
+    compressed.resize(stored_size);
+    int ret = compress2(compressed.data(), &stored_size, reinterpret_cast<const Bytef *>(data),
+                        size, Z_BEST_SPEED);
+    if (ret != Z_OK) {
+        set_error(error, "deflate column failed: " + std::to_string(ret));
+        return false;
+    }
+    ref.stored_size = static_cast<uint32_t>(stored_size);
+    return write_all(compressed.data(), stored_size, error);
+}
+
+template<typename T>
+static inline size_t byte_size(const std::vector<T> &items) {
+    return items.size() * sizeof(T);
+}
+
+bool ColumnStoreWriter::append_segment(uint64_t first_index, uint64_t first_call,
+                                       const col_segment_data_t &data, std::string *error) {
+    col_segment_t segment{};
+    segment.first_index = first_index;
+    segment.first_call = first_call;
+    segment.row_count = static_cast<uint32_t>(data.offsets.size());
+    segment.delta_count = static_cast<uint32_t>(data.delta_rows.size());
+    segment.access_count = static_cast<uint32_t>(data.mem_rows.size());
+    segment.call_count = static_cast<uint32_t>(data.call_rows.size());
+    segment.offset_min = segment.read_min = segment.write_min = UINT64_MAX;
+    segment.offset_max = segment.read_max = segment.write_max = 0;
+    for (auto offset: data.offsets) {
+        segment.offset_min = std::min(segment.offset_min, offset);
+        segment.offset_max = std::max(segment.offset_max, offset);
+    }
+    for (size_t i = 0; i < data.mem_rows.size(); ++i) {
+        auto address = data.mem_addresses[i];
+        if ((data.mem_meta[i] >> 16) == kAccessWrite) {
+            segment.write_min = std::min(segment.write_min, address);
+            segment.write_max = std::max(segment.write_max, address);
+        } else {
+            segment.read_min = std::min(segment.read_min, address);
+            segment.read_max = std::max(segment.read_max, address);
+        }
+    }
+    auto &columns = segment.columns;
+    if (!write_column(columns[kColOffset], data.offsets.data(), byte_size(data.offsets), error) ||
+        !write_column(columns[kColSnapshot], &data.snapshot, sizeof(data.snapshot), error) ||
+        !write_column(columns[kColDeltaRow], data.delta_rows.data(), byte_size(data.delta_rows),
+                      error) ||
+        !write_column(columns[kColDeltaReg], data.delta_regs.data(), byte_size(data.delta_regs),
+                      error) ||
+        !write_column(columns[kColDeltaValue], data.delta_values.data(),
+                      byte_size(data.delta_values), error) ||
+        !write_column(columns[kColRegZone], data.reg_zones.data(), byte_size(data.reg_zones),
+                      error) ||
+        !write_column(columns[kColMemRow], data.mem_rows.data(), byte_size(data.mem_rows), error) ||
+        !write_column(columns[kColMemAddress], data.mem_addresses.data(),
+                      byte_size(data.mem_addresses), error) ||
+        !write_column(columns[kColMemValue], data.mem_values.data(), byte_size(data.mem_values),
+                      error) ||
+        !write_column(columns[kColMemMeta], data.mem_meta.data(), byte_size(data.mem_meta), error) ||
+        !write_column(columns[kColCallRow], data.call_rows.data(), byte_size(data.call_rows),
+                      error) ||
+        !write_column(columns[kColCallName], data.call_names.data(), byte_size(data.call_names),
+                      error)) {
+        return false;
+    }
+    segments.push_back(segment);
+    header.inst_count += segment.row_count;
+    header.call_count += segment.call_count;
+    return true;
+}
+
+void ColumnStoreWriter::add_name(col_name_kind_t kind, uint32_t id, const std::string &name) {
+    col_name_t item{};
+    item.kind = kind;
+    item.id = id;
+    strncpy(item.name, name.c_str(), sizeof(item.name) - 1);
+    names.push_back(item);
+}
+
+bool ColumnStoreWriter::finish(std::string *error) {
+    header.segment_count = static_cast<uint32_t>(segments.size());
+    header.name_count = static_cast<uint32_t>(names.size());
+    header.segments_offset = position;
+    if (!write_all(segments.data(), byte_size(segments), error) ||
+        !write_all(names.data(), byte_size(names), error)) {
+        return false;
+    }
+    if (pwrite(fd, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))) {
+        set_error(error, std::string("write header failed: ") + strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+std::unique_ptr<ColumnStore> ColumnStore::open(const std::string &path, std::string *error) {
+    auto store = std::unique_ptr<ColumnStore>(new ColumnStore());
+    store->fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (store->fd < 0) {
+        set_error(error, "open " + path + ": " + strerror(errno));
+        return nullptr;
+    }
+    auto &header = store->header;
+    if (!pread_fully(store->fd, &header, sizeof(header), 0)) {
+        set_error(error, "column file too short");
+        return nullptr;
+    }
+    if (header.magic != kColumnMagic) {
+        set_error(error, "not a column file, build one with itrace-index");
+        return nullptr;
+    }
+    if (header.version != kColumnVersion) {
+        set_error(error, "unsupported column file version " + std::to_string(header.version));
+        return nullptr;
+    }
+    if (header.segments_offset == 0) {
+        set_error(error, "column file was not finished");
+        return nullptr;
+    }
+    if (header.segment_count > kMaxSegments || header.name_count > kMaxNames) {
+        set_error(error, "column file tables are corrupted");
+        return nullptr;
+    }
+    store->segments.resize(header.segment_count);
+    std::vector<col_name_t> names(header.name_count);
+    uint64_t names_offset = header.segments_offset + byte_size(store->segments);
+    if (!pread_fully(store->fd, store->segments.data(), byte_size(store->segments),
+                     header.segments_offset) ||
+        !pread_fully(store->fd, names.data(), byte_size(names), names_offset)) {
+        set_error(error, "column file tables are truncated");
+        return nullptr;
+    }
+    store->register_names.resize(kColumnMaxRegs);
+    for (auto &item: names) {
+        item.name[sizeof(item.name) - 1] = '\0';
+        if (item.kind == kNameRegister && item.id < kColumnMaxRegs) {
+            store->registers[to_lower(item.name)] = item.id;
+            // the first name seen for a slot is the full width one on arm64 (X0 before W0)
+            auto &slot_name = store->register_names[item.id];
+            if (slot_name.empty() || (item.name[0] == 'X' && slot_name[0] != 'X')) {
+                slot_name = item.name;
+            }
+        } else if (item.kind == kNameFunction) {
+            if (store->functions.size() <= item.id) {
+                store->functions.resize(item.id + 1);
+            }
+            store->functions[item.id] = item.name;
+        }
+    }
+    return store;
+}
+
+ColumnStore::~ColumnStore() {
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+int ColumnStore::find_register(const std::string &name) const {
+    auto it = registers.find(to_lower(name));
+    return it == registers.end() ? -1 : static_cast<int>(it->second);
+}
+
+const std::string &ColumnStore::register_name(uint32_t slot) const {
+    static const std::string unknown = "?";
+    if (slot >= register_names.size() || register_names[slot].empty()) {
+        return unknown;
+    }
+    return register_names[slot];
+}
+
+const std::string &ColumnStore::function_name(uint32_t id) const {
+    static const std::string unknown;
+    return id < functions.size() ? functions[id] : unknown;
+}
+
+size_t ColumnStore::find_call_segment(uint64_t ordinal) const {
+    auto it = std::upper_bound(segments.begin(), segments.end(), ordinal,
+                               [](uint64_t value, const col_segment_t &segment) {
+                                   return value < segment.first_call;
+                               });
+    if (it == segments.begin()) {
+        return segments.size();
+    }
+    --it;
+    if (ordinal >= it->first_call + it->call_count) {
+        return segments.size();
+    }
+    return it - segments.begin();
+}
+
+bool ColumnStore::read_snapshot(const col_segment_t &segment, col_reg_state_t &out,
+                                std::string *error) const {
+    if (segment.columns[kColSnapshot].raw_size != sizeof(out)) {
+        set_error(error, "register snapshot has a bad size");
+        return false;
+    }
+    return read_raw(segment.columns[kColSnapshot], &out, error);
+}
+
+bool ColumnStore::read_raw(const col_column_ref_t &ref, void *out, std::string *error) const {
+    if (ref.raw_size == 0) {
+        return true;
+    }
+    // one stored buffer per thread, segments are scanned concurrently
+    thread_local std::vector<uint8_t> stored;
+    stored.resize(ref.stored_size);
+    if (!pread_fully(fd, stored.data(), stored.size(), ref.offset)) {
+        set_error(error, "read column failed");
+        return false;
+    }
+    uLongf raw_size = ref.raw_size;
+    int ret = uncompress(reinterpret_cast<Bytef *>(out), &raw_size, stored.data(), stored.size());
+    if (ret != Z_OK || raw_size != ref.raw_size) {
+        set_error(error, "inflate column failed: " + std::to_string(ret));
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,159 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_COLUMN_STORE_H
+#define QBDI_TRACER_COLUMN_STORE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "column_format.h"
+
+/**
+ * Raw columns of one segment, filled by itrace-index and by
+ * ColumnStore::read_column. Every vector of a group has the same length.
+ */
+typedef struct col_segment_data {
+    std::vector<uint64_t> offsets;
+    col_reg_state_t snapshot{};
+    std::vector<uint32_t> delta_rows;
+    std::vector<uint8_t> delta_regs;
+    std::vector<uint64_t> delta_values;
+    std::vector<col_reg_zone_t> reg_zones;
+    std::vector<uint32_t> mem_rows;
+    std::vector<uint64_t> mem_addresses;
+    std::vector<uint64_t> mem_values;
+    std::vector<uint32_t> mem_meta;
+    std::vector<uint32_t> call_rows;
+    std::vector<uint32_t> call_names;
+} col_segment_data_t;
+
+/**
+ * Appends segments to an itrace.col file. Zone maps and counts of the
+ * segment descriptor are computed from the data.
+ */
+class ColumnStoreWriter {
+public:
+    static std::unique_ptr<ColumnStoreWriter> create(const std::string &path, std::string *error);
+
+    ~ColumnStoreWriter();
+
+    void set_module(uint64_t module_base, const char *module_name);
+
+    bool append_segment(uint64_t first_index, uint64_t first_call, const col_segment_data_t &data,
+                        std::string *error);
+
+    void add_name(col_name_kind_t kind, uint32_t id, const std::string &name);
+
+    // writes the segment table and the names, then the final header
+    bool finish(std::string *error);
+
+private:
+    ColumnStoreWriter() = default;
+
+    bool write_column(col_column_ref_t &ref, const void *data, size_t size, std::string *error);
+
+    bool write_all(const void *data, size_t size, std::string *error);
+
+private:
+    int fd = -1;
+    uint64_t position = 0;
+    col_file_header_t header{};
+    std::vector<col_segment_t> segments;
+    std::vector<col_name_t> names;
+    std::vector<uint8_t> compressed;
+};
+
+/**
+ * Read side of itrace.col. The header, segment table and names are loaded on
+ * open, columns are inflated on demand with pread, so read_column can be
+ * called from several threads at once.
+ */
+class ColumnStore {
+public:
+    static std::unique_ptr<ColumnStore> open(const std::string &path, std::string *error);
+
+    ~ColumnStore();
+
+    [[nodiscard]] const col_file_header_t &get_header() const {
+        return header;
+    }
+
+    [[nodiscard]] const std::vector<col_segment_t> &get_segments() const {
+        return segments;
+    }
+
+    // register slot of a name like "x0" or "W0", -1 when the trace has no such register
+    [[nodiscard]] int find_register(const std::string &name) const;
+
+    [[nodiscard]] const std::string &register_name(uint32_t slot) const;
+
+    [[nodiscard]] const std::string &function_name(uint32_t id) const;
+
+    [[nodiscard]] const std::vector<std::string> &get_functions() const {
+        return functions;
+    }
+
+    // segment holding the call with this ordinal, get_segments().size() when there is none
+    [[nodiscard]] size_t find_call_segment(uint64_t ordinal) const;
+
+    /**
+     * Inflates one column into out, which is resized to the number of
+     * elements. Fails when the stored size does not match sizeof(T).
+     */
+    template<typename T>
+    bool read_column(const col_segment_t &segment, col_column_id_t column, std::vector<T> &out,
+                     std::string *error) const {
+        const auto &ref = segment.columns[column];
+        if (ref.raw_size % sizeof(T) != 0) {
+            if (error != nullptr) {
+                *error = "column " + std::to_string(column) + " has a bad size";
+            }
+            return false;
+        }
+        out.resize(ref.raw_size / sizeof(T));
+        return read_raw(ref, out.data(), error);
+    }
+
+    bool read_snapshot(const col_segment_t &segment, col_reg_state_t &out, std::string *error) const;
+
+private:
+    ColumnStore() = default;
+
+    bool read_raw(const col_column_ref_t &ref, void *out, std::string *error) const;
+
+private:
+    int fd = -1;
+    col_file_header_t header{};
+    std::vector<col_segment_t> segments;
+    std::unordered_map<std::string, uint32_t> registers;
+    std::vector<std::string> register_names;
+    std::vector<std::string> functions;
+};
+
+
+#endif //QBDI_TRACER_COLUMN_STORE_H
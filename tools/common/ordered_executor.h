@@ -0,0 +1,127 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_ORDERED_EXECUTOR_H
+#define QBDI_TRACER_ORDERED_EXECUTOR_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Runs produce(index, result) for index in [0, count) on a pool of threads
+ * and hands the results to consume(index, result) on the calling thread, in
+ * index order. At most window results exist at once, so a slow consumer
+ * (usually the output file) holds the producers back instead of piling up
+ * decoded chunks in memory.
+ *
+ * consume returning false stops the run; producers finish their current item.
+ */
+template<typename Result>
+class OrderedExecutor {
+public:
+    typedef std::function<void(size_t, Result &)> produce_t;
+    typedef std::function<bool(size_t, Result &)> consume_t;
+
+    static unsigned default_threads() {
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    explicit OrderedExecutor(unsigned threads, size_t window = 0)
+            : threads(std::max(1u, threads)),
+              window(window != 0 ? window : this->threads * 4) {}
+
+    void run(size_t count, const produce_t &produce, const consume_t &consume) {
+        slots.assign(window, slot_t{});
+        next_index = 0;
+        consumed = 0;
+        stopped = false;
+        std::vector<std::thread> workers;
+        auto worker_count = std::min<size_t>(threads, count);
+        for (size_t i = 0; i < worker_count; ++i) {
+            workers.emplace_back([&] { work(count, produce); });
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        for (size_t index = 0; index < count && !stopped; ++index) {
+            auto &slot = slots[index % window];
+            ready_cond.wait(lock, [&] { return slot.ready; });
+            lock.unlock();
+            bool keep_going = consume(index, slot.result);
+            lock.lock();
+            slot.ready = false;
+            consumed = index + 1;
+            stopped = !keep_going;
+            free_cond.notify_all();
+        }
+        stopped = true;
+        free_cond.notify_all();
+        lock.unlock();
+        for (auto &worker: workers) {
+            worker.join();
+        }
+    }
+
+private:
+    typedef struct slot {
+        Result result{};
+        bool ready = false;
+    } slot_t;
+
+    void work(size_t count, const produce_t &produce) {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stopped && next_index < count) {
+            size_t index = next_index++;
+            // wait until the slot of index - window was consumed
+            free_cond.wait(lock, [&] { return stopped || index < consumed + window; });
+            if (stopped) {
+                break;
+            }
+            auto &slot = slots[index % window];
+            lock.unlock();
+            produce(index, slot.result);
+            lock.lock();
+            slot.ready = true;
+            ready_cond.notify_all();
+        }
+    }
+
+private:
+    unsigned threads;
+    size_t window;
+    std::vector<slot_t> slots;
+    size_t next_index = 0;
+    size_t consumed = 0;
+    bool stopped = false;
+    std::mutex mutex;
+    std::condition_variable ready_cond;
+    std::condition_variable free_cond;
+};
+
+
+#endif //QBDI_TRACER_ORDERED_EXECUTOR_H
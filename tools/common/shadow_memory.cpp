@@ -0,0 +1,133 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shadow_memory.h"
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+static constexpr size_t kPageBytes = ShadowMemory::kPageSize * sizeof(uint64_t);
+
+ShadowMemory::ShadowMemory(size_t max_pages) : max_pages(max_pages != 0 ? max_pages : 1) {}
+
+ShadowMemory::~ShadowMemory() {
+    if (swap_fd >= 0) {
+        close(swap_fd);
+    }
+}
+
+bool ShadowMemory::open_swap() {
+    if (swap_fd >= 0) {
+        return true;
+    }
+    std::string path = swap_dir + "/itrace-shadow-XXXXXX";
+    swap_fd = mkstemp(&path[0]);
+    if (swap_fd < 0) {
+        error = "create swap file " + path + ": " + strerror(errno);
+        return false;
+    }
+    // only the descriptor keeps it alive, nothing is left behind on exit
+    unlink(path.c_str());
+    return true;
+}
+
+void ShadowMemory::make_room() {
+    while (resident >= max_pages && !lru.empty()) {
+        auto page_no = lru.back();
+        lru.pop_back();
+        auto &entry = pages[page_no];
+        if (open_swap()) {
+            if (entry.swap_slot < 0) {
+                entry.swap_slot = next_slot++;
+            }
+            auto written = pwrite(swap_fd, entry.data.get(), kPageBytes,
+                                  static_cast<off_t>(entry.swap_slot * kPageBytes));
+            if (written != static_cast<ssize_t>(kPageBytes) && error.empty()) {
+                error = std::string("write swap file: ") + strerror(errno);
+            }
+        }
+        entry.data.reset();
+        resident--;
+        swap_outs++;
+        if (page_no == last_page_no) {
+            last_page_no = UINT64_MAX;
+            last_page = nullptr;
+        }
+    }
+}
+
+uint64_t *ShadowMemory::get_page(uint64_t page_no, bool create) {
+    if (page_no == last_page_no) {
+        return last_page;
+    }
+    auto it = pages.find(page_no);
+    if (it == pages.end()) {
+        if (!create) {
+            return nullptr;
+        }
+        make_room();
+        it = pages.emplace(page_no, page_entry_t{}).first;
+        it->second.data.reset(new uint64_t[kPageSize]());
+        lru.push_front(page_no);
+        it->second.lru = lru.begin();
+        resident++;
+    } else if (it->second.data == nullptr) {
+        make_room();
+        auto &entry = it->second;
+        entry.data.reset(new uint64_t[kPageSize]());
+        auto read = pread(swap_fd, entry.data.get(), kPageBytes,
+                          static_cast<off_t>(entry.swap_slot * kPageBytes));
+        if (read != static_cast<ssize_t>(kPageBytes) && error.empty()) {
+            error = std::string("read swap file: ") + strerror(errno);
+        }
+        lru.push_front(page_no);
+        entry.lru = lru.begin();
+        resident++;
+    } else {
+        lru.splice(lru.begin(), lru, it->second.lru);
+    }
+    last_page_no = page_no;
+    last_page = it->second.data.get();
+    return last_page;
+}
+
+void ShadowMemory::store(uint64_t address, uint32_t size, uint64_t writer) {
+    for (uint32_t i = 0; i < size; ++i) {
+        uint64_t byte = address + i;
+        auto page = get_page(byte >> kPageBits, true);
+        page[byte & (kPageSize - 1)] = writer + 1;
+    }
+}
+
+void ShadowMemory::load(uint64_t address, uint32_t size, std::vector<uint64_t> &out) {
+    for (uint32_t i = 0; i < size; ++i) {
+        uint64_t byte = address + i;
+        auto page = get_page(byte >> kPageBits, false);
+        if (page != nullptr && page[byte & (kPageSize - 1)] != 0) {
+            out.push_back(page[byte & (kPageSize - 1)] - 1);
+        }
+    }
+}
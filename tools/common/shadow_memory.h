@@ -0,0 +1,112 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_SHADOW_MEMORY_H
+#define QBDI_TRACER_SHADOW_MEMORY_H
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Last writer of every byte of the traced address space, keyed like a page
+ * table: a page of 4096 entries is allocated the first time one of its bytes
+ * is written. At most max_pages pages stay resident; the least recently used
+ * ones go to an unlinked swap file and come back on the next access, so a
+ * trace touching gigabytes of memory runs in a fixed budget.
+ *
+ * Writers are instruction numbers, bytes never written have none.
+ */
+class ShadowMemory {
+public:
+    static constexpr uint32_t kPageBits = 12;
+    static constexpr uint32_t kPageSize = 1u << kPageBits;
+
+    explicit ShadowMemory(size_t max_pages);
+
+    ~ShadowMemory();
+
+    ShadowMemory(const ShadowMemory &) = delete;
+
+    ShadowMemory &operator=(const ShadowMemory &) = delete;
+
+    // the swap file is created in dir when the budget is first exceeded
+    void set_swap_dir(const std::string &dir) {
+        swap_dir = dir;
+    }
+
+    void store(uint64_t address, uint32_t size, uint64_t writer);
+
+    // appends the writers of the bytes in [address, address + size) to out
+    void load(uint64_t address, uint32_t size, std::vector<uint64_t> &out);
+
+    [[nodiscard]] size_t get_page_count() const {
+        return pages.size();
+    }
+
+    [[nodiscard]] uint64_t get_swap_outs() const {
+        return swap_outs;
+    }
+
+    // set once a swap read or write failed, the results are incomplete after that
+    [[nodiscard]] const std::string &get_error() const {
+        return error;
+    }
+
+private:
+    typedef struct page_entry {
+        // writer + 1 per byte, 0 when never written; null while swapped out
+        std::unique_ptr<uint64_t[]> data;
+        int64_t swap_slot = -1;
+        std::list<uint64_t>::iterator lru;
+    } page_entry_t;
+
+    uint64_t *get_page(uint64_t page_no, bool create);
+
+    void make_room();
+
+    bool open_swap();
+
+private:
+    size_t max_pages;
+    std::unordered_map<uint64_t, page_entry_t> pages;
+    // resident pages, most recently used first
+    std::list<uint64_t> lru;
+    size_t resident = 0;
+    // one entry cache, most accesses hit the page of the previous one
+    uint64_t last_page_no = UINT64_MAX;
+    uint64_t *last_page = nullptr;
+    std::string swap_dir = "/tmp";
+    int swap_fd = -1;
+    int64_t next_slot = 0;
+    uint64_t swap_outs = 0;
+    std::string error;
+};
+
+
+#endif //QBDI_TRACER_SHADOW_MEMORY_H
@@ -0,0 +1,385 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "trace_reader.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <zlib.h>
+
+// sanity bound for a single chunk, the writer seals chunks at a few hundred KB
+static constexpr uint32_t kMaxChunkSize = 256 * 1024 * 1024;
+
+static inline void set_error(std::string *error, const std::string &message) {
+    if (error != nullptr) {
+        *error = message;
+    }
+}
+
+static bool pread_fully(int fd, void *buffer, size_t size, uint64_t offset) {
+    auto cursor = reinterpret_cast<uint8_t *>(buffer);
+    while (size > 0) {
+        ssize_t result = pread(fd, cursor, size, static_cast<off_t>(offset));
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            return false;
+        }
+        cursor += result;
+        size -= result;
+        offset += result;
+    }
+    return true;
+}
+
+std::unique_ptr<TraceReader> TraceReader::open(const std::string &path, std::string *error,
+                                               uint16_t accept_flags) {
+    auto reader = std::unique_ptr<TraceReader>(new TraceReader());
+    reader->fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (reader->fd < 0) {
+        set_error(error, "open " + path + ": " + strerror(errno));
+        return nullptr;
+    }
+    struct stat st{};
+    if (fstat(reader->fd, &st) != 0) {
+        set_error(error, "stat " + path + ": " + strerror(errno));
+        return nullptr;
+    }
+    reader->file_size = st.st_size;
+    if (!reader->build_index(error)) {
+        return nullptr;
+    }
+    auto flags = reader->header.flags & ~accept_flags;
+    if (flags & kTraceBranchOnly) {
+        set_error(error, "branch only trace, run itrace-expand on it first");
+        return nullptr;
+    }
+    if (flags & kTraceMemoryDump) {
+        set_error(error, "memory dump, read it with itrace-memdump");
+        return nullptr;
+    }
+    return reader;
+}
+
+TraceReader::~TraceReader() {
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+bool TraceReader::build_index(std::string *error) {
+    if (!pread_fully(fd, &header, sizeof(header), 0)) {
+        set_error(error, "trace file too short");
+        return false;
+    }
+    if (header.magic != kTraceMagic) {
+        set_error(error, "not a binary trace file");
+        return false;
+    }
+    if (header.version != kTraceVersion) {
+        set_error(error, "unsupported trace version " + std::to_string(header.version));
+        return false;
+    }
+    uint64_t offset = header.inst_offset != 0 ? header.inst_offset : sizeof(header);
+    while (offset < file_size) {
+        trace_chunk_ref_t ref{};
+        ref.offset = offset;
+        if (offset + sizeof(ref.header) > file_size ||
+            !pread_fully(fd, &ref.header, sizeof(ref.header), offset)) {
+            complete = false;
+            break;
+        }
+        if (ref.header.magic != kTraceChunkMagic || ref.header.header_size < sizeof(ref.header) ||
+            ref.header.stored_size > kMaxChunkSize || ref.header.raw_size > kMaxChunkSize) {
+            // a corrupted chunk header leaves no way to find the next chunk
+            complete = false;
+            break;
+        }
+        uint64_t next = offset + ref.header.header_size + ref.header.stored_size;
+        if (next > file_size) {
+            complete = false;
+            break;
+        }
+        chunks.push_back(ref);
+        offset = next;
+    }
+    return true;
+}
+
+uint64_t TraceReader::get_inst_count() const {
+    uint64_t count = 0;
+    for (const auto &chunk: chunks) {
+        count += chunk.header.inst_count;
+    }
+    return count;
+}
+
+size_t TraceReader::find_chunk(uint64_t inst_index) const {
+    // chunks are in trace order, first_index only grows
+    auto it = std::upper_bound(chunks.begin(), chunks.end(), inst_index,
+                               [](uint64_t index, const trace_chunk_ref_t &chunk) {
+                                   return index < chunk.header.first_index;
+                               });
+    if (it == chunks.begin()) {
+        return chunks.size();
+    }
+    --it;
+    if (inst_index >= it->header.first_index + it->header.inst_count) {
+        return chunks.size();
+    }
+    return it - chunks.begin();
+}
+
+bool TraceReader::read_chunk(size_t index, std::vector<uint8_t> &raw, std::string *error) const {
+    if (index >= chunks.size()) {
+        set_error(error, "chunk index out of range");
+        return false;
+    }
+    const auto &ref = chunks[index];
+    uint64_t payload_offset = ref.offset + ref.header.header_size;
+    if (!(ref.header.flags & kChunkCompressed)) {
+        raw.resize(ref.header.stored_size);
+        if (!pread_fully(fd, raw.data(), raw.size(), payload_offset)) {
+            set_error(error, "read chunk " + std::to_string(index) + " failed");
+            return false;
+        }
+        return true;
+    }
+    // one stored buffer per thread, chunks are read concurrently
+    thread_local std::vector<uint8_t> stored;
+    stored.resize(ref.header.stored_size);
+    if (!pread_fully(fd, stored.data(), stored.size(), payload_offset)) {
+        set_error(error, "read chunk " + std::to_string(index) + " failed");
+        return false;
+    }
+    raw.resize(ref.header.raw_size);
+    uLongf raw_size = ref.header.raw_size;
+    int ret = uncompress(raw.data(), &raw_size, stored.data(), stored.size());
+    if (ret != Z_OK || raw_size != ref.header.raw_size) {
+        set_error(error, "inflate chunk " + std::to_string(index) + " failed: " +
+                         std::to_string(ret));
+        return false;
+    }
+    return true;
+}
+
+bool TraceChunkDecoder::emit_pending(const inst_callback_t &callback) {
+    if (!has_pending) {
+        return true;
+    }
+    has_pending = false;
+    return callback(pending);
+}
+
+static bool read_string(const uint8_t *&cursor, const uint8_t *end, std::string_view &str) {
+    uint16_t size;
+    if (end - cursor < static_cast<ptrdiff_t>(sizeof(size))) {
+        return false;
+    }
+    memcpy(&size, cursor, sizeof(size));
+    cursor += sizeof(size);
+    if (end - cursor < size) {
+        return false;
+    }
+    str = std::string_view(reinterpret_cast<const char *>(cursor), size);
+    cursor += size;
+    return true;
+}
+
+bool TraceChunkDecoder::decode(const trace_chunk_header_t &header, const uint8_t *data,
+                               size_t size, const inst_callback_t &callback, std::string *error) {
+    generation++;
+    has_pending = false;
+    has_keyframe = false;
+    uint64_t index = header.first_index;
+    size_t offset = 0;
+    while (offset + sizeof(trace_record_header_t) <= size) {
+        trace_record_header_t record;
+        memcpy(&record, data + offset, sizeof(record));
+        if (record.size < sizeof(record) || record.size > size - offset) {
+            set_error(error, "bad record size at chunk offset " + std::to_string(offset));
+            return false;
+        }
+        auto body = data + offset + sizeof(record);
+        auto end = data + offset + record.size;
+        offset += record.size;
+        switch (record.type) {
+            case kRecordInstDesc: {
+                // resizing descs would leave the pending instruction dangling
+                if (!emit_pending(callback)) {
+                    return true;
+                }
+                if (end - body < static_cast<ptrdiff_t>(sizeof(trace_inst_desc_t))) {
+                    set_error(error, "truncated instruction descriptor");
+                    return false;
+                }
+                auto desc = reinterpret_cast<const trace_inst_desc_t *>(body);
+                auto cursor = body + sizeof(trace_inst_desc_t);
+                size_t operands_size = desc->operand_count * sizeof(trace_operand_desc_t);
+                if (static_cast<size_t>(end - cursor) <
+                    operands_size + desc->mnemonic_size + desc->disassembly_size) {
+                    set_error(error, "truncated instruction descriptor");
+                    return false;
+                }
+                if (desc->desc_id >= descs.size()) {
+                    descs.resize(desc->desc_id + 1);
+                    desc_generation.resize(desc->desc_id + 1, 0);
+                }
+                auto &view = descs[desc->desc_id];
+                view.desc = desc;
+                view.operands = reinterpret_cast<const trace_operand_desc_t *>(cursor);
+                cursor += operands_size;
+                view.mnemonic = std::string_view(reinterpret_cast<const char *>(cursor),
+                                                 desc->mnemonic_size);
+                cursor += desc->mnemonic_size;
+                view.disassembly = std::string_view(reinterpret_cast<const char *>(cursor),
+                                                    desc->disassembly_size);
+                view.values_size = 0;
+                for (uint8_t i = 0; i < desc->operand_count; i++) {
+                    auto &operand = view.operands[i];
+                    view.values_size += (operand.flags & kOperandPreValue) ? operand.size * 2
+                                                                           : operand.size;
+                }
+                desc_generation[desc->desc_id] = generation;
+                break;
+            }
+            case kRecordInst: {
+                if (!emit_pending(callback)) {
+                    return true;
+                }
+                if (end - body < static_cast<ptrdiff_t>(sizeof(trace_inst_record_t))) {
+                    set_error(error, "truncated instruction record");
+                    return false;
+                }
+                auto inst = reinterpret_cast<const trace_inst_record_t *>(body);
+                if (inst->desc_id >= descs.size() || desc_generation[inst->desc_id] != generation) {
+                    set_error(error, "instruction without descriptor " +
+                                     std::to_string(inst->desc_id));
+                    return false;
+                }
+                if (inst->values_size != descs[inst->desc_id].values_size) {
+                    set_error(error, "instruction values do not match descriptor " +
+                                     std::to_string(inst->desc_id));
+                    return false;
+                }
+                uint32_t values_size = trace_align8(sizeof(trace_inst_record_t) + inst->values_size);
+                if (static_cast<size_t>(end - body) <
+                    values_size + inst->access_count * sizeof(trace_memory_access_t)) {
+                    set_error(error, "truncated instruction record");
+                    return false;
+                }
+                pending.index = index++;
+                pending.desc = &descs[inst->desc_id];
+                pending.values = body + sizeof(trace_inst_record_t);
+                pending.accesses = reinterpret_cast<const trace_memory_access_t *>(body + values_size);
+                pending.access_count = inst->access_count;
+                pending.call = nullptr;
+                pending.keyframe = has_keyframe ? &keyframe : nullptr;
+                has_keyframe = false;
+                has_pending = true;
+                break;
+            }
+            case kRecordCall: {
+                if (!has_pending || end - body < static_cast<ptrdiff_t>(sizeof(trace_call_record_t))) {
+                    set_error(error, "call record without instruction");
+                    return false;
+                }
+                call.record = reinterpret_cast<const trace_call_record_t *>(body);
+                auto cursor = body + sizeof(trace_call_record_t);
+                call.args.resize(call.record->arg_count);
+                bool ok = read_string(cursor, end, call.module_name) &&
+                          read_string(cursor, end, call.fun_name) &&
+                          read_string(cursor, end, call.ret_value);
+                for (auto &arg: call.args) {
+                    ok = ok && read_string(cursor, end, arg);
+                }
+                call.raw_args.resize(call.record->raw_arg_count);
+                for (auto &arg: call.raw_args) {
+                    std::string_view data;
+                    ok = ok && read_string(cursor, end, arg.name) &&
+                         end - cursor >= static_cast<ptrdiff_t>(1 + sizeof(arg.value));
+                    if (!ok) {
+                        break;
+                    }
+                    arg.kind = *cursor++;
+                    memcpy(&arg.value, cursor, sizeof(arg.value));
+                    cursor += sizeof(arg.value);
+                    ok = read_string(cursor, end, data);
+                    arg.data = reinterpret_cast<const uint8_t *>(data.data());
+                    arg.data_size = data.size();
+                }
+                if (!ok) {
+                    set_error(error, "truncated call record");
+                    return false;
+                }
+                pending.call = &call;
+                break;
+            }
+            case kRecordKeyframe: {
+                // the keyframe view is shared with the pending instruction
+                if (!emit_pending(callback)) {
+                    return true;
+                }
+                if (end - body < static_cast<ptrdiff_t>(sizeof(trace_keyframe_record_t))) {
+                    set_error(error, "truncated keyframe");
+                    return false;
+                }
+                keyframe.record = reinterpret_cast<const trace_keyframe_record_t *>(body);
+                auto cursor = body + sizeof(trace_keyframe_record_t);
+                if (static_cast<size_t>(end - cursor) <
+                    static_cast<size_t>(keyframe.record->gpr_size) + keyframe.record->fpr_size) {
+                    set_error(error, "truncated keyframe");
+                    return false;
+                }
+                keyframe.gpr = cursor;
+                keyframe.fpr = cursor + keyframe.record->gpr_size;
+                has_keyframe = true;
+                break;
+            }
+            default:
+                // unknown records are skipped, newer writers may add some
+                break;
+        }
+    }
+    emit_pending(callback);
+    return true;
+}
+
+const uint8_t *trace_operand_value(const trace_inst_view_t &inst, size_t operand_index, bool pre) {
+    auto cursor = inst.values;
+    for (size_t i = 0; i < operand_index; ++i) {
+        const auto &operand = inst.desc->operands[i];
+        cursor += (operand.flags & kOperandPreValue) ? operand.size * 2 : operand.size;
+    }
+    const auto &operand = inst.desc->operands[operand_index];
+    if (operand.flags & kOperandPreValue) {
+        return pre ? cursor : cursor + operand.size;
+    }
+    return pre ? nullptr : cursor;
+}
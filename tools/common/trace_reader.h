@@ -0,0 +1,186 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_TRACE_READER_H
+#define QBDI_TRACER_TRACE_READER_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "trace/record/trace_format.h"
+
+typedef struct trace_chunk_ref {
+    // file offset of the chunk header
+    uint64_t offset;
+    trace_chunk_header_t header;
+} trace_chunk_ref_t;
+
+/**
+ * Instruction descriptor of a chunk, pointing into the decoded chunk payload.
+ */
+typedef struct trace_inst_desc_view {
+    const trace_inst_desc_t *desc = nullptr;
+    const trace_operand_desc_t *operands = nullptr;
+    std::string_view mnemonic;
+    std::string_view disassembly;
+    // bytes of operand values every instruction of this desc carries
+    uint32_t values_size = 0;
+} trace_inst_desc_view_t;
+
+// an argument the tracer captured without rendering it, see append_call_arg
+typedef struct trace_call_arg_view {
+    std::string_view name;
+    uint8_t kind = kCallArgHex;
+    uint64_t value = 0;
+    const uint8_t *data = nullptr;
+    size_t data_size = 0;
+} trace_call_arg_view_t;
+
+typedef struct trace_call_view {
+    const trace_call_record_t *record = nullptr;
+    std::string_view module_name;
+    std::string_view fun_name;
+    std::string_view ret_value;
+    std::vector<std::string_view> args;
+    // follow args when rendered
+    std::vector<trace_call_arg_view_t> raw_args;
+} trace_call_view_t;
+
+typedef struct trace_keyframe_view {
+    const trace_keyframe_record_t *record = nullptr;
+    const uint8_t *gpr = nullptr;
+    const uint8_t *fpr = nullptr;
+} trace_keyframe_view_t;
+
+/**
+ * One traced instruction. Everything points into the chunk payload and is only
+ * valid inside the TraceChunkDecoder callback.
+ */
+typedef struct trace_inst_view {
+    uint64_t index = 0;
+    const trace_inst_desc_view_t *desc = nullptr;
+    const uint8_t *values = nullptr;
+    const trace_memory_access_t *accesses = nullptr;
+    uint16_t access_count = 0;
+    const trace_call_view_t *call = nullptr;
+    // register state before the instruction, when the writer stored one
+    const trace_keyframe_view_t *keyframe = nullptr;
+} trace_inst_view_t;
+
+/**
+ * Opens a binary trace written by TraceRecordWriter (itrace.bin) and indexes
+ * its chunks. Chunks are read with pread, so read_chunk can be called from
+ * several threads at once.
+ */
+class TraceReader {
+public:
+    /**
+     * Branch only traces and memory dumps hold no instruction records, they
+     * are refused unless their trace_file_flag_t is in accept_flags, so a
+     * tool never reads them as an empty trace.
+     */
+    static std::unique_ptr<TraceReader> open(const std::string &path, std::string *error,
+                                             uint16_t accept_flags = 0);
+
+    ~TraceReader();
+
+    [[nodiscard]] const serialize_file_t &get_header() const {
+        return header;
+    }
+
+    [[nodiscard]] const std::vector<trace_chunk_ref_t> &get_chunks() const {
+        return chunks;
+    }
+
+    // total instruction count of the indexed chunks
+    [[nodiscard]] uint64_t get_inst_count() const;
+
+    // chunk holding the instruction, get_chunks().size() when there is none
+    [[nodiscard]] size_t find_chunk(uint64_t inst_index) const;
+
+    // reads and inflates a chunk payload into raw
+    bool read_chunk(size_t index, std::vector<uint8_t> &raw, std::string *error) const;
+
+    // false when the file ends in a partially written chunk
+    [[nodiscard]] bool is_complete() const {
+        return complete;
+    }
+
+private:
+    TraceReader() = default;
+
+    bool build_index(std::string *error);
+
+private:
+    int fd = -1;
+    uint64_t file_size = 0;
+    bool complete = true;
+    serialize_file_t header{};
+    std::vector<trace_chunk_ref_t> chunks;
+};
+
+/**
+ * Walks the records of one decoded chunk. A call record is attached to the
+ * instruction in front of it, so every instruction is reported exactly once,
+ * together with its call if it has one.
+ */
+class TraceChunkDecoder {
+public:
+    typedef std::function<bool(const trace_inst_view_t &)> inst_callback_t;
+
+    /**
+     * Returns false on a malformed chunk; instructions before the damage were
+     * already reported. The callback returns false to stop early.
+     */
+    bool decode(const trace_chunk_header_t &header, const uint8_t *data, size_t size,
+                const inst_callback_t &callback, std::string *error = nullptr);
+
+private:
+    bool emit_pending(const inst_callback_t &callback);
+
+private:
+    // indexed by desc_id, desc_generation tells which chunk filled an entry
+    std::vector<trace_inst_desc_view_t> descs;
+    std::vector<uint64_t> desc_generation;
+    uint64_t generation = 0;
+    trace_inst_view_t pending{};
+    bool has_pending = false;
+    trace_call_view_t call;
+    trace_keyframe_view_t keyframe;
+    // a keyframe was read and waits for its instruction record
+    bool has_keyframe = false;
+};
+
+/**
+ * Reads the value of an operand from the values area of an instruction record.
+ * pre selects the value before the instruction when the operand stores one.
+ */
+const uint8_t *trace_operand_value(const trace_inst_view_t &inst, size_t operand_index, bool pre);
+
+
+#endif //QBDI_TRACER_TRACE_READER_H
@@ -0,0 +1,413 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "trace_renderer.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include "trace/record/call_arg_format.h"
+
+static constexpr char kHexDigits[] = "0123456789abcdef";
+
+void TraceRenderer::append_hex(std::string &out, uint64_t value) {
+    // same as fmt "{:#x}"
+    char buffer[18];
+    char *end = buffer + sizeof(buffer);
+    char *cursor = end;
+    do {
+        *--cursor = kHexDigits[value & 0xf];
+        value >>= 4;
+    } while (value != 0);
+    *--cursor = 'x';
+    *--cursor = '0';
+    out.append(cursor, end - cursor);
+}
+
+static void append_hex128(std::string &out, uint64_t low, uint64_t high) {
+    if (high == 0) {
+        TraceRenderer::append_hex(out, low);
+        return;
+    }
+    TraceRenderer::append_hex(out, high);
+    char buffer[16];
+    for (int i = 15; i >= 0; --i) {
+        buffer[i] = kHexDigits[low & 0xf];
+        low >>= 4;
+    }
+    out.append(buffer, sizeof(buffer));
+}
+
+static inline void append_uint(std::string &out, uint64_t value) {
+    char buffer[24];
+    int size = snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(value));
+    out.append(buffer, size);
+}
+
+static void append_json_string(std::string &out, std::string_view str) {
+    out.push_back('"');
+    for (char c: str) {
+        switch (c) {
+            case '"':
+                out.append("\\\"");
+                break;
+            case '\\':
+                out.append("\\\\");
+                break;
+            case '\n':
+                out.append("\\n");
+                break;
+            case '\r':
+                out.append("\\r");
+                break;
+            case '\t':
+                out.append("\\t");
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char buffer[8];
+                    snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+                    out.append(buffer);
+                } else {
+                    out.push_back(c);
+                }
+                break;
+        }
+    }
+    out.push_back('"');
+}
+
+static void append_csv_field(std::string &out, std::string_view str) {
+    if (str.find_first_of(",\"\n\r") == std::string_view::npos) {
+        out.append(str);
+        return;
+    }
+    out.push_back('"');
+    for (char c: str) {
+        if (c == '"') {
+            out.push_back('"');
+        }
+        out.push_back(c);
+    }
+    out.push_back('"');
+}
+
+static inline uint64_t load_value(const uint8_t *value, size_t size) {
+    uint64_t result = 0;
+    memcpy(&result, value, std::min<size_t>(size, sizeof(result)));
+    return result;
+}
+
+void TraceRenderer::append_value(std::string &out, const trace_operand_desc_t &operand,
+                                 const uint8_t *value) const {
+    switch (operand.format) {
+        case kValueFloat: {
+            float f;
+            memcpy(&f, value, sizeof(f));
+            char buffer[48];
+            out.append(buffer, snprintf(buffer, sizeof(buffer), "%.2a", f));
+            return;
+        }
+        case kValueDouble: {
+            double d;
+            memcpy(&d, value, sizeof(d));
+            char buffer[48];
+            out.append(buffer, snprintf(buffer, sizeof(buffer), "%.2a", d));
+            return;
+        }
+        default:
+            break;
+    }
+    if (operand.size == 16 && is_64bit) {
+        append_hex128(out, load_value(value, 8), load_value(value + 8, 8));
+    } else {
+        // arm32 prints the low half of q registers
+        append_hex(out, load_value(value, operand.size));
+    }
+}
+
+void TraceRenderer::append_registers(std::string &out, const trace_inst_view_t &inst,
+                                     bool bracketed) const {
+    // current values first, then the values read before the instruction
+    std::string current;
+    std::string read_regs;
+    auto append_register = [&](std::string &target, const trace_operand_desc_t &operand,
+                               const uint8_t *value) {
+        if (!target.empty()) {
+            target.push_back(',');
+        }
+        target.append(operand.name, strnlen(operand.name, sizeof(operand.name)));
+        target.append("= ");
+        append_value(target, operand, value);
+    };
+    for (size_t i = 0; i < inst.desc->desc->operand_count; ++i) {
+        const auto &operand = inst.desc->operands[i];
+        auto pre = trace_operand_value(inst, i, true);
+        if (pre != nullptr && !is_64bit && operand.kind == kOperandFpr && operand.size == 16) {
+            // arm32 prints both q register values in the current list
+            append_register(current, operand, pre);
+        } else if (pre != nullptr) {
+            append_register(read_regs, operand, pre);
+        }
+        append_register(current, operand, trace_operand_value(inst, i, false));
+    }
+    if (!bracketed) {
+        out.append(current);
+        if (!read_regs.empty()) {
+            out.push_back(',');
+            out.append(read_regs);
+        }
+        return;
+    }
+    // [current],[read] as LoggerManager::format_register_info joins them
+    if (!current.empty()) {
+        out.push_back('[');
+        out.append(current);
+        out.push_back(']');
+    }
+    if (!read_regs.empty()) {
+        out.append(",[");
+        out.append(read_regs);
+        out.push_back(']');
+    }
+}
+
+void TraceRenderer::append_accesses(std::string &out, const trace_inst_view_t &inst,
+                                    bool bracketed) const {
+    if (inst.access_count == 0) {
+        return;
+    }
+    if (bracketed) {
+        out.push_back('[');
+    }
+    for (uint16_t i = 0; i < inst.access_count; ++i) {
+        trace_memory_access_t ma;
+        memcpy(&ma, inst.accesses + i, sizeof(ma));
+        if (i != 0) {
+            out.push_back(',');
+        }
+        bool is_read = ma.type == kAccessRead;
+        if (ma.flags & kAccessInModule) {
+            out.append(is_read ? "read module offset:" : "write module offset:");
+            append_hex(out, ma.address - module_base);
+            out.append(" size:");
+            append_hex(out, ma.size);
+            out.append(" => ");
+            append_hex(out, ma.value);
+            if (!is_read) {
+                out.push_back(' ');
+            }
+        } else {
+            out.append(is_read ? "read memory:" : "write memory:");
+            append_hex(out, ma.address);
+            out.append("=>");
+            append_hex(out, ma.value);
+            out.append(" memory block index:");
+            append_hex(out, ma.block_index);
+            out.append(" size:");
+            append_hex(out, ma.size);
+            out.append(" offset:");
+            append_hex(out, ma.block_offset);
+        }
+    }
+    if (bracketed) {
+        out.push_back(']');
+    }
+}
+
+void TraceRenderer::append_call(std::string &out, const trace_inst_view_t &inst) {
+    if (inst.call == nullptr) {
+        out.push_back(' ');
+        return;
+    }
+    auto call = inst.call;
+    out.append(call->module_name);
+    out.push_back(':');
+    out.append(call->fun_name);
+    out.append(" args:[");
+    for (size_t i = 0; i < call->args.size(); ++i) {
+        if (i != 0) {
+            out.push_back(',');
+        }
+        out.append(call->args[i]);
+    }
+    for (size_t i = 0; i < call->raw_args.size(); ++i) {
+        if (i != 0 || !call->args.empty()) {
+            out.push_back(',');
+        }
+        const auto &arg = call->raw_args[i];
+        append_call_arg(out, arg.name, arg.kind, arg.value, arg.data, arg.data_size);
+    }
+    out.append("] ");
+    out.append(call->ret_value);
+}
+
+void TraceRenderer::render_prologue(std::string &out) const {
+    if (format == kRenderCsv) {
+        out.append("index,pc,offset,mnemonic,disassembly,registers,memory,call\n");
+    }
+}
+
+void TraceRenderer::render(std::string &out, const trace_inst_view_t &inst) const {
+    switch (format) {
+        case kRenderText:
+            render_text(out, inst);
+            break;
+        case kRenderCsv:
+            render_csv(out, inst);
+            break;
+        case kRenderJson:
+            render_json(out, inst);
+            break;
+    }
+}
+
+void TraceRenderer::render_text(std::string &out, const trace_inst_view_t &inst) const {
+    auto desc = inst.desc->desc;
+    out.push_back('|');
+    append_hex(out, desc->address);
+    out.push_back('|');
+    append_hex(out, desc->address - module_base);
+    out.push_back('|');
+    out.append(inst.desc->disassembly);
+    out.push_back('|');
+    append_registers(out, inst, true);
+    out.push_back('|');
+    append_accesses(out, inst, true);
+    out.push_back('|');
+    append_call(out, inst);
+    out.push_back('\n');
+}
+
+void TraceRenderer::render_csv(std::string &out, const trace_inst_view_t &inst) const {
+    auto desc = inst.desc->desc;
+    std::string field;
+    append_uint(out, inst.index);
+    out.push_back(',');
+    append_hex(out, desc->address);
+    out.push_back(',');
+    append_hex(out, desc->address - module_base);
+    out.push_back(',');
+    append_csv_field(out, inst.desc->mnemonic);
+    out.push_back(',');
+    append_csv_field(out, inst.desc->disassembly);
+    out.push_back(',');
+    append_registers(field, inst, false);
+    append_csv_field(out, field);
+    out.push_back(',');
+    field.clear();
+    append_accesses(field, inst, false);
+    append_csv_field(out, field);
+    out.push_back(',');
+    if (inst.call != nullptr) {
+        field.clear();
+        append_call(field, inst);
+        append_csv_field(out, field);
+    }
+    out.push_back('\n');
+}
+
+void TraceRenderer::render_json(std::string &out, const trace_inst_view_t &inst) const {
+    auto desc = inst.desc->desc;
+    std::string value;
+    out.append("{\"index\":");
+    append_uint(out, inst.index);
+    out.append(",\"pc\":\"");
+    append_hex(out, desc->address);
+    out.append("\",\"offset\":\"");
+    append_hex(out, desc->address - module_base);
+    out.append("\",\"mnemonic\":");
+    append_json_string(out, inst.desc->mnemonic);
+    out.append(",\"disassembly\":");
+    append_json_string(out, inst.desc->disassembly);
+    out.append(",\"registers\":[");
+    for (size_t i = 0; i < desc->operand_count; ++i) {
+        const auto &operand = inst.desc->operands[i];
+        if (i != 0) {
+            out.push_back(',');
+        }
+        out.append("{\"name\":");
+        append_json_string(out, std::string_view(operand.name,
+                                                 strnlen(operand.name, sizeof(operand.name))));
+        value.clear();
+        append_value(value, operand, trace_operand_value(inst, i, false));
+        out.append(",\"value\":");
+        append_json_string(out, value);
+        auto pre = trace_operand_value(inst, i, true);
+        if (pre != nullptr) {
+            value.clear();
+            append_value(value, operand, pre);
+            out.append(",\"pre\":");
+            append_json_string(out, value);
+        }
+        out.push_back('}');
+    }
+    out.append("],\"memory\":[");
+    for (uint16_t i = 0; i < inst.access_count; ++i) {
+        trace_memory_access_t ma;
+        memcpy(&ma, inst.accesses + i, sizeof(ma));
+        if (i != 0) {
+            out.push_back(',');
+        }
+        out.append(ma.type == kAccessRead ? "{\"type\":\"read\"" : "{\"type\":\"write\"");
+        out.append(",\"address\":\"");
+        append_hex(out, ma.address);
+        out.append("\",\"value\":\"");
+        append_hex(out, ma.value);
+        out.append("\",\"size\":");
+        append_uint(out, ma.size);
+        out.append(ma.flags & kAccessInModule ? ",\"in_module\":true}" : ",\"in_module\":false}");
+    }
+    out.push_back(']');
+    if (inst.call != nullptr) {
+        auto call = inst.call;
+        out.append(",\"call\":{\"module\":");
+        append_json_string(out, call->module_name);
+        out.append(",\"name\":");
+        append_json_string(out, call->fun_name);
+        out.append(",\"address\":\"");
+        append_hex(out, call->record->fun_address);
+        out.append("\",\"args\":[");
+        for (size_t i = 0; i < call->args.size(); ++i) {
+            if (i != 0) {
+                out.push_back(',');
+            }
+            append_json_string(out, call->args[i]);
+        }
+        std::string rendered;
+        for (size_t i = 0; i < call->raw_args.size(); ++i) {
+            if (i != 0 || !call->args.empty()) {
+                out.push_back(',');
+            }
+            const auto &arg = call->raw_args[i];
+            rendered.clear();
+            append_call_arg(rendered, arg.name, arg.kind, arg.value, arg.data, arg.data_size);
+            append_json_string(out, rendered);
+        }
+        out.append("],\"ret\":");
+        append_json_string(out, call->ret_value);
+        out.push_back('}');
+    }
+    out.append("}\n");
+}
@@ -0,0 +1,82 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_TRACE_RENDERER_H
+#define QBDI_TRACER_TRACE_RENDERER_H
+
+#include <string>
+#include "trace_reader.h"
+
+typedef enum render_format {
+    // same lines as itrace.txt, without the time prefix
+    kRenderText,
+    kRenderCsv,
+    // one json object per line
+    kRenderJson,
+} render_format_t;
+
+/**
+ * Renders decoded instructions. The text format mirrors
+ * LoggerManager::write_trace_info so tools built for itrace.txt keep working:
+ *   |pc|offset|disassembly|registers|memory accesses|call
+ */
+class TraceRenderer {
+public:
+    TraceRenderer(const serialize_file_t &header, render_format_t format)
+            : module_base(header.module_base), is_64bit(header.is_64bit), format(format) {}
+
+    // column names for csv, empty for the other formats
+    void render_prologue(std::string &out) const;
+
+    void render(std::string &out, const trace_inst_view_t &inst) const;
+
+    static void append_hex(std::string &out, uint64_t value);
+
+    // one register value, formatted like in the text format
+    void append_value(std::string &out, const trace_operand_desc_t &operand,
+                      const uint8_t *value) const;
+
+private:
+    void render_text(std::string &out, const trace_inst_view_t &inst) const;
+
+    void render_csv(std::string &out, const trace_inst_view_t &inst) const;
+
+    void render_json(std::string &out, const trace_inst_view_t &inst) const;
+
+    // bracketed wraps each list in [] like the text log of the tracer, csv and json fields stay bare
+    void append_registers(std::string &out, const trace_inst_view_t &inst, bool bracketed) const;
+
+    void append_accesses(std::string &out, const trace_inst_view_t &inst, bool bracketed) const;
+
+    static void append_call(std::string &out, const trace_inst_view_t &inst);
+
+private:
+    uint64_t module_base;
+    bool is_64bit;
+    render_format_t format;
+};
+
+
+#endif //QBDI_TRACER_TRACE_RENDERER_H
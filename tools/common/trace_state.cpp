@@ -0,0 +1,131 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "trace_state.h"
+#include <algorithm>
+#include <cstring>
+
+static void load_keyframe(const trace_keyframe_view_t &keyframe, trace_register_state_t &state) {
+    const auto &record = *keyframe.record;
+    state.keyframe_index = record.inst_index;
+    state.replayed = 0;
+    state.gpr.assign(keyframe.gpr, keyframe.gpr + record.gpr_size);
+    state.fpr.assign(keyframe.fpr, keyframe.fpr + record.fpr_size);
+    state.gpr_known.assign(record.gpr_size, 1);
+    state.fpr_known.assign(record.fpr_size, 1);
+}
+
+static void apply_value(const trace_operand_desc_t &operand, const uint8_t *value,
+                        trace_register_state_t &state) {
+    auto &bytes = operand.kind == kOperandGpr ? state.gpr : state.fpr;
+    auto &known = operand.kind == kOperandGpr ? state.gpr_known : state.fpr_known;
+    size_t end = operand.state_offset + operand.size;
+    if (bytes.size() < end) {
+        // no keyframe told the state size yet
+        bytes.resize(end, 0);
+        known.resize(end, 0);
+    }
+    memcpy(bytes.data() + operand.state_offset, value, operand.size);
+    memset(known.data() + operand.state_offset, 1, operand.size);
+}
+
+bool TraceStateRebuilder::starts_with_keyframe(size_t chunk_index, std::string *error) {
+    if (!reader.read_chunk(chunk_index, raw, error)) {
+        return false;
+    }
+    bool found = false;
+    decoder.decode(reader.get_chunks()[chunk_index].header, raw.data(), raw.size(),
+                   [&](const trace_inst_view_t &inst) {
+                       found = inst.keyframe != nullptr;
+                       return false;
+                   }, error);
+    return found;
+}
+
+bool TraceStateRebuilder::rebuild(uint64_t index, trace_register_state_t &state,
+                                  std::string *error) {
+    const auto &chunks = reader.get_chunks();
+    auto last = reader.find_chunk(index);
+    if (last >= chunks.size()) {
+        if (error != nullptr) {
+            *error = "instruction " + std::to_string(index) + " is not in the trace";
+        }
+        return false;
+    }
+    if (error != nullptr) {
+        error->clear();
+    }
+    state = trace_register_state_t{};
+    state.index = index;
+    auto first = last;
+    while (first > 0 && !starts_with_keyframe(first, error)) {
+        if (error != nullptr && !error->empty()) {
+            return false;
+        }
+        first--;
+    }
+    bool reached = false;
+    for (auto chunk_index = first; chunk_index <= last && !reached; ++chunk_index) {
+        if (!reader.read_chunk(chunk_index, raw, error)) {
+            return false;
+        }
+        bool ok = decoder.decode(chunks[chunk_index].header, raw.data(), raw.size(),
+                                 [&](const trace_inst_view_t &inst) {
+            if (inst.keyframe != nullptr) {
+                load_keyframe(*inst.keyframe, state);
+            }
+            const auto &desc = *inst.desc;
+            if (inst.index == index) {
+                state.address = desc.desc->address;
+                // values read by the instruction itself are part of the state before it
+                for (size_t i = 0; i < desc.desc->operand_count; ++i) {
+                    auto value = trace_operand_value(inst, i, true);
+                    if (value != nullptr) {
+                        apply_value(desc.operands[i], value, state);
+                    }
+                }
+                reached = true;
+                return false;
+            }
+            for (size_t i = 0; i < desc.desc->operand_count; ++i) {
+                apply_value(desc.operands[i], trace_operand_value(inst, i, false), state);
+            }
+            state.replayed++;
+            return true;
+        }, error);
+        if (!ok) {
+            return false;
+        }
+    }
+    if (!reached && error != nullptr) {
+        *error = "instruction " + std::to_string(index) + " was not decoded";
+    }
+    if (reached && (reader.get_header().flags & kTraceExpanded) && state.keyframe_index != index) {
+        // expanded instructions carry no operands, the keyframe went stale at the first one
+        std::fill(state.gpr_known.begin(), state.gpr_known.end(), 0);
+        std::fill(state.fpr_known.begin(), state.fpr_known.end(), 0);
+    }
+    return reached;
+}
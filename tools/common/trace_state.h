@@ -0,0 +1,78 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_TRACE_STATE_H
+#define QBDI_TRACER_TRACE_STATE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "trace_reader.h"
+
+/**
+ * Raw GPRState / FPRState of the traced architecture before an instruction
+ * ran. known holds one flag per byte; everything is known once a keyframe
+ * was found, traces written without keyframes only know the bytes their
+ * operand values covered.
+ */
+typedef struct trace_register_state {
+    uint64_t index = 0;
+    // pc of the instruction, the pc slot of gpr is only right at a keyframe
+    uint64_t address = 0;
+    // instruction of the keyframe the replay started from, UINT64_MAX for none
+    uint64_t keyframe_index = UINT64_MAX;
+    uint64_t replayed = 0;
+    std::vector<uint8_t> gpr;
+    std::vector<uint8_t> fpr;
+    std::vector<uint8_t> gpr_known;
+    std::vector<uint8_t> fpr_known;
+} trace_register_state_t;
+
+/**
+ * Rebuilds the register state at any instruction from the closest keyframe
+ * before it. The writer opens every chunk with a keyframe, so this inflates
+ * one chunk and replays at most a keyframe interval of instructions. Older
+ * traces without keyframes are replayed from the start. In traces expanded
+ * from branch only ones the registers are only known at a keyframe.
+ */
+class TraceStateRebuilder {
+public:
+    explicit TraceStateRebuilder(const TraceReader &reader) : reader(reader) {}
+
+    // the state before instruction index ran
+    bool rebuild(uint64_t index, trace_register_state_t &state, std::string *error);
+
+private:
+    // true when the first instruction of the chunk carries a keyframe
+    bool starts_with_keyframe(size_t chunk_index, std::string *error);
+
+private:
+    const TraceReader &reader;
+    TraceChunkDecoder decoder;
+    std::vector<uint8_t> raw;
+};
+
+
+#endif //QBDI_TRACER_TRACE_STATE_H
@@ -0,0 +1,309 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * itrace-decode: renders a binary trace (itrace.bin) on the host.
+ *
+ *   itrace-decode [-f text|csv|json] [-j threads] [-o output]
+ *                 [-p pc_begin-pc_end] [-r offset_begin-offset_end]
+ *                 [-m mnemonic[,mnemonic...]] [-F function] [-w first:last]
+ *                 [-v] itrace.bin
+ *
+ * Chunks are inflated, decoded, filtered and rendered on a thread pool and
+ * written in trace order. All filters must match:
+ *   -p  absolute pc in [begin, end)
+ *   -r  pc offset from the module base in [begin, end)
+ *   -m  mnemonic, case insensitive
+ *   -F  instructions calling a function whose name contains the string
+ *   -w  instruction numbers in [first, last), chunks outside are never read
+ */
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <strings.h>
+#include <unistd.h>
+#include <vector>
+#include "common/ordered_executor.h"
+#include "common/trace_reader.h"
+#include "common/trace_renderer.h"
+
+#define LOGI(fmt, ...) fprintf(stderr, "[I] " fmt "\n", ##__VA_ARGS__)
+#define LOGE(fmt, ...) fprintf(stderr, "[E] " fmt "\n", ##__VA_ARGS__)
+
+typedef struct decode_filter {
+    uint64_t pc_begin = 0;
+    uint64_t pc_end = UINT64_MAX;
+    uint64_t offset_begin = 0;
+    uint64_t offset_end = UINT64_MAX;
+    uint64_t index_begin = 0;
+    uint64_t index_end = UINT64_MAX;
+    std::vector<std::string> mnemonics;
+    std::string function;
+} decode_filter_t;
+
+typedef struct chunk_output {
+    std::string text;
+    uint64_t decoded = 0;
+    uint64_t matched = 0;
+    std::string error;
+} chunk_output_t;
+
+static bool parse_u64(const char *str, uint64_t &value) {
+    char *end = nullptr;
+    errno = 0;
+    value = strtoull(str, &end, 0);
+    return errno == 0 && end != str && *end == 0;
+}
+
+static bool parse_range(const char *arg, char separator, uint64_t &begin, uint64_t &end) {
+    std::string str = arg;
+    auto pos = str.find(separator);
+    if (pos == std::string::npos) {
+        return false;
+    }
+    auto begin_str = str.substr(0, pos);
+    auto end_str = str.substr(pos + 1);
+    // an empty side leaves the range open
+    if (!begin_str.empty() && !parse_u64(begin_str.c_str(), begin)) {
+        return false;
+    }
+    if (!end_str.empty() && !parse_u64(end_str.c_str(), end)) {
+        return false;
+    }
+    return begin <= end;
+}
+
+static std::vector<std::string> split(const std::string &str, char separator) {
+    std::vector<std::string> result;
+    size_t start = 0;
+    while (start <= str.size()) {
+        auto pos = str.find(separator, start);
+        if (pos == std::string::npos) {
+            pos = str.size();
+        }
+        if (pos > start) {
+            result.push_back(str.substr(start, pos - start));
+        }
+        start = pos + 1;
+    }
+    return result;
+}
+
+static bool match_filter(const decode_filter_t &filter, uint64_t module_base,
+                         const trace_inst_view_t &inst) {
+    if (inst.index < filter.index_begin || inst.index >= filter.index_end) {
+        return false;
+    }
+    uint64_t pc = inst.desc->desc->address;
+    if (pc < filter.pc_begin || pc >= filter.pc_end) {
+        return false;
+    }
+    uint64_t offset = pc - module_base;
+    if (offset < filter.offset_begin || offset >= filter.offset_end) {
+        return false;
+    }
+    if (!filter.mnemonics.empty()) {
+        bool found = false;
+        for (const auto &mnemonic: filter.mnemonics) {
+            if (mnemonic.size() == inst.desc->mnemonic.size() &&
+                strncasecmp(mnemonic.data(), inst.desc->mnemonic.data(), mnemonic.size()) == 0) {
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            return false;
+        }
+    }
+    if (!filter.function.empty()) {
+        if (inst.call == nullptr ||
+            inst.call->fun_name.find(filter.function) == std::string_view::npos) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void usage(const char *name) {
+    fprintf(stderr,
+            "usage: %s [-f text|csv|json] [-j threads] [-o output] [-p pc_begin-pc_end]\n"
+            "          [-r offset_begin-offset_end] [-m mnemonic[,mnemonic...]] [-F function]\n"
+            "          [-w first:last] [-v] itrace.bin\n", name);
+}
+
+int main(int argc, char **argv) {
+    render_format_t format = kRenderText;
+    unsigned threads = OrderedExecutor<chunk_output_t>::default_threads();
+    std::string output_path;
+    decode_filter_t filter;
+    bool verbose = false;
+    int opt;
+    while ((opt = getopt(argc, argv, "f:j:o:p:r:m:F:w:vh")) != -1) {
+        switch (opt) {
+            case 'f':
+                if (strcmp(optarg, "text") == 0) {
+                    format = kRenderText;
+                } else if (strcmp(optarg, "csv") == 0) {
+                    format = kRenderCsv;
+                } else if (strcmp(optarg, "json") == 0) {
+                    format = kRenderJson;
+                } else {
+                    LOGE("unknown format %s", optarg);
+                    return 1;
+                }
+                break;
+            case 'j':
+                threads = static_cast<unsigned>(atoi(optarg));
+                break;
+            case 'o':
+                output_path = optarg;
+                break;
+            case 'p':
+                if (!parse_range(optarg, '-', filter.pc_begin, filter.pc_end)) {
+                    LOGE("bad pc range %s", optarg);
+                    return 1;
+                }
+                break;
+            case 'r':
+                if (!parse_range(optarg, '-', filter.offset_begin, filter.offset_end)) {
+                    LOGE("bad offset range %s", optarg);
+                    return 1;
+                }
+                break;
+            case 'm':
+                filter.mnemonics = split(optarg, ',');
+                break;
+            case 'F':
+                filter.function = optarg;
+                break;
+            case 'w':
+                if (!parse_range(optarg, ':', filter.index_begin, filter.index_end)) {
+                    LOGE("bad instruction window %s", optarg);
+                    return 1;
+                }
+                break;
+            case 'v':
+                verbose = true;
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (optind != argc - 1) {
+        usage(argv[0]);
+        return 1;
+    }
+    std::string error;
+    auto reader = TraceReader::open(argv[optind], &error);
+    if (reader == nullptr) {
+        LOGE("%s", error.c_str());
+        return 1;
+    }
+    if (!reader->is_complete()) {
+        LOGI("%s ends in a partial chunk, decoding the complete ones", argv[optind]);
+    }
+    FILE *out = stdout;
+    if (!output_path.empty()) {
+        out = fopen(output_path.c_str(), "w");
+        if (out == nullptr) {
+            LOGE("open %s failed: %s", output_path.c_str(), strerror(errno));
+            return 1;
+        }
+    }
+
+    // the instruction window selects chunks without reading them
+    std::vector<size_t> selected;
+    for (size_t i = 0; i < reader->get_chunks().size(); ++i) {
+        const auto &header = reader->get_chunks()[i].header;
+        if (header.first_index + header.inst_count > filter.index_begin &&
+            header.first_index < filter.index_end) {
+            selected.push_back(i);
+        }
+    }
+
+    const auto &file_header = reader->get_header();
+    TraceRenderer renderer(file_header, format);
+    std::string prologue;
+    renderer.render_prologue(prologue);
+    fwrite(prologue.data(), 1, prologue.size(), out);
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t decoded = 0;
+    uint64_t matched = 0;
+    bool failed = false;
+    OrderedExecutor<chunk_output_t> executor(threads);
+    executor.run(selected.size(), [&](size_t i, chunk_output_t &result) {
+        thread_local TraceChunkDecoder decoder;
+        thread_local std::vector<uint8_t> raw;
+        result.text.clear();
+        result.error.clear();
+        result.decoded = 0;
+        result.matched = 0;
+        auto chunk_index = selected[i];
+        if (!reader->read_chunk(chunk_index, raw, &result.error)) {
+            return;
+        }
+        const auto &header = reader->get_chunks()[chunk_index].header;
+        decoder.decode(header, raw.data(), raw.size(), [&](const trace_inst_view_t &inst) {
+            result.decoded++;
+            if (match_filter(filter, file_header.module_base, inst)) {
+                result.matched++;
+                renderer.render(result.text, inst);
+            }
+            return inst.index + 1 < filter.index_end;
+        }, &result.error);
+    }, [&](size_t i, chunk_output_t &result) {
+        if (!result.error.empty()) {
+            LOGE("chunk %zu: %s", selected[i], result.error.c_str());
+            failed = true;
+        }
+        decoded += result.decoded;
+        matched += result.matched;
+        if (fwrite(result.text.data(), 1, result.text.size(), out) != result.text.size()) {
+            LOGE("write failed: %s", strerror(errno));
+            return false;
+        }
+        return true;
+    });
+    if (out != stdout) {
+        fclose(out);
+    } else {
+        fflush(out);
+    }
+    if (verbose) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start).count();
+        LOGI("%s: %zu/%zu chunks, %llu instructions decoded, %llu matched, %u threads, %lld ms",
+             file_header.module_name, selected.size(), reader->get_chunks().size(),
+             static_cast<unsigned long long>(decoded), static_cast<unsigned long long>(matched),
+             threads, static_cast<long long>(elapsed));
+    }
+    return failed ? 2 : 0;
+}
@@ -0,0 +1,686 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * itrace-diff: finds where two binary traces of the same code part ways.
+ *
+ *   itrace-diff [-C context] [-n max_reports] [-v max_values] [-W window] [-A anchor]
+ *               [-a] [-p] [-V] a/itrace.bin b/itrace.bin
+ *
+ * Both traces are streamed and cut into basic blocks (an instruction that
+ * branches, calls or returns ends a block). Blocks are compared by a hash of
+ * their pc offsets from the module base, so the traces may come from runs with
+ * different load addresses. When the block streams differ, the first differing
+ * instruction is reported with context from both traces, and the streams are
+ * realigned on the nearest run of anchor equal blocks within window blocks of
+ * either side. While control flow matches, register and memory values are
+ * compared too and the first differences are reported operand by operand,
+ * after the control flow divergences. Values inside the traced module are
+ * compared as module offsets, so load addresses do not count as differences.
+ *
+ * Memory use is bounded by the window, not by the trace length.
+ *   -n  control flow divergences to report, the scan stops after them
+ *   -v  value differences to report, they never stop the scan
+ *   -a  compare memory access addresses as well, off by default since heap
+ *       and stack addresses rarely match between runs
+ *   -p  skip pointer like values, heap and stack pointers differ under ASLR
+ *   -V  only compare control flow
+ */
+
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+#include "common/chunk_prefetcher.h"
+#include "common/trace_reader.h"
+#include "common/trace_renderer.h"
+
+#define LOGI(fmt, ...) fprintf(stderr, "[I] " fmt "\n", ##__VA_ARGS__)
+#define LOGE(fmt, ...) fprintf(stderr, "[E] " fmt "\n", ##__VA_ARGS__)
+
+// a straight run longer than this is cut, so a block never grows unbounded
+static constexpr size_t kMaxBlockSize = 1024;
+
+typedef struct diff_options {
+    size_t context = 5;
+    size_t max_reports = 20;
+    size_t max_value_reports = 20;
+    size_t window = 4096;
+    size_t anchor = 4;
+    bool compare_addresses = false;
+    bool compare_values = true;
+    bool skip_pointers = false;
+} diff_options_t;
+
+typedef struct diff_inst {
+    uint64_t index;
+    uint64_t offset;
+    uint64_t value_hash;
+    bool block_end;
+} diff_inst_t;
+
+typedef struct diff_block {
+    uint64_t hash = 0;
+    uint64_t value_hash = 0;
+    std::vector<diff_inst_t> insts;
+} diff_block_t;
+
+typedef struct decoded_chunk {
+    std::vector<diff_inst_t> insts;
+    std::string error;
+} decoded_chunk_t;
+
+static inline uint64_t hash_mix(uint64_t hash, uint64_t value) {
+    // splitmix64 finalizer over the running hash
+    value += hash + 0x9e3779b97f4a7c15ull;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+    return value ^ (value >> 31);
+}
+
+static uint64_t hash_bytes(uint64_t hash, const uint8_t *data, size_t size) {
+    while (size >= sizeof(uint64_t)) {
+        uint64_t value;
+        memcpy(&value, data, sizeof(value));
+        hash = hash_mix(hash, value);
+        data += sizeof(value);
+        size -= sizeof(value);
+    }
+    if (size > 0) {
+        uint64_t value = 0;
+        memcpy(&value, data, size);
+        hash = hash_mix(hash, value);
+    }
+    return hash;
+}
+
+/**
+ * Turns a register or memory value into what is compared between the two
+ * traces: addresses in the traced module become offsets, pointer like values
+ * are dropped with -p. Everything else is compared as it is.
+ */
+class ValueNormalizer {
+public:
+    ValueNormalizer(const serialize_file_t &header, const diff_options_t &options)
+            : module_base(header.module_base), module_end(header.module_end),
+              is_64bit(header.is_64bit), skip_pointers(options.skip_pointers) {}
+
+    // false when the value is not compared at all
+    bool normalize(uint64_t &value) const {
+        if (value >= module_base && value < module_end) {
+            // tagged so an offset never equals a plain number
+            value = (value - module_base) ^ kModuleTag;
+            return true;
+        }
+        return !(skip_pointers && is_pointer_like(value));
+    }
+
+    // general registers as a number, false for registers compared byte for byte
+    static bool read_gpr(const trace_operand_desc_t &operand, const uint8_t *data, uint64_t &value) {
+        if (operand.kind != kOperandGpr || operand.size > sizeof(uint64_t)) {
+            return false;
+        }
+        value = 0;
+        memcpy(&value, data, operand.size);
+        return true;
+    }
+
+private:
+    [[nodiscard]] bool is_pointer_like(uint64_t value) const {
+        if (is_64bit) {
+            // user space of arm64 with the top byte tag of the heap ignored
+            value &= 0x00ffffffffffffffull;
+            return value >= (1ull << 32) && value < (1ull << 48);
+        }
+        // arm32 has no room to tell, above the first 128 MiB is taken as an address
+        return value >= 0x08000000ull && value < 0xffff0000ull;
+    }
+
+private:
+    static constexpr uint64_t kModuleTag = 0x6d6f64756c650000ull;
+    uint64_t module_base;
+    uint64_t module_end;
+    bool is_64bit;
+    bool skip_pointers;
+};
+
+static uint64_t hash_values(const trace_inst_view_t &inst, const ValueNormalizer &normalizer) {
+    uint64_t hash = 0;
+    for (size_t i = 0; i < inst.desc->desc->operand_count; ++i) {
+        const auto &operand = inst.desc->operands[i];
+        for (bool pre: {true, false}) {
+            auto data = trace_operand_value(inst, i, pre);
+            if (data == nullptr) {
+                continue;
+            }
+            uint64_t value;
+            if (!ValueNormalizer::read_gpr(operand, data, value)) {
+                // vector registers are compared byte for byte
+                hash = hash_bytes(hash, data, operand.size);
+            } else if (normalizer.normalize(value)) {
+                hash = hash_mix(hash, value);
+            }
+        }
+    }
+    return hash;
+}
+
+/**
+ * Sequential view of one trace as basic blocks. Chunks are inflated and
+ * reduced to pc offsets and value hashes on a prefetch thread.
+ */
+class BlockStream {
+public:
+    BlockStream(const TraceReader &reader, const diff_options_t &options)
+            : reader(reader), options(options), normalizer(reader.get_header(), options),
+              prefetcher(reader.get_chunks().size(), [this](size_t i, decoded_chunk_t &chunk) {
+                  decode_chunk(i, chunk);
+              }) {}
+
+    // buffers up to count blocks, returns how many are available
+    size_t fill(size_t count) {
+        while (blocks.size() < count && !at_end) {
+            read_block();
+        }
+        return blocks.size();
+    }
+
+    [[nodiscard]] const diff_block_t &at(size_t index) const {
+        return blocks[index];
+    }
+
+    void pop(size_t count) {
+        for (size_t i = 0; i < count && !blocks.empty(); ++i) {
+            blocks.pop_front();
+        }
+    }
+
+    [[nodiscard]] bool has_error() const {
+        return failed;
+    }
+
+private:
+    void decode_chunk(size_t index, decoded_chunk_t &chunk) {
+        thread_local TraceChunkDecoder decoder;
+        thread_local std::vector<uint8_t> raw;
+        if (!reader.read_chunk(index, raw, &chunk.error)) {
+            return;
+        }
+        const auto &header = reader.get_chunks()[index].header;
+        uint64_t module_base = reader.get_header().module_base;
+        chunk.insts.reserve(header.inst_count);
+        decoder.decode(header, raw.data(), raw.size(), [&](const trace_inst_view_t &inst) {
+            auto desc = inst.desc->desc;
+            diff_inst_t item{};
+            item.index = inst.index;
+            item.offset = desc->address - module_base;
+            item.block_end = (desc->flags & (kInstBranch | kInstCall | kInstReturn)) != 0 ||
+                             inst.call != nullptr;
+            if (options.compare_values) {
+                uint64_t hash = hash_values(inst, normalizer);
+                for (uint16_t i = 0; i < inst.access_count; ++i) {
+                    trace_memory_access_t ma;
+                    memcpy(&ma, inst.accesses + i, sizeof(ma));
+                    uint64_t value = ma.value;
+                    if (normalizer.normalize(value)) {
+                        hash = hash_mix(hash, value);
+                    }
+                    hash = hash_mix(hash, (static_cast<uint64_t>(ma.type) << 16) | ma.size);
+                    if (options.compare_addresses) {
+                        hash = hash_mix(hash, ma.flags & kAccessInModule ?
+                                              ma.address - module_base : ma.address);
+                    }
+                }
+                item.value_hash = hash;
+            }
+            chunk.insts.push_back(item);
+            return true;
+        }, &chunk.error);
+    }
+
+    bool next_inst(diff_inst_t &inst) {
+        while (position >= current.insts.size()) {
+            current.insts.clear();
+            if (!prefetcher.next(current)) {
+                return false;
+            }
+            if (!current.error.empty()) {
+                LOGE("%s", current.error.c_str());
+                failed = true;
+            }
+            position = 0;
+        }
+        inst = current.insts[position++];
+        return true;
+    }
+
+    void read_block() {
+        diff_block_t block;
+        diff_inst_t inst{};
+        while (next_inst(inst)) {
+            block.hash = hash_mix(block.hash, inst.offset);
+            block.value_hash = hash_mix(block.value_hash, inst.value_hash);
+            block.insts.push_back(inst);
+            if (inst.block_end || block.insts.size() >= kMaxBlockSize) {
+                break;
+            }
+        }
+        if (block.insts.empty()) {
+            at_end = true;
+            return;
+        }
+        blocks.push_back(std::move(block));
+    }
+
+private:
+    const TraceReader &reader;
+    const diff_options_t &options;
+    ValueNormalizer normalizer;
+    ChunkPrefetcher<decoded_chunk_t> prefetcher;
+    decoded_chunk_t current;
+    size_t position = 0;
+    std::deque<diff_block_t> blocks;
+    bool at_end = false;
+    bool failed = false;
+};
+
+/**
+ * Random access rendering for the few instructions around a report, reads the
+ * chunk holding each instruction again.
+ */
+class TracePrinter {
+public:
+    TracePrinter(const TraceReader &reader, const char *name)
+            : reader(reader), name(name), renderer(reader.get_header(), kRenderText) {}
+
+    void visit(uint64_t first, uint64_t last,
+               const std::function<void(const trace_inst_view_t &)> &callback) {
+        auto chunk_index = reader.find_chunk(first);
+        std::string error;
+        while (first < last && chunk_index < reader.get_chunks().size()) {
+            if (!reader.read_chunk(chunk_index, raw, &error)) {
+                LOGE("%s", error.c_str());
+                return;
+            }
+            const auto &header = reader.get_chunks()[chunk_index].header;
+            decoder.decode(header, raw.data(), raw.size(), [&](const trace_inst_view_t &inst) {
+                if (inst.index >= first && inst.index < last) {
+                    callback(inst);
+                }
+                return inst.index + 1 < last;
+            });
+            first = std::max(first, header.first_index + header.inst_count);
+            chunk_index++;
+        }
+    }
+
+    void print(uint64_t first, uint64_t last, uint64_t mark) {
+        std::string line;
+        visit(first, last, [&](const trace_inst_view_t &inst) {
+            line.clear();
+            renderer.render(line, inst);
+            printf("  %s%c%10" PRIu64 " %s", name, inst.index == mark ? '>' : ' ', inst.index,
+                   line.c_str());
+        });
+    }
+
+private:
+    const TraceReader &reader;
+    const char *name;
+    TraceRenderer renderer;
+    TraceChunkDecoder decoder;
+    std::vector<uint8_t> raw;
+};
+
+typedef struct operand_value {
+    std::string name;
+    std::string value;
+    // what the traces are compared on, value as printed otherwise
+    std::string key;
+} operand_value_t;
+
+static std::string value_key(const ValueNormalizer &normalizer, uint64_t value) {
+    if (!normalizer.normalize(value)) {
+        return "skipped";
+    }
+    std::string key;
+    TraceRenderer::append_hex(key, value);
+    return key;
+}
+
+static std::vector<operand_value_t> collect_values(TracePrinter &printer, uint64_t index,
+                                                   const serialize_file_t &header,
+                                                   const diff_options_t &options) {
+    std::vector<operand_value_t> values;
+    TraceRenderer renderer(header, kRenderText);
+    ValueNormalizer normalizer(header, options);
+    printer.visit(index, index + 1, [&](const trace_inst_view_t &inst) {
+        // render every operand and access alone, then compare the strings
+        for (size_t i = 0; i < inst.desc->desc->operand_count; ++i) {
+            const auto &operand = inst.desc->operands[i];
+            std::string name(operand.name, strnlen(operand.name, sizeof(operand.name)));
+            for (bool pre: {true, false}) {
+                auto value = trace_operand_value(inst, i, pre);
+                if (value == nullptr) {
+                    continue;
+                }
+                std::string text;
+                renderer.append_value(text, operand, value);
+                uint64_t number;
+                auto key = ValueNormalizer::read_gpr(operand, value, number) ?
+                           value_key(normalizer, number) : text;
+                values.push_back({pre ? name + " before" : name, text, key});
+            }
+        }
+        for (uint16_t i = 0; i < inst.access_count; ++i) {
+            trace_memory_access_t ma;
+            memcpy(&ma, inst.accesses + i, sizeof(ma));
+            std::string name = (ma.type == kAccessRead ? "read #" : "write #") + std::to_string(i);
+            std::string text;
+            TraceRenderer::append_hex(text, ma.value);
+            values.push_back({name + " value", text, value_key(normalizer, ma.value)});
+            if (options.compare_addresses) {
+                text.clear();
+                TraceRenderer::append_hex(text, ma.flags & kAccessInModule ?
+                                                ma.address - header.module_base : ma.address);
+                values.push_back({name + " address", text, text});
+            }
+        }
+    });
+    return values;
+}
+
+class TraceDiff {
+public:
+    TraceDiff(const TraceReader &reader_a, const TraceReader &reader_b,
+              const diff_options_t &options)
+            : options(options), stream_a(reader_a, options), stream_b(reader_b, options),
+              printer_a(reader_a, "a"), printer_b(reader_b, "b"),
+              header_a(reader_a.get_header()), header_b(reader_b.get_header()) {}
+
+    // returns the number of reports, 0 when the traces match
+    size_t run() {
+        while (reports < options.max_reports) {
+            size_t available_a = stream_a.fill(1);
+            size_t available_b = stream_b.fill(1);
+            if (available_a == 0 || available_b == 0) {
+                report_tail(available_a, available_b);
+                break;
+            }
+            const auto &a = stream_a.at(0);
+            const auto &b = stream_b.at(0);
+            if (a.hash == b.hash && a.insts.size() == b.insts.size()) {
+                if (options.compare_values && a.value_hash != b.value_hash) {
+                    record_values(a, b);
+                }
+                compared += a.insts.size();
+                stream_a.pop(1);
+                stream_b.pop(1);
+                continue;
+            }
+            report_divergence(a, b);
+            if (!resync()) {
+                break;
+            }
+        }
+        // control flow first, value differences are mostly noise next to a divergence
+        for (const auto &pending: pending_values) {
+            report_values(pending);
+        }
+        printf("compared %" PRIu64 " instructions, %zu control flow divergences, "
+               "%zu value differences", compared, divergences, value_differences);
+        if (value_differences > pending_values.size()) {
+            printf(", first %zu shown", pending_values.size());
+        }
+        printf("\n");
+        return reports + value_differences;
+    }
+
+    [[nodiscard]] bool has_error() const {
+        return stream_a.has_error() || stream_b.has_error();
+    }
+
+private:
+    void print_context(uint64_t index_a, uint64_t index_b) {
+        uint64_t context = options.context;
+        printer_a.print(index_a > context ? index_a - context : 0, index_a + context + 1, index_a);
+        printf("\n");
+        printer_b.print(index_b > context ? index_b - context : 0, index_b + context + 1, index_b);
+    }
+
+    // keeps the first differing instruction of the block, reported once the scan is done
+    void record_values(const diff_block_t &a, const diff_block_t &b) {
+        for (size_t i = 0; i < a.insts.size(); ++i) {
+            if (a.insts[i].value_hash == b.insts[i].value_hash) {
+                continue;
+            }
+            if (pending_values.size() < options.max_value_reports) {
+                pending_values.push_back({a.insts[i].index, b.insts[i].index, a.insts[i].offset});
+            }
+            value_differences++;
+            // one report per block, the rest of it is usually the same data flowing on
+            return;
+        }
+    }
+
+    typedef struct value_difference {
+        uint64_t index_a;
+        uint64_t index_b;
+        uint64_t offset;
+    } value_difference_t;
+
+    void report_values(const value_difference_t &difference) {
+        printf("\nvalue difference at a#%" PRIu64 " b#%" PRIu64 " offset %#" PRIx64 "\n",
+               difference.index_a, difference.index_b, difference.offset);
+        auto values_a = collect_values(printer_a, difference.index_a, header_a, options);
+        auto values_b = collect_values(printer_b, difference.index_b, header_b, options);
+        for (size_t j = 0; j < values_a.size() && j < values_b.size(); ++j) {
+            if (values_a[j].key != values_b[j].key) {
+                printf("  %-16s a=%s b=%s\n", values_a[j].name.c_str(),
+                       values_a[j].value.c_str(), values_b[j].value.c_str());
+            }
+        }
+        print_context(difference.index_a, difference.index_b);
+    }
+
+    void report_divergence(const diff_block_t &a, const diff_block_t &b) {
+        size_t common = 0;
+        while (common < a.insts.size() && common < b.insts.size() &&
+               a.insts[common].offset == b.insts[common].offset) {
+            common++;
+        }
+        // the instruction after the common prefix; a block end may fall on a chunk edge
+        uint64_t index_a = common < a.insts.size() ? a.insts[common].index :
+                           a.insts.back().index + 1;
+        uint64_t index_b = common < b.insts.size() ? b.insts[common].index :
+                           b.insts.back().index + 1;
+        printf("\ncontrol flow divergence at a#%" PRIu64 " b#%" PRIu64, index_a, index_b);
+        if (common > 0) {
+            printf(", last common instruction at offset %#" PRIx64, a.insts[common - 1].offset);
+        }
+        printf("\n");
+        print_context(index_a, index_b);
+        compared += common;
+        divergences++;
+        reports++;
+    }
+
+    void report_tail(size_t available_a, size_t available_b) {
+        if (available_a == available_b) {
+            return;
+        }
+        auto &longer = available_a != 0 ? stream_a : stream_b;
+        const auto &block = longer.at(0);
+        printf("\ntrace %s continues after the other one ended at %s#%" PRIu64 "\n",
+               available_a != 0 ? "a" : "b", available_a != 0 ? "a" : "b",
+               block.insts.front().index);
+        reports++;
+    }
+
+    uint64_t anchor_hash(BlockStream &stream, size_t start) {
+        uint64_t hash = 0;
+        for (size_t i = 0; i < options.anchor; ++i) {
+            hash = hash_mix(hash, stream.at(start + i).hash);
+        }
+        return hash;
+    }
+
+    /**
+     * Realigns on the nearest position (smallest skip on both sides together)
+     * where anchor blocks in a row agree, looking window blocks ahead.
+     */
+    bool resync() {
+        size_t size_a = stream_a.fill(options.window + options.anchor);
+        size_t size_b = stream_b.fill(options.window + options.anchor);
+        if (size_a < options.anchor || size_b < options.anchor) {
+            // near the end, compare what is left block by block
+            return false;
+        }
+        std::unordered_map<uint64_t, size_t> positions_b;
+        for (size_t j = 0; j + options.anchor <= size_b; ++j) {
+            positions_b.emplace(anchor_hash(stream_b, j), j);
+        }
+        size_t best_a = SIZE_MAX;
+        size_t best_b = SIZE_MAX;
+        for (size_t i = 0; i + options.anchor <= size_a; ++i) {
+            if (best_a != SIZE_MAX && i >= best_a + best_b) {
+                break;
+            }
+            auto it = positions_b.find(anchor_hash(stream_a, i));
+            if (it == positions_b.end() || (i == 0 && it->second == 0)) {
+                continue;
+            }
+            if (best_a == SIZE_MAX || i + it->second < best_a + best_b) {
+                best_a = i;
+                best_b = it->second;
+            }
+        }
+        if (best_a == SIZE_MAX) {
+            printf("no realignment within %zu blocks, stopping\n", options.window);
+            return false;
+        }
+        uint64_t skipped_a = 0;
+        uint64_t skipped_b = 0;
+        for (size_t i = 0; i < best_a; ++i) {
+            skipped_a += stream_a.at(i).insts.size();
+        }
+        for (size_t j = 0; j < best_b; ++j) {
+            skipped_b += stream_b.at(j).insts.size();
+        }
+        printf("realigned at a#%" PRIu64 " b#%" PRIu64 " after %" PRIu64 " / %" PRIu64
+               " instructions\n", stream_a.at(best_a).insts.front().index,
+               stream_b.at(best_b).insts.front().index, skipped_a, skipped_b);
+        stream_a.pop(best_a);
+        stream_b.pop(best_b);
+        return true;
+    }
+
+private:
+    const diff_options_t &options;
+    BlockStream stream_a;
+    BlockStream stream_b;
+    TracePrinter printer_a;
+    TracePrinter printer_b;
+    const serialize_file_t &header_a;
+    const serialize_file_t &header_b;
+    uint64_t compared = 0;
+    size_t divergences = 0;
+    size_t value_differences = 0;
+    std::vector<value_difference_t> pending_values;
+    // control flow divergences and a trace ending early, bounded by max_reports
+    size_t reports = 0;
+};
+
+static void usage(const char *name) {
+    fprintf(stderr, "usage: %s [-C context] [-n max_reports] [-v max_values] [-W window] [-A anchor]\n"
+                    "          [-a] [-p] [-V] a/itrace.bin b/itrace.bin\n", name);
+}
+
+int main(int argc, char **argv) {
+    diff_options_t options;
+    int opt;
+    while ((opt = getopt(argc, argv, "C:n:v:W:A:apVh")) != -1) {
+        switch (opt) {
+            case 'C':
+                options.context = strtoul(optarg, nullptr, 0);
+                break;
+            case 'n':
+                options.max_reports = strtoul(optarg, nullptr, 0);
+                break;
+            case 'v':
+                options.max_value_reports = strtoul(optarg, nullptr, 0);
+                break;
+            case 'W':
+                options.window = std::max<size_t>(1, strtoul(optarg, nullptr, 0));
+                break;
+            case 'A':
+                options.anchor = std::max<size_t>(1, strtoul(optarg, nullptr, 0));
+                break;
+            case 'a':
+                options.compare_addresses = true;
+                break;
+            case 'p':
+                options.skip_pointers = true;
+                break;
+            case 'V':
+                options.compare_values = false;
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (optind != argc - 2) {
+        usage(argv[0]);
+        return 1;
+    }
+    std::string error;
+    auto reader_a = TraceReader::open(argv[optind], &error);
+    if (reader_a == nullptr) {
+        LOGE("%s: %s", argv[optind], error.c_str());
+        return 1;
+    }
+    auto reader_b = TraceReader::open(argv[optind + 1], &error);
+    if (reader_b == nullptr) {
+        LOGE("%s: %s", argv[optind + 1], error.c_str());
+        return 1;
+    }
+    if (strncmp(reader_a->get_header().module_name, reader_b->get_header().module_name,
+                sizeof(reader_a->get_header().module_name)) != 0) {
+        LOGI("comparing traces of different modules: %s and %s",
+             reader_a->get_header().module_name, reader_b->get_header().module_name);
+    }
+    TraceDiff diff(*reader_a, *reader_b, options);
+    size_t reports = diff.run();
+    if (diff.has_error()) {
+        return 2;
+    }
+    return reports == 0 ? 0 : 1;
+}
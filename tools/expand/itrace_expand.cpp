@@ -0,0 +1,629 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * itrace-expand: turns a branch only trace back into a regular one.
+ *
+ *   itrace-expand [-v] branch.bin itrace.bin
+ *
+ * The tracer left out every instruction that simply followed the previous
+ * one, see trace_flow_record_t. They are walked again through the module
+ * image stored in the trace, so the output lists every instruction with its
+ * opcode, the reads from outside the module and the svc results, and all
+ * other tools work on it. The keyframe opening every flow chunk is passed on
+ * to the first instruction of that chunk, so the full register state is
+ * known there. Nothing here executes the instructions, in between the output
+ * has no operand values; kTraceExpanded tells itrace-state and itrace-slice.
+ * Instruction numbers are kept, chunks the tracer dropped stay a gap.
+ */
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include "common/trace_reader.h"
+
+#define LOGI(fmt, ...) fprintf(stderr, "[I] " fmt "\n", ##__VA_ARGS__)
+#define LOGE(fmt, ...) fprintf(stderr, "[E] " fmt "\n", ##__VA_ARGS__)
+
+// instructions per output chunk, about the size the tracer seals at
+static constexpr uint32_t kOutputChunkInsts = 8192;
+
+static bool read_varint(const uint8_t *&cursor, const uint8_t *end, uint64_t &value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && cursor < end; shift += 7) {
+        uint8_t byte = *cursor++;
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static inline int64_t unzigzag(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+/**
+ * Executable bytes of the module by offset, adjacent pieces are merged so an
+ * instruction never straddles two entries.
+ */
+class ModuleImage {
+public:
+    void add(uint64_t offset, const uint8_t *data, uint32_t size) {
+        auto it = pieces.upper_bound(offset);
+        if (it != pieces.begin()) {
+            auto prev = std::prev(it);
+            if (prev->first + prev->second.size() == offset) {
+                prev->second.insert(prev->second.end(), data, data + size);
+                return;
+            }
+        }
+        pieces[offset].assign(data, data + size);
+    }
+
+    [[nodiscard]] bool empty() const {
+        return pieces.empty();
+    }
+
+    // nullptr when the size bytes at offset were not captured
+    [[nodiscard]] const uint8_t *get(uint64_t offset, uint32_t size) const {
+        auto it = pieces.upper_bound(offset);
+        if (it == pieces.begin()) {
+            return nullptr;
+        }
+        --it;
+        if (offset - it->first + size > it->second.size()) {
+            return nullptr;
+        }
+        return it->second.data() + (offset - it->first);
+    }
+
+private:
+    std::map<uint64_t, std::vector<uint8_t>> pieces;
+};
+
+typedef struct expanded_inst {
+    uint64_t offset = 0;
+    bool thumb = false;
+    bool has_svc = false;
+    uint64_t svc_value = 0;
+    std::vector<trace_memory_access_t> reads;
+} expanded_inst_t;
+
+typedef struct desc_entry {
+    uint32_t desc_id;
+    uint32_t inst_size;
+    uint64_t chunk_seq;
+    std::string disassembly;
+} desc_entry_t;
+
+/**
+ * Re-encodes the walked instructions in the regular record format, one
+ * descriptor per pc, emitted again in every chunk that uses it.
+ */
+class ExpandedWriter {
+public:
+    ExpandedWriter(FILE *out, const serialize_file_t &source) : out(out), header(source) {
+        header.flags &= ~kTraceBranchOnly;
+        header.flags |= kTraceExpanded;
+        header.memory_enable = true;
+        header.inst_count = 0;
+        header.inst_offset = sizeof(serialize_file_t);
+    }
+
+    bool begin() {
+        return fwrite(&header, sizeof(header), 1, out) == 1;
+    }
+
+    // the instructions added next carry on from first_index, the index of the source chunk
+    bool begin_chunk(uint64_t first_index) {
+        if (first_index != next_index && chunk_inst_count != 0 && !seal_chunk()) {
+            return false;
+        }
+        // a gap stays a gap, chunks the tracer dropped are not renumbered away
+        next_index = first_index;
+        return true;
+    }
+
+    // body of a kRecordKeyframe, goes out with the next instruction added
+    void set_keyframe(const uint8_t *body, size_t size) {
+        keyframe.assign(body, body + size);
+    }
+
+    bool add(const expanded_inst_t &inst, const uint8_t *code, uint32_t size) {
+        // a keyframe opens its chunk, the state rebuild only looks there
+        if (!keyframe.empty() && chunk_inst_count != 0 && !seal_chunk()) {
+            return false;
+        }
+        auto &desc = get_desc(inst, code, size);
+        if (desc.chunk_seq != chunk_seq) {
+            write_desc(desc, inst.offset);
+            desc.chunk_seq = chunk_seq;
+        }
+        if (!keyframe.empty()) {
+            write_keyframe();
+        }
+        auto access_count = static_cast<uint16_t>(inst.reads.size());
+        auto cursor = begin_record(kRecordInst, trace_align8(sizeof(trace_inst_record_t)) +
+                                                access_count * sizeof(trace_memory_access_t));
+        trace_inst_record_t record{};
+        record.desc_id = desc.desc_id;
+        record.access_count = access_count;
+        memcpy(cursor, &record, sizeof(record));
+        memcpy(cursor + trace_align8(sizeof(record)), inst.reads.data(),
+               access_count * sizeof(trace_memory_access_t));
+        if (inst.has_svc) {
+            write_svc(inst.svc_value);
+        }
+        chunk_inst_count++;
+        next_index++;
+        header.inst_count++;
+        if (chunk_inst_count >= kOutputChunkInsts) {
+            return seal_chunk();
+        }
+        return true;
+    }
+
+    bool finish() {
+        if (!seal_chunk()) {
+            return false;
+        }
+        return fseek(out, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, out) == 1 &&
+               fflush(out) == 0;
+    }
+
+    [[nodiscard]] uint64_t get_inst_count() const {
+        return header.inst_count;
+    }
+
+private:
+    desc_entry_t &get_desc(const expanded_inst_t &inst, const uint8_t *code, uint32_t size) {
+        // the thumb bit keeps arm and thumb decodings of one address apart
+        uint64_t key = inst.offset << 1 | inst.thumb;
+        auto it = descs.find(key);
+        if (it != descs.end()) {
+            return it->second;
+        }
+        desc_entry_t desc{};
+        desc.desc_id = static_cast<uint32_t>(descs.size());
+        desc.inst_size = size;
+        char text[32];
+        if (size == 2) {
+            uint16_t half;
+            memcpy(&half, code, sizeof(half));
+            snprintf(text, sizeof(text), ".inst.n 0x%04x", half);
+        } else if (inst.thumb) {
+            uint16_t first, second;
+            memcpy(&first, code, sizeof(first));
+            memcpy(&second, code + 2, sizeof(second));
+            snprintf(text, sizeof(text), ".inst.w 0x%04x%04x", first, second);
+        } else {
+            uint32_t word;
+            memcpy(&word, code, sizeof(word));
+            snprintf(text, sizeof(text), ".inst 0x%08x", word);
+        }
+        desc.disassembly = text;
+        return descs.emplace(key, std::move(desc)).first->second;
+    }
+
+    uint8_t *begin_record(trace_record_type_t type, uint32_t size) {
+        size = trace_align8(size + sizeof(trace_record_header_t));
+        size_t offset = chunk.size();
+        chunk.resize(offset + size);
+        trace_record_header_t record{};
+        record.type = type;
+        record.size = size;
+        memcpy(chunk.data() + offset, &record, sizeof(record));
+        chunk_record_count++;
+        return chunk.data() + offset + sizeof(record);
+    }
+
+    void write_desc(const desc_entry_t &desc, uint64_t offset) {
+        static const char kMnemonic[] = ".inst";
+        uint8_t mnemonic_size = sizeof(kMnemonic) - 1;
+        auto cursor = begin_record(kRecordInstDesc, sizeof(trace_inst_desc_t) + mnemonic_size +
+                                                    desc.disassembly.size());
+        trace_inst_desc_t record{};
+        record.desc_id = desc.desc_id;
+        record.inst_size = desc.inst_size;
+        record.address = header.module_base + offset;
+        record.mnemonic_size = mnemonic_size;
+        record.disassembly_size = desc.disassembly.size();
+        memcpy(cursor, &record, sizeof(record));
+        cursor += sizeof(record);
+        memcpy(cursor, kMnemonic, mnemonic_size);
+        memcpy(cursor + mnemonic_size, desc.disassembly.data(), desc.disassembly.size());
+    }
+
+    void write_keyframe() {
+        auto cursor = begin_record(kRecordKeyframe, keyframe.size());
+        trace_keyframe_record_t record;
+        memcpy(&record, keyframe.data(), sizeof(record));
+        record.inst_index = next_index;
+        memcpy(cursor, &record, sizeof(record));
+        memcpy(cursor + sizeof(record), keyframe.data() + sizeof(record),
+               keyframe.size() - sizeof(record));
+        keyframe.clear();
+    }
+
+    void write_svc(uint64_t value) {
+        static const char kName[] = "svc";
+        char text[24];
+        int text_size = snprintf(text, sizeof(text), "0x%llx",
+                                 static_cast<unsigned long long>(value));
+        uint16_t module_size = 0;
+        uint16_t name_size = sizeof(kName) - 1;
+        uint16_t ret_size = text_size;
+        auto cursor = begin_record(kRecordCall, sizeof(trace_call_record_t) + 3 * sizeof(uint16_t) +
+                                                name_size + ret_size);
+        trace_call_record_t record{};
+        record.is_svc = 1;
+        memcpy(cursor, &record, sizeof(record));
+        cursor += sizeof(record);
+        memcpy(cursor, &module_size, sizeof(module_size));
+        cursor += sizeof(module_size);
+        memcpy(cursor, &name_size, sizeof(name_size));
+        memcpy(cursor + sizeof(name_size), kName, name_size);
+        cursor += sizeof(name_size) + name_size;
+        memcpy(cursor, &ret_size, sizeof(ret_size));
+        memcpy(cursor + sizeof(ret_size), text, ret_size);
+    }
+
+    bool seal_chunk() {
+        if (chunk.empty()) {
+            return true;
+        }
+        trace_chunk_header_t chunk_header{};
+        chunk_header.stored_size = chunk.size();
+        chunk_header.raw_size = chunk.size();
+        chunk_header.first_index = next_index - chunk_inst_count;
+        chunk_header.inst_count = chunk_inst_count;
+        chunk_header.record_count = chunk_record_count;
+        bool ok = fwrite(&chunk_header, sizeof(chunk_header), 1, out) == 1 &&
+                  fwrite(chunk.data(), 1, chunk.size(), out) == chunk.size();
+        chunk.clear();
+        chunk_seq++;
+        chunk_inst_count = 0;
+        chunk_record_count = 0;
+        return ok;
+    }
+
+private:
+    FILE *out;
+    serialize_file_t header;
+    std::map<uint64_t, desc_entry_t> descs;
+    std::vector<uint8_t> chunk;
+    std::vector<uint8_t> keyframe;
+    // index of the next instruction added
+    uint64_t next_index = 0;
+    uint64_t chunk_seq = 1;
+    uint32_t chunk_inst_count = 0;
+    uint32_t chunk_record_count = 0;
+};
+
+/**
+ * Walks one kRecordFlow: instructions follow each other through the module
+ * image until an event moves the current position.
+ */
+class FlowExpander {
+public:
+    FlowExpander(const ModuleImage &image, bool is_64bit, ExpandedWriter &writer) :
+            image(image), is_64bit(is_64bit), writer(writer) {}
+
+    bool expand(const trace_flow_record_t &record, const uint8_t *events, std::string &error) {
+        current = expanded_inst_t{};
+        current.offset = record.start_offset;
+        current.thumb = record.thumb != 0;
+        jump = false;
+        remaining = record.inst_count;
+        auto cursor = events;
+        auto end = events + record.event_size;
+        while (cursor < end) {
+            uint64_t head;
+            if (!read_varint(cursor, end, head)) {
+                error = "truncated flow event";
+                return false;
+            }
+            for (uint64_t skip = head >> 2; skip > 0; --skip) {
+                if (!step(error)) {
+                    return false;
+                }
+            }
+            if (remaining == 0) {
+                error = "flow event past the last instruction";
+                return false;
+            }
+            uint64_t value;
+            switch (head & 3) {
+                case kFlowJump:
+                    if (!read_varint(cursor, end, value)) {
+                        error = "truncated jump event";
+                        return false;
+                    }
+                    jump = true;
+                    jump_offset = current.offset + unzigzag(value >> 1);
+                    jump_thumb = value & 1;
+                    break;
+                case kFlowRead: {
+                    trace_memory_access_t access{};
+                    uint64_t size;
+                    if (!read_varint(cursor, end, size) ||
+                        !read_varint(cursor, end, access.address) ||
+                        !read_varint(cursor, end, access.value)) {
+                        error = "truncated read event";
+                        return false;
+                    }
+                    access.size = size;
+                    access.type = kAccessRead;
+                    current.reads.push_back(access);
+                    break;
+                }
+                case kFlowSvc:
+                    if (!read_varint(cursor, end, current.svc_value)) {
+                        error = "truncated svc event";
+                        return false;
+                    }
+                    current.has_svc = true;
+                    break;
+                default:
+                    error = "unknown flow event " + std::to_string(head & 3);
+                    return false;
+            }
+        }
+        while (remaining > 0) {
+            if (!step(error)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    // writes the current instruction and moves to the one executed after it
+    bool step(std::string &error) {
+        if (remaining == 0) {
+            error = "flow skips past the last instruction";
+            return false;
+        }
+        uint32_t size = 4;
+        auto code = image.get(current.offset, 2);
+        if (code != nullptr && current.thumb) {
+            uint16_t half;
+            memcpy(&half, code, sizeof(half));
+            // 0b11101, 0b11110 and 0b11111 open a 32 bit thumb instruction
+            size = half >= 0xe800 ? 4 : 2;
+        }
+        code = image.get(current.offset, size);
+        if (code == nullptr) {
+            char text[64];
+            snprintf(text, sizeof(text), "offset 0x%llx is not in the module image",
+                     static_cast<unsigned long long>(current.offset));
+            error = text;
+            return false;
+        }
+        if (!writer.add(current, code, size)) {
+            error = std::string("write output: ") + strerror(errno);
+            return false;
+        }
+        uint64_t next = current.offset + size;
+        bool thumb = current.thumb;
+        if (jump) {
+            next = jump_offset;
+            thumb = jump_thumb && !is_64bit;
+            jump = false;
+        }
+        current = expanded_inst_t{};
+        current.offset = next;
+        current.thumb = thumb;
+        remaining--;
+        return true;
+    }
+
+private:
+    const ModuleImage &image;
+    bool is_64bit;
+    ExpandedWriter &writer;
+    expanded_inst_t current;
+    bool jump = false;
+    uint64_t jump_offset = 0;
+    bool jump_thumb = false;
+    uint32_t remaining = 0;
+};
+
+// calls callback(type, body, body_size) for every record of a chunk payload
+template<typename Callback>
+static bool for_each_record(const std::vector<uint8_t> &raw, Callback callback,
+                            std::string &error) {
+    size_t offset = 0;
+    while (offset + sizeof(trace_record_header_t) <= raw.size()) {
+        trace_record_header_t record;
+        memcpy(&record, raw.data() + offset, sizeof(record));
+        if (record.size < sizeof(record) || record.size > raw.size() - offset) {
+            error = "bad record size at chunk offset " + std::to_string(offset);
+            return false;
+        }
+        if (!callback(record.type, raw.data() + offset + sizeof(record),
+                      record.size - sizeof(record))) {
+            return false;
+        }
+        offset += record.size;
+    }
+    return true;
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "usage: %s [-v] branch.bin itrace.bin\n", name);
+}
+
+int main(int argc, char **argv) {
+    bool verbose = false;
+    int opt;
+    while ((opt = getopt(argc, argv, "vh")) != -1) {
+        switch (opt) {
+            case 'v':
+                verbose = true;
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (argc - optind != 2) {
+        usage(argv[0]);
+        return 1;
+    }
+    std::string error;
+    auto reader = TraceReader::open(argv[optind], &error, kTraceBranchOnly);
+    if (reader == nullptr) {
+        LOGE("%s", error.c_str());
+        return 1;
+    }
+    const auto &file_header = reader->get_header();
+    if (!(file_header.flags & kTraceBranchOnly)) {
+        LOGE("%s is not a branch only trace", argv[optind]);
+        return 1;
+    }
+    auto start = std::chrono::steady_clock::now();
+    const auto &chunks = reader->get_chunks();
+    std::vector<uint8_t> raw;
+    ModuleImage image;
+    // the image chunks are the ones without instructions
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        if (chunks[i].header.inst_count != 0) {
+            continue;
+        }
+        if (!reader->read_chunk(i, raw, &error)) {
+            LOGE("%s", error.c_str());
+            return 2;
+        }
+        bool ok = for_each_record(raw, [&](uint8_t type, const uint8_t *body, size_t size) {
+            if (type != kRecordModuleImage) {
+                return true;
+            }
+            trace_module_image_record_t record;
+            if (size < sizeof(record)) {
+                error = "truncated module image";
+                return false;
+            }
+            memcpy(&record, body, sizeof(record));
+            if (record.size > size - sizeof(record)) {
+                error = "truncated module image";
+                return false;
+            }
+            image.add(record.offset, body + sizeof(record), record.size);
+            return true;
+        }, error);
+        if (!ok) {
+            LOGE("chunk %zu: %s", i, error.c_str());
+            return 2;
+        }
+    }
+    if (image.empty()) {
+        LOGE("%s holds no module image", argv[optind]);
+        return 2;
+    }
+
+    FILE *out = fopen(argv[optind + 1], "wb");
+    if (out == nullptr) {
+        LOGE("open %s failed: %s", argv[optind + 1], strerror(errno));
+        return 1;
+    }
+    ExpandedWriter writer(out, file_header);
+    FlowExpander expander(image, file_header.is_64bit, writer);
+    int result = 0;
+    if (!writer.begin()) {
+        LOGE("write %s failed: %s", argv[optind + 1], strerror(errno));
+        result = 2;
+    }
+    for (size_t i = 0; i < chunks.size() && result == 0; ++i) {
+        if (chunks[i].header.inst_count == 0) {
+            continue;
+        }
+        if (!reader->read_chunk(i, raw, &error)) {
+            LOGE("%s", error.c_str());
+            result = 2;
+            break;
+        }
+        if (!writer.begin_chunk(chunks[i].header.first_index)) {
+            LOGE("write %s failed: %s", argv[optind + 1], strerror(errno));
+            result = 2;
+            break;
+        }
+        bool ok = for_each_record(raw, [&](uint8_t type, const uint8_t *body, size_t size) {
+            if (type == kRecordKeyframe) {
+                trace_keyframe_record_t record;
+                if (size < sizeof(record)) {
+                    error = "truncated keyframe";
+                    return false;
+                }
+                memcpy(&record, body, sizeof(record));
+                if (size - sizeof(record) < static_cast<size_t>(record.gpr_size) + record.fpr_size) {
+                    error = "truncated keyframe";
+                    return false;
+                }
+                writer.set_keyframe(body, sizeof(record) + record.gpr_size + record.fpr_size);
+                return true;
+            }
+            if (type != kRecordFlow) {
+                return true;
+            }
+            trace_flow_record_t record;
+            if (size < sizeof(record)) {
+                error = "truncated flow record";
+                return false;
+            }
+            memcpy(&record, body, sizeof(record));
+            if (record.event_size > size - sizeof(record)) {
+                error = "truncated flow record";
+                return false;
+            }
+            return expander.expand(record, body + sizeof(record), error);
+        }, error);
+        if (!ok) {
+            LOGE("chunk %zu: %s", i, error.c_str());
+            result = 2;
+        }
+    }
+    if (!writer.finish() && result == 0) {
+        LOGE("write %s failed: %s", argv[optind + 1], strerror(errno));
+        result = 2;
+    }
+    fclose(out);
+    if (verbose) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start).count();
+        LOGI("%llu instructions expanded in %lld ms",
+             static_cast<unsigned long long>(writer.get_inst_count()),
+             static_cast<long long>(elapsed));
+    }
+    return result;
+}
@@ -0,0 +1,299 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * itrace-memdump: renders memory_dump.bin as the text hexdump the tracer
+ * used to write itself.
+ *
+ *   itrace-memdump [-f] [-o output] memory_dump.bin
+ *
+ * Every dumped block prints as
+ *   memory block index:0x.. size:0x.. address:0x..
+ *   <hexdump>
+ * in the order the tracer dumped them. Blocks with the same contents share
+ * one stored copy, see kRecordMemoryBlob.
+ *
+ * Versions taken by set_memory_snapshot print as
+ *   memory block index:0x.. version:0x.. phase:0x.. size:0x.. address:0x..
+ *   <hexdump of the lines written since the previous version>
+ * or with -f the whole block, rebuilt from version 0 and the changes since.
+ */
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+#include "common/trace_reader.h"
+
+#define LOGI(fmt, ...) fprintf(stderr, "[I] " fmt "\n", ##__VA_ARGS__)
+#define LOGE(fmt, ...) fprintf(stderr, "[E] " fmt "\n", ##__VA_ARGS__)
+
+typedef struct blob_ref {
+    size_t chunk_index;
+    // offset of the bytes in the inflated chunk
+    size_t offset;
+    size_t size;
+} blob_ref_t;
+
+/**
+ * Same layout as HexDump of the tracer: 16 bytes a line, the address of the
+ * line as wide as a pointer of the traced process, the first line indented
+ * when the block does not start on a 16 byte boundary.
+ */
+static void append_hexdump(std::string &out, const uint8_t *data, size_t size, uint64_t address,
+                           bool is_64bit) {
+    static const char kHexDigit[] = "0123456789abcdef";
+    int digits = is_64bit ? 16 : 8;
+    size_t gap = address & 0x0f;
+    while (size > 0) {
+        uint64_t line_address = address & ~0x0full;
+        std::string hex(digits + 1 + 16 * 3, ' ');
+        std::string ascii(16, ' ');
+        for (int i = 0; i < digits; ++i) {
+            hex[i] = kHexDigit[(line_address >> ((digits - 1 - i) * 4)) & 0x0f];
+        }
+        hex[digits] = ':';
+        size_t count = std::min<size_t>(size, 16 - gap);
+        for (size_t i = gap; i < gap + count; ++i) {
+            uint8_t byte = *data++;
+            hex[digits + 2 + i * 3] = kHexDigit[byte >> 4];
+            hex[digits + 3 + i * 3] = kHexDigit[byte & 0x0f];
+            ascii[i] = byte >= 0x20 && byte < 0x7f ? static_cast<char>(byte) : '.';
+        }
+        out += hex;
+        out += "  ";
+        out += ascii;
+        gap = 0;
+        size -= count;
+        address += count;
+        if (size > 0) {
+            out += '\n';
+        }
+    }
+}
+
+typedef struct block_versions {
+    uint32_t next_version = 0;
+    // whole block as of the last version, only kept for -f
+    std::vector<uint8_t> contents;
+} block_versions_t;
+
+static void usage(const char *name) {
+    fprintf(stderr, "usage: %s [-f] [-o output] memory_dump.bin\n", name);
+}
+
+int main(int argc, char **argv) {
+    std::string output_path;
+    bool full_versions = false;
+    int opt;
+    while ((opt = getopt(argc, argv, "fo:h")) != -1) {
+        switch (opt) {
+            case 'f':
+                full_versions = true;
+                break;
+            case 'o':
+                output_path = optarg;
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (argc - optind != 1) {
+        usage(argv[0]);
+        return 1;
+    }
+    std::string error;
+    auto reader = TraceReader::open(argv[optind], &error, kTraceMemoryDump);
+    if (reader == nullptr) {
+        LOGE("%s", error.c_str());
+        return 1;
+    }
+    const auto &file_header = reader->get_header();
+    if (!(file_header.flags & kTraceMemoryDump)) {
+        LOGE("%s is not a memory dump", argv[optind]);
+        return 1;
+    }
+    if (!reader->is_complete()) {
+        LOGI("%s ends in a partial chunk, rendering the complete ones", argv[optind]);
+    }
+    FILE *out = stdout;
+    if (!output_path.empty()) {
+        out = fopen(output_path.c_str(), "w");
+        if (out == nullptr) {
+            LOGE("open %s failed: %s", output_path.c_str(), strerror(errno));
+            return 1;
+        }
+    }
+
+    // blobs live in the chunk that first needed them, older chunks are read again
+    std::unordered_map<uint64_t, blob_ref_t> blobs;
+    std::unordered_map<uint64_t, block_versions_t> versions;
+    std::vector<uint8_t> raw;
+    std::vector<uint8_t> other;
+    size_t other_index = SIZE_MAX;
+    std::string text;
+    int result = 0;
+    const auto &chunks = reader->get_chunks();
+    for (size_t chunk_index = 0; chunk_index < chunks.size() && result == 0; ++chunk_index) {
+        if (!reader->read_chunk(chunk_index, raw, &error)) {
+            LOGE("%s", error.c_str());
+            result = 2;
+            break;
+        }
+        size_t offset = 0;
+        while (offset + sizeof(trace_record_header_t) <= raw.size()) {
+            trace_record_header_t record;
+            memcpy(&record, raw.data() + offset, sizeof(record));
+            if (record.size < sizeof(record) || record.size > raw.size() - offset) {
+                LOGE("chunk %zu: bad record size at offset %zu", chunk_index, offset);
+                result = 2;
+                break;
+            }
+            size_t body = offset + sizeof(record);
+            size_t body_size = record.size - sizeof(record);
+            offset += record.size;
+            if (record.type == kRecordMemoryBlob && body_size >= sizeof(trace_memory_blob_record_t)) {
+                trace_memory_blob_record_t blob;
+                memcpy(&blob, raw.data() + body, sizeof(blob));
+                if (blob.size <= body_size - sizeof(blob)) {
+                    blobs.emplace(blob.hash, blob_ref_t{chunk_index, body + sizeof(blob), blob.size});
+                }
+                continue;
+            }
+            if (record.type == kRecordMemoryVersion &&
+                body_size >= sizeof(trace_memory_version_record_t)) {
+                trace_memory_version_record_t version;
+                memcpy(&version, raw.data() + body, sizeof(version));
+                size_t runs_size = static_cast<size_t>(version.run_count) * sizeof(trace_memory_run_t);
+                if (runs_size > body_size - sizeof(version)) {
+                    LOGE("chunk %zu: bad memory version record", chunk_index);
+                    result = 2;
+                    break;
+                }
+                std::vector<trace_memory_run_t> runs(version.run_count);
+                memcpy(runs.data(), raw.data() + body + sizeof(version), runs_size);
+                size_t bytes_offset = body + sizeof(version) + runs_size;
+                size_t bytes_end = body + body_size;
+                auto &state = versions[version.block_index];
+                if (version.version != state.next_version) {
+                    LOGI("memory block 0x%llx: versions 0x%x to 0x%x are missing",
+                         static_cast<unsigned long long>(version.block_index), state.next_version,
+                         version.version - 1);
+                }
+                state.next_version = version.version + 1;
+                if (full_versions && state.contents.size() != version.size) {
+                    state.contents.assign(version.size, 0);
+                }
+                char line[160];
+                snprintf(line, sizeof(line),
+                         "memory block index:0x%llx version:0x%x phase:0x%llx size:0x%llx address:0x%llx\n",
+                         static_cast<unsigned long long>(version.block_index), version.version,
+                         static_cast<unsigned long long>(version.phase),
+                         static_cast<unsigned long long>(version.size),
+                         static_cast<unsigned long long>(version.address));
+                text = line;
+                bool bad = false;
+                for (const auto &run: runs) {
+                    if (run.size > bytes_end - bytes_offset ||
+                        static_cast<uint64_t>(run.offset) + run.size > version.size) {
+                        bad = true;
+                        break;
+                    }
+                    if (full_versions) {
+                        memcpy(state.contents.data() + run.offset, raw.data() + bytes_offset,
+                               run.size);
+                    } else {
+                        append_hexdump(text, raw.data() + bytes_offset, run.size,
+                                       version.address + run.offset, file_header.is_64bit);
+                        text += "\n";
+                    }
+                    bytes_offset += run.size;
+                }
+                if (bad) {
+                    LOGE("chunk %zu: bad memory version record", chunk_index);
+                    result = 2;
+                    break;
+                }
+                if (full_versions) {
+                    append_hexdump(text, state.contents.data(), state.contents.size(),
+                                   version.address, file_header.is_64bit);
+                    text += "\n";
+                }
+                fwrite(text.data(), 1, text.size(), out);
+                continue;
+            }
+            if (record.type != kRecordMemoryBlock ||
+                body_size < sizeof(trace_memory_block_record_t)) {
+                continue;
+            }
+            trace_memory_block_record_t block;
+            memcpy(&block, raw.data() + body, sizeof(block));
+            char line[128];
+            snprintf(line, sizeof(line), "memory block index:0x%llx size:0x%llx address:0x%llx\n",
+                     static_cast<unsigned long long>(block.block_index),
+                     static_cast<unsigned long long>(block.size),
+                     static_cast<unsigned long long>(block.address));
+            text = line;
+            auto it = blobs.find(block.hash);
+            if (it != blobs.end() && it->second.size != block.size) {
+                LOGE("block %llu is %llu bytes, its contents %llu",
+                     static_cast<unsigned long long>(block.block_index),
+                     static_cast<unsigned long long>(block.size),
+                     static_cast<unsigned long long>(it->second.size));
+                result = 2;
+                break;
+            }
+            const uint8_t *bytes = nullptr;
+            if (it != blobs.end() && it->second.chunk_index == chunk_index) {
+                bytes = raw.data() + it->second.offset;
+            } else if (it != blobs.end()) {
+                if (other_index != it->second.chunk_index) {
+                    if (!reader->read_chunk(it->second.chunk_index, other, &error)) {
+                        LOGE("%s", error.c_str());
+                        result = 2;
+                        break;
+                    }
+                    other_index = it->second.chunk_index;
+                }
+                bytes = other.data() + it->second.offset;
+            }
+            if (bytes != nullptr) {
+                append_hexdump(text, bytes, block.size, block.address, file_header.is_64bit);
+            } else {
+                // the chunk holding the bytes was dropped by the tracer
+                text += "<contents lost>";
+            }
+            text += "\n";
+            fwrite(text.data(), 1, text.size(), out);
+        }
+    }
+    if (out != stdout) {
+        fclose(out);
+    }
+    return result;
+}
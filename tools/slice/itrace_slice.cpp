@@ -0,0 +1,558 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * itrace-slice: answers "where did this value come from" with a backward
+ * data flow slice of a binary trace.
+ *
+ *   itrace-slice -i index [-r register | -m address[:size]] [-M memory_mb]
+ *                [-T tmp_dir] [-o output] [-n] [-v] itrace.bin
+ *
+ * The criterion is instruction index itself, or with -r / -m the value the
+ * register or memory bytes held when it ran. The output is every instruction
+ * the value depends on, in trace order, as itrace.txt lines with the
+ * instruction number as first column (-n prints the numbers only).
+ *
+ * The trace is streamed once up to the criterion. A last writer index maps
+ * every register and memory byte to the instruction that wrote it last; the
+ * register slots live in an array, memory in a ShadowMemory bounded by -M.
+ * Each instruction resolves its reads (read registers, loaded bytes) to their
+ * writers, and these def-use edges go to a dependency log on disk. The slice
+ * then walks the log backwards from the criterion with a max heap, reading
+ * only the entries of contributing instructions.
+ *
+ * Calls to functions outside the traced module are not traced; an
+ * instruction with a call record is taken to read the argument registers
+ * and write the return registers.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <queue>
+#include <string>
+#include <unistd.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "common/chunk_prefetcher.h"
+#include "common/shadow_memory.h"
+#include "common/trace_reader.h"
+#include "common/trace_renderer.h"
+
+#define LOGI(fmt, ...) fprintf(stderr, "[I] " fmt "\n", ##__VA_ARGS__)
+#define LOGE(fmt, ...) fprintf(stderr, "[E] " fmt "\n", ##__VA_ARGS__)
+
+// register keys: general purpose slots first, then 16 byte vector slots
+static constexpr uint32_t kGprKeys = 64;
+static constexpr uint32_t kFprKeys = 64;
+static constexpr uint32_t kRegKeys = kGprKeys + kFprKeys;
+static constexpr uint64_t kNoWriter = UINT64_MAX;
+// registers carrying arguments and return values on arm64 / arm32
+static constexpr uint32_t kArgRegs64 = 8;
+static constexpr uint32_t kArgRegs32 = 4;
+static constexpr size_t kLogBufferSize = 1024 * 1024;
+
+typedef struct slice_access {
+    uint64_t address;
+    uint32_t size;
+    bool write;
+} slice_access_t;
+
+/**
+ * What the last writer index needs of an instruction: register keys read
+ * and written, memory accesses, call boundary.
+ */
+typedef struct slice_inst {
+    uint64_t index;
+    uint32_t first_use;
+    uint32_t use_count;
+    uint32_t first_def;
+    uint32_t def_count;
+    uint32_t first_access;
+    uint32_t access_count;
+    uint16_t call_args;
+    bool is_call;
+} slice_inst_t;
+
+typedef struct slice_chunk {
+    std::vector<slice_inst_t> insts;
+    std::vector<uint8_t> keys;
+    std::vector<slice_access_t> accesses;
+    // register names seen for the first time, with their key
+    std::vector<std::pair<std::string, uint8_t>> registers;
+    std::string error;
+} slice_chunk_t;
+
+static bool parse_u64(const char *str, uint64_t &value) {
+    char *end = nullptr;
+    errno = 0;
+    value = strtoull(str, &end, 0);
+    return errno == 0 && end != str && *end == 0;
+}
+
+static std::string to_lower(std::string str) {
+    std::transform(str.begin(), str.end(), str.begin(),
+                   [](unsigned char c) { return static_cast<char>(tolower(c)); });
+    return str;
+}
+
+static int operand_key(const trace_operand_desc_t &operand) {
+    if (operand.size == 0) {
+        return -1;
+    }
+    uint32_t key;
+    if (operand.kind == kOperandGpr) {
+        key = operand.state_offset / operand.size;
+        if (key >= kGprKeys) {
+            return -1;
+        }
+    } else {
+        // S, D and Q views of one vector register share a key
+        key = kGprKeys + operand.state_offset / 16;
+        if (key >= kRegKeys) {
+            return -1;
+        }
+    }
+    return static_cast<int>(key);
+}
+
+static void reduce_chunk(const TraceReader &reader, size_t index, uint64_t last_index,
+                         slice_chunk_t &chunk, std::unordered_set<std::string> &seen_registers) {
+    thread_local TraceChunkDecoder decoder;
+    thread_local std::vector<uint8_t> raw;
+    if (!reader.read_chunk(index, raw, &chunk.error)) {
+        return;
+    }
+    const auto &header = reader.get_chunks()[index].header;
+    chunk.insts.reserve(header.inst_count);
+    decoder.decode(header, raw.data(), raw.size(), [&](const trace_inst_view_t &inst) {
+        const auto &desc = *inst.desc;
+        slice_inst_t item{};
+        item.index = inst.index;
+        item.first_use = static_cast<uint32_t>(chunk.keys.size());
+        for (size_t i = 0; i < desc.desc->operand_count; ++i) {
+            auto key = operand_key(desc.operands[i]);
+            if (key >= 0 && (desc.operands[i].flags & kOperandRead)) {
+                chunk.keys.push_back(static_cast<uint8_t>(key));
+            }
+        }
+        item.use_count = static_cast<uint32_t>(chunk.keys.size()) - item.first_use;
+        item.first_def = static_cast<uint32_t>(chunk.keys.size());
+        for (size_t i = 0; i < desc.desc->operand_count; ++i) {
+            const auto &operand = desc.operands[i];
+            auto key = operand_key(operand);
+            if (key < 0) {
+                continue;
+            }
+            if (operand.flags & kOperandWrite) {
+                chunk.keys.push_back(static_cast<uint8_t>(key));
+            }
+            std::string name(operand.name, strnlen(operand.name, sizeof(operand.name)));
+            if (seen_registers.insert(name).second) {
+                chunk.registers.emplace_back(name, static_cast<uint8_t>(key));
+            }
+        }
+        item.def_count = static_cast<uint32_t>(chunk.keys.size()) - item.first_def;
+        item.first_access = static_cast<uint32_t>(chunk.accesses.size());
+        for (uint16_t i = 0; i < inst.access_count; ++i) {
+            trace_memory_access_t ma;
+            memcpy(&ma, inst.accesses + i, sizeof(ma));
+            chunk.accesses.push_back({ma.address, ma.size, ma.type == kAccessWrite});
+        }
+        item.access_count = inst.access_count;
+        if (inst.call != nullptr) {
+            item.is_call = true;
+            item.call_args = static_cast<uint16_t>(inst.call->record->arg_count +
+                                                   inst.call->record->raw_arg_count);
+        }
+        chunk.insts.push_back(item);
+        return inst.index < last_index;
+    }, &chunk.error);
+}
+
+/**
+ * Def-use edges of every instruction, appended in trace order. The log holds
+ * a count and the writers of each instruction, the offset file one log
+ * position per instruction number.
+ */
+class DependencyLog {
+public:
+    ~DependencyLog() {
+        if (log_file != nullptr) {
+            fclose(log_file);
+        }
+        if (offset_file != nullptr) {
+            fclose(offset_file);
+        }
+    }
+
+    bool open(const std::string &dir, std::string *error) {
+        return open_temp(dir, log_file, error) && open_temp(dir, offset_file, error);
+    }
+
+    bool append(uint64_t index, const std::vector<uint64_t> &writers) {
+        // instruction numbers missing from a damaged trace get an empty entry
+        while (next_index <= index) {
+            if (fwrite(&position, sizeof(position), 1, offset_file) != 1) {
+                return false;
+            }
+            auto count = static_cast<uint32_t>(next_index == index ? writers.size() : 0);
+            if (fwrite(&count, sizeof(count), 1, log_file) != 1 ||
+                fwrite(writers.data(), sizeof(uint64_t), count, log_file) != count) {
+                return false;
+            }
+            position += sizeof(count) + count * sizeof(uint64_t);
+            next_index++;
+        }
+        return true;
+    }
+
+    // makes the log readable, no append after this
+    bool seal() {
+        return fflush(log_file) == 0 && fflush(offset_file) == 0;
+    }
+
+    bool read(uint64_t index, std::vector<uint64_t> &writers) const {
+        writers.clear();
+        if (index >= next_index) {
+            return false;
+        }
+        uint64_t offset;
+        uint32_t count;
+        if (pread(fileno(offset_file), &offset, sizeof(offset),
+                  static_cast<off_t>(index * sizeof(offset))) != sizeof(offset) ||
+            pread(fileno(log_file), &count, sizeof(count), static_cast<off_t>(offset)) !=
+            sizeof(count)) {
+            return false;
+        }
+        writers.resize(count);
+        auto size = static_cast<ssize_t>(count * sizeof(uint64_t));
+        return pread(fileno(log_file), writers.data(), size,
+                     static_cast<off_t>(offset + sizeof(count))) == size;
+    }
+
+    [[nodiscard]] uint64_t get_size() const {
+        return position;
+    }
+
+private:
+    bool open_temp(const std::string &dir, FILE *&file, std::string *error) {
+        std::string path = dir + "/itrace-slice-XXXXXX";
+        int fd = mkstemp(&path[0]);
+        if (fd < 0) {
+            *error = "create " + path + ": " + strerror(errno);
+            return false;
+        }
+        unlink(path.c_str());
+        file = fdopen(fd, "w+");
+        buffers.emplace_back(kLogBufferSize);
+        setvbuf(file, buffers.back().data(), _IOFBF, kLogBufferSize);
+        return true;
+    }
+
+private:
+    FILE *log_file = nullptr;
+    FILE *offset_file = nullptr;
+    uint64_t position = 0;
+    uint64_t next_index = 0;
+    std::vector<std::vector<char>> buffers;
+};
+
+static void usage(const char *name) {
+    fprintf(stderr,
+            "usage: %s -i index [-r register | -m address[:size]] [-M memory_mb]\n"
+            "          [-T tmp_dir] [-o output] [-n] [-v] itrace.bin\n", name);
+}
+
+int main(int argc, char **argv) {
+    uint64_t target = UINT64_MAX;
+    std::string register_name;
+    bool has_memory = false;
+    uint64_t memory_address = 0;
+    uint64_t memory_size = 1;
+    uint64_t memory_mb = 512;
+    std::string tmp_dir = "/tmp";
+    std::string output_path;
+    bool indices_only = false;
+    bool verbose = false;
+    int opt;
+    while ((opt = getopt(argc, argv, "i:r:m:M:T:o:nvh")) != -1) {
+        switch (opt) {
+            case 'i':
+                if (!parse_u64(optarg, target)) {
+                    LOGE("bad instruction number %s", optarg);
+                    return 1;
+                }
+                break;
+            case 'r':
+                register_name = to_lower(optarg);
+                break;
+            case 'm': {
+                has_memory = true;
+                std::string arg = optarg;
+                auto pos = arg.find(':');
+                if (!parse_u64(arg.substr(0, pos).c_str(), memory_address) ||
+                    (pos != std::string::npos &&
+                     !parse_u64(arg.substr(pos + 1).c_str(), memory_size)) ||
+                    memory_size == 0 || memory_size > UINT32_MAX) {
+                    LOGE("bad memory criterion %s", optarg);
+                    return 1;
+                }
+                break;
+            }
+            case 'M':
+                if (!parse_u64(optarg, memory_mb) || memory_mb == 0) {
+                    LOGE("bad memory budget %s", optarg);
+                    return 1;
+                }
+                break;
+            case 'T':
+                tmp_dir = optarg;
+                break;
+            case 'o':
+                output_path = optarg;
+                break;
+            case 'n':
+                indices_only = true;
+                break;
+            case 'v':
+                verbose = true;
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (optind != argc - 1 || target == UINT64_MAX || (!register_name.empty() && has_memory)) {
+        usage(argv[0]);
+        return 1;
+    }
+    std::string error;
+    auto reader = TraceReader::open(argv[optind], &error);
+    if (reader == nullptr) {
+        LOGE("%s", error.c_str());
+        return 1;
+    }
+    if (reader->get_header().flags & kTraceExpanded) {
+        LOGE("%s was expanded from a branch only trace, it records no register use to slice on",
+             argv[optind]);
+        return 1;
+    }
+    auto last_chunk = reader->find_chunk(target);
+    if (last_chunk >= reader->get_chunks().size()) {
+        LOGE("instruction %llu is not in the trace", static_cast<unsigned long long>(target));
+        return 1;
+    }
+    DependencyLog log;
+    if (!log.open(tmp_dir, &error)) {
+        LOGE("%s", error.c_str());
+        return 1;
+    }
+    FILE *out = stdout;
+    if (!output_path.empty()) {
+        out = fopen(output_path.c_str(), "w");
+        if (out == nullptr) {
+            LOGE("open %s failed: %s", output_path.c_str(), strerror(errno));
+            return 1;
+        }
+    }
+
+    // forward pass: last writer index and dependency log up to the criterion
+    auto start = std::chrono::steady_clock::now();
+    auto arg_regs = reader->get_header().is_64bit ? kArgRegs64 : kArgRegs32;
+    std::vector<uint64_t> reg_writer(kRegKeys, kNoWriter);
+    ShadowMemory memory(memory_mb * 1024 * 1024 / (ShadowMemory::kPageSize * sizeof(uint64_t)));
+    memory.set_swap_dir(tmp_dir);
+    std::unordered_map<std::string, uint8_t> registers;
+    std::vector<uint64_t> seeds;
+    std::vector<uint64_t> writers;
+    bool failed = false;
+    bool reached = false;
+    std::unordered_set<std::string> seen_registers;
+    ChunkPrefetcher<slice_chunk_t> prefetcher(last_chunk + 1, [&](size_t i, slice_chunk_t &chunk) {
+        reduce_chunk(*reader, i, target, chunk, seen_registers);
+    });
+    slice_chunk_t chunk;
+    while (!reached && prefetcher.next(chunk)) {
+        if (!chunk.error.empty()) {
+            LOGE("%s", chunk.error.c_str());
+            failed = true;
+        }
+        for (const auto &item: chunk.registers) {
+            registers.emplace(to_lower(item.first), item.second);
+        }
+        for (const auto &inst: chunk.insts) {
+            writers.clear();
+            for (uint32_t i = 0; i < inst.use_count; ++i) {
+                auto writer = reg_writer[chunk.keys[inst.first_use + i]];
+                if (writer != kNoWriter) {
+                    writers.push_back(writer);
+                }
+            }
+            if (inst.is_call) {
+                for (uint32_t slot = 0; slot < std::min<uint32_t>(inst.call_args, arg_regs); ++slot) {
+                    if (reg_writer[slot] != kNoWriter) {
+                        writers.push_back(reg_writer[slot]);
+                    }
+                }
+            }
+            for (uint32_t i = 0; i < inst.access_count; ++i) {
+                const auto &access = chunk.accesses[inst.first_access + i];
+                if (!access.write) {
+                    memory.load(access.address, access.size, writers);
+                }
+            }
+            if (inst.index == target) {
+                // the criterion reads the state before the instruction, like its own operands
+                if (!register_name.empty()) {
+                    auto it = registers.find(register_name);
+                    if (it == registers.end()) {
+                        LOGE("the trace has no register %s", register_name.c_str());
+                        return 1;
+                    }
+                    if (reg_writer[it->second] != kNoWriter) {
+                        seeds.push_back(reg_writer[it->second]);
+                    }
+                } else if (has_memory) {
+                    memory.load(memory_address, static_cast<uint32_t>(memory_size), seeds);
+                } else {
+                    seeds.push_back(target);
+                }
+            }
+            std::sort(writers.begin(), writers.end());
+            writers.erase(std::unique(writers.begin(), writers.end()), writers.end());
+            if (!log.append(inst.index, writers)) {
+                LOGE("write dependency log failed: %s", strerror(errno));
+                return 2;
+            }
+            if (inst.index == target) {
+                reached = true;
+                break;
+            }
+            for (uint32_t i = 0; i < inst.def_count; ++i) {
+                reg_writer[chunk.keys[inst.first_def + i]] = inst.index;
+            }
+            if (inst.is_call) {
+                // x0/x1 or r0/r1 hold the return value
+                reg_writer[0] = reg_writer[1] = inst.index;
+            }
+            for (uint32_t i = 0; i < inst.access_count; ++i) {
+                const auto &access = chunk.accesses[inst.first_access + i];
+                if (access.write) {
+                    memory.store(access.address, access.size, inst.index);
+                }
+            }
+        }
+    }
+    if (!reached) {
+        LOGE("instruction %llu was not decoded", static_cast<unsigned long long>(target));
+        return 2;
+    }
+    if (!memory.get_error().empty()) {
+        LOGE("%s", memory.get_error().c_str());
+        failed = true;
+    }
+    if (!log.seal()) {
+        LOGE("flush dependency log failed: %s", strerror(errno));
+        return 2;
+    }
+    auto forward_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start).count();
+
+    // backward pass: writers always precede readers, so a max heap pops every
+    // contributing instruction once, in decreasing order
+    std::priority_queue<uint64_t> pending(seeds.begin(), seeds.end());
+    std::vector<uint64_t> slice;
+    while (!pending.empty()) {
+        auto index = pending.top();
+        pending.pop();
+        if (!slice.empty() && slice.back() == index) {
+            continue;
+        }
+        slice.push_back(index);
+        if (!log.read(index, writers)) {
+            LOGE("read dependency log failed at %llu", static_cast<unsigned long long>(index));
+            return 2;
+        }
+        for (auto writer: writers) {
+            pending.push(writer);
+        }
+    }
+    std::reverse(slice.begin(), slice.end());
+
+    if (indices_only) {
+        for (auto index: slice) {
+            fprintf(out, "%llu\n", static_cast<unsigned long long>(index));
+        }
+    } else {
+        TraceRenderer renderer(reader->get_header(), kRenderText);
+        TraceChunkDecoder decoder;
+        std::vector<uint8_t> raw;
+        std::string text;
+        size_t next = 0;
+        while (next < slice.size()) {
+            auto chunk_index = reader->find_chunk(slice[next]);
+            if (!reader->read_chunk(chunk_index, raw, &error)) {
+                LOGE("%s", error.c_str());
+                return 2;
+            }
+            const auto &header = reader->get_chunks()[chunk_index].header;
+            text.clear();
+            decoder.decode(header, raw.data(), raw.size(), [&](const trace_inst_view_t &inst) {
+                if (inst.index == slice[next]) {
+                    // the number as one more column, the line opens with the separator
+                    text += '|';
+                    text += std::to_string(inst.index);
+                    renderer.render(text, inst);
+                    ++next;
+                }
+                return next < slice.size() &&
+                       slice[next] < header.first_index + header.inst_count;
+            });
+            fwrite(text.data(), 1, text.size(), out);
+        }
+    }
+    if (out != stdout) {
+        fclose(out);
+    } else {
+        fflush(out);
+    }
+    if (verbose) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start).count();
+        LOGI("%s: %zu instructions in the slice of %llu, forward %lld ms, total %lld ms",
+             reader->get_header().module_name, slice.size(),
+             static_cast<unsigned long long>(target), static_cast<long long>(forward_ms),
+             static_cast<long long>(elapsed));
+        LOGI("dependency log %llu KB, %zu shadow pages, %llu swapped out",
+             static_cast<unsigned long long>(log.get_size() / 1024), memory.get_page_count(),
+             static_cast<unsigned long long>(memory.get_swap_outs()));
+    }
+    return failed ? 2 : 0;
+}
@@ -0,0 +1,185 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * itrace-state: prints every register before an instruction ran.
+ *
+ *   itrace-state [-v] itrace.bin index [index...]
+ *
+ * The state comes from the closest keyframe before the instruction plus the
+ * operand values recorded since, see TraceStateRebuilder. Bytes no keyframe
+ * or operand covered, in traces written without keyframes, print as ?.
+ */
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include "common/trace_state.h"
+
+#define LOGI(fmt, ...) fprintf(stderr, "[I] " fmt "\n", ##__VA_ARGS__)
+#define LOGE(fmt, ...) fprintf(stderr, "[E] " fmt "\n", ##__VA_ARGS__)
+
+// GPRState layout of QBDI, fields past these are bookkeeping of the vm
+static const char *const kGprNames64[] = {
+        "x0", "x1", "x2", "x3", "x4", "x5", "x6", "x7", "x8", "x9", "x10", "x11", "x12",
+        "x13", "x14", "x15", "x16", "x17", "x18", "x19", "x20", "x21", "x22", "x23", "x24",
+        "x25", "x26", "x27", "x28", "fp", "lr", "sp", "nzcv", "pc",
+};
+static const char *const kGprNames32[] = {
+        "r0", "r1", "r2", "r3", "r4", "r5", "r6", "r7", "r8", "r9", "r10", "r11", "r12",
+        "sp", "lr", "pc", "cpsr",
+};
+
+static bool parse_u64(const char *str, uint64_t &value) {
+    char *end = nullptr;
+    errno = 0;
+    value = strtoull(str, &end, 0);
+    return errno == 0 && end != str && *end == 0;
+}
+
+// little endian register of size bytes at offset, ? when any byte is unknown
+static std::string format_register(const std::vector<uint8_t> &bytes,
+                                   const std::vector<uint8_t> &known, size_t offset,
+                                   size_t size) {
+    if (offset + size > bytes.size()) {
+        return "?";
+    }
+    for (size_t i = 0; i < size; ++i) {
+        if (!known[offset + i]) {
+            return "?";
+        }
+    }
+    std::string out = "0x";
+    char hex[3];
+    bool leading = true;
+    for (size_t i = size; i-- > 0;) {
+        auto byte = bytes[offset + i];
+        if (leading && byte == 0 && i != 0) {
+            continue;
+        }
+        snprintf(hex, sizeof(hex), leading ? "%x" : "%02x", byte);
+        out += hex;
+        leading = false;
+    }
+    return out;
+}
+
+static void print_state(const trace_register_state_t &state, bool is_64bit) {
+    size_t word = is_64bit ? 8 : 4;
+    printf("instruction %llu pc 0x%llx", static_cast<unsigned long long>(state.index),
+           static_cast<unsigned long long>(state.address));
+    if (state.keyframe_index != UINT64_MAX) {
+        printf(", keyframe %llu + %llu replayed\n",
+               static_cast<unsigned long long>(state.keyframe_index),
+               static_cast<unsigned long long>(state.replayed));
+    } else {
+        printf(", no keyframe, %llu replayed\n", static_cast<unsigned long long>(state.replayed));
+    }
+    const char *const *names = is_64bit ? kGprNames64 : kGprNames32;
+    size_t count = is_64bit ? sizeof(kGprNames64) / sizeof(kGprNames64[0]) :
+                   sizeof(kGprNames32) / sizeof(kGprNames32[0]);
+    for (size_t i = 0; i < count; ++i) {
+        if (strcmp(names[i], "pc") == 0) {
+            // the pc slot is stale after the keyframe, the instruction address is not
+            printf("%-5s 0x%llx\n", names[i], static_cast<unsigned long long>(state.address));
+            continue;
+        }
+        printf("%-5s %s\n", names[i],
+               format_register(state.gpr, state.gpr_known, i * word, word).c_str());
+    }
+    // v0-v31 on arm64, d0-d31 on arm, the fp control registers follow
+    size_t vector_size = is_64bit ? 16 : 8;
+    for (size_t i = 0; i < 32; ++i) {
+        printf("%s%-4zu %s\n", is_64bit ? "v" : "d", i,
+               format_register(state.fpr, state.fpr_known, i * vector_size, vector_size).c_str());
+    }
+    if (is_64bit) {
+        printf("fpcr  %s\n", format_register(state.fpr, state.fpr_known, 32 * 16, word).c_str());
+        printf("fpsr  %s\n",
+               format_register(state.fpr, state.fpr_known, 32 * 16 + word, word).c_str());
+    } else {
+        printf("fpscr %s\n", format_register(state.fpr, state.fpr_known, 32 * 8, word).c_str());
+    }
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "usage: %s [-v] itrace.bin index [index...]\n", name);
+}
+
+int main(int argc, char **argv) {
+    bool verbose = false;
+    int opt;
+    while ((opt = getopt(argc, argv, "vh")) != -1) {
+        switch (opt) {
+            case 'v':
+                verbose = true;
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (argc - optind < 2) {
+        usage(argv[0]);
+        return 1;
+    }
+    std::string error;
+    auto reader = TraceReader::open(argv[optind], &error);
+    if (reader == nullptr) {
+        LOGE("%s", error.c_str());
+        return 1;
+    }
+    TraceStateRebuilder rebuilder(*reader);
+    trace_register_state_t state;
+    int result = 0;
+    for (int i = optind + 1; i < argc; ++i) {
+        uint64_t index;
+        if (!parse_u64(argv[i], index)) {
+            LOGE("bad instruction number %s", argv[i]);
+            return 1;
+        }
+        auto start = std::chrono::steady_clock::now();
+        if (!rebuilder.rebuild(index, state, &error)) {
+            LOGE("%s", error.c_str());
+            result = 2;
+            continue;
+        }
+        if (i > optind + 1) {
+            printf("\n");
+        }
+        print_state(state, reader->get_header().is_64bit);
+        if (verbose) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+            LOGI("instruction %llu rebuilt in %lld us", static_cast<unsigned long long>(index),
+                 static_cast<long long>(elapsed));
+        }
+    }
+    return result;
+}
@@ -0,0 +1,295 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2024 g2wfw
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <dlfcn.h>
+#include <sys/mman.h>
+#include <vector>
+#include <QBDI.h>
+#include "allocation_tracker.h"
+#include "core/hook_manager.h"
+
+#define LOG_TAG "QBDI"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#define LOGD(...) __android_log_print(ANDROID_LOG_DEBUG, LOG_TAG, __VA_ARGS__)
+
+// bionic exports, malloc_iterate must run between malloc_disable and malloc_enable
+static int (*malloc_iterate_fun)(uintptr_t base, size_t size,
+                                 void (*callback)(uintptr_t base, size_t size, void *arg),
+                                 void *arg) = nullptr;
+static void (*malloc_disable_fun)() = nullptr;
+static void (*malloc_enable_fun)() = nullptr;
+
+void *NodePool::allocate(size_t size) {
+    if (node_size == 0) {
+        node_size = (size + 15) & ~static_cast<size_t>(15);
+    }
+    if (size > node_size) {
+        return nullptr;
+    }
+    if (free_list != nullptr) {
+        auto node = free_list;
+        free_list = *static_cast<void **>(node);
+        return node;
+    }
+    if (slab_left < node_size) {
+        auto memory = mmap(nullptr, kSlabSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+                           -1, 0);
+        if (memory == MAP_FAILED) {
+            return nullptr;
+        }
+        // slabs are never returned, the pool lives as long as the process
+        slab = static_cast<uint8_t *>(memory);
+        slab_left = kSlabSize;
+    }
+    auto node = slab;
+    slab += node_size;
+    slab_left -= node_size;
+    return node;
+}
+
+void NodePool::deallocate(void *node) {
+    *static_cast<void **>(node) = free_list;
+    free_list = node;
+}
+
+HOOK_DEF_STATIC(void *, malloc, size_t size) {
+    auto ptr = hook_malloc_orig(size);
+    AllocationTracker::getInstance()->on_alloc(ptr, size);
+    return ptr;
+}
+
+HOOK_DEF_STATIC(void *, calloc, size_t count, size_t size) {
+    auto ptr = hook_calloc_orig(count, size);
+    // the product did not overflow when the allocation succeeded
+    AllocationTracker::getInstance()->on_alloc(ptr, count * size);
+    return ptr;
+}
+
+HOOK_DEF_STATIC(void *, realloc, void *ptr, size_t size) {
+    auto tracker = AllocationTracker::getInstance();
+    tracked_allocation_t old{};
+    bool known = false;
+    if (ptr != nullptr) {
+        known = tracker->find(reinterpret_cast<uintptr_t>(ptr), old) &&
+                old.start == reinterpret_cast<uintptr_t>(ptr);
+        // dropped first, another thread may get the address as soon as realloc returns
+        tracker->on_free(ptr);
+    }
+    auto result = hook_realloc_orig(ptr, size);
+    if (result != nullptr) {
+        tracker->on_alloc(result, size);
+    } else if (known && size != 0) {
+        // failed, the old block is still live
+        tracker->on_alloc(ptr, old.size);
+    }
+    return result;
+}
+
+HOOK_DEF_STATIC(void *, memalign, size_t alignment, size_t size) {
+    auto ptr = hook_memalign_orig(alignment, size);
+    AllocationTracker::getInstance()->on_alloc(ptr, size);
+    return ptr;
+}
+
+HOOK_DEF_STATIC(int, posix_memalign, void **memptr, size_t alignment, size_t size) {
+    auto result = hook_posix_memalign_orig(memptr, alignment, size);
+    if (result == 0) {
+        AllocationTracker::getInstance()->on_alloc(*memptr, size);
+    }
+    return result;
+}
+
+HOOK_DEF_STATIC(void, free, void *ptr) {
+    AllocationTracker::getInstance()->on_free(ptr);
+    hook_free_orig(ptr);
+}
+
+bool AllocationTracker::install_hooks() {
+    void *handler = dlopen("libc.so", RTLD_NOW);
+    if (handler == nullptr) {
+        LOGE("dlopen libc.so failed: %s", dlerror());
+        return false;
+    }
+    struct {
+        const char *name;
+        void *stub;
+        void **orig;
+    } hooks[] = {
+            {"malloc",         (void *) &hook_malloc_stub,         (void **) &hook_malloc_orig},
+            {"calloc",         (void *) &hook_calloc_stub,         (void **) &hook_calloc_orig},
+            {"realloc",        (void *) &hook_realloc_stub,        (void **) &hook_realloc_orig},
+            {"memalign",       (void *) &hook_memalign_stub,       (void **) &hook_memalign_orig},
+            {"posix_memalign", (void *) &hook_posix_memalign_stub, (void **) &hook_posix_memalign_orig},
+            {"free",           (void *) &hook_free_stub,           (void **) &hook_free_orig},
+    };
+    bool result = true;
+    for (const auto &hook: hooks) {
+        auto addr = dlsym(handler, hook.name);
+        if (addr == nullptr ||
+            !stl::HookManager::getInstance()->inline_hook(addr, hook.stub, hook.orig)) {
+            // a missing allocation hook only leaves blocks unknown, a missing free leaves stale ones
+            LOGE("hook %s failed", hook.name);
+            result = false;
+        }
+    }
+    malloc_iterate_fun = reinterpret_cast<decltype(malloc_iterate_fun)>(
+            dlsym(handler, "malloc_iterate"));
+    malloc_disable_fun = reinterpret_cast<decltype(malloc_disable_fun)>(
+            dlsym(handler, "malloc_disable"));
+    malloc_enable_fun = reinterpret_cast<decltype(malloc_enable_fun)>(
+            dlsym(handler, "malloc_enable"));
+    dlclose(handler);
+    return result;
+}
+
+static bool is_heap_mapping(const std::string &name) {
+    // jemalloc names its mappings libc_malloc too
+    return name.rfind("[anon:libc_malloc", 0) == 0 || name.rfind("[anon:scudo:", 0) == 0;
+}
+
+static void seed_block(uintptr_t base, size_t size, void *arg) {
+    // called with the allocator locked, on_alloc takes its nodes from mmap
+    static_cast<AllocationTracker *>(arg)->on_alloc(reinterpret_cast<void *>(base), size);
+}
+
+void AllocationTracker::seed_live_blocks() {
+    if (malloc_iterate_fun == nullptr || malloc_disable_fun == nullptr ||
+        malloc_enable_fun == nullptr) {
+        LOGW("malloc_iterate not found, blocks allocated before the tracker stay unknown");
+        return;
+    }
+    // everything that allocates happens before the allocator is locked
+    std::vector<std::pair<uintptr_t, size_t>> heaps;
+    for (const auto &map: QBDI::getCurrentProcessMaps(false)) {
+        if (is_heap_mapping(map.name)) {
+            heaps.emplace_back(map.range.start(), map.range.size());
+        }
+    }
+    malloc_disable_fun();
+    for (const auto &[base, size]: heaps) {
+        malloc_iterate_fun(base, size, seed_block, this);
+    }
+    malloc_enable_fun();
+    LOGI("allocation tracker seeded from %zu heap mappings", heaps.size());
+}
+
+bool AllocationTracker::set_enable(bool enable) {
+    if (!enable) {
+        recording.store(false);
+        // frees are no longer seen, whatever is indexed would go stale
+        for (auto &shard: shards) {
+            std::lock_guard<std::mutex> guard(shard.lock);
+            shard.blocks.clear();
+        }
+        std::lock_guard<std::mutex> guard(large_shard.lock);
+        large_shard.blocks.clear();
+        return true;
+    }
+    if (!hooked) {
+        if (!install_hooks()) {
+            return false;
+        }
+        hooked = true;
+        LOGI("allocation tracker hooks installed");
+    }
+    // blocks allocated from here on are hooked, the ones before come from the heap walk
+    recording.store(true);
+    seed_live_blocks();
+    return true;
+}
+
+AllocationTracker::shard_t &AllocationTracker::get_shard(uintptr_t start, size_t size) {
+    if (size > (static_cast<size_t>(1) << kRegionBits)) {
+        return large_shard;
+    }
+    return shards[(start >> kRegionBits) % kShardCount];
+}
+
+void AllocationTracker::on_alloc(void *ptr, size_t size) {
+    if (ptr == nullptr || size == 0 || !is_enabled()) {
+        return;
+    }
+    auto start = reinterpret_cast<uintptr_t>(ptr);
+    auto &shard = get_shard(start, size);
+    std::lock_guard<std::mutex> guard(shard.lock);
+    auto &blocks = shard.blocks;
+    // blocks a missed free left behind overlap the new one
+    auto it = blocks.lower_bound(start);
+    if (it != blocks.begin() && std::prev(it)->first + std::prev(it)->second.size > start) {
+        --it;
+    }
+    while (it != blocks.end() && it->first < start + size) {
+        it = blocks.erase(it);
+    }
+    blocks.emplace_hint(it, start, block_t{size, next_id.fetch_add(1, std::memory_order_relaxed)});
+}
+
+void AllocationTracker::on_free(void *ptr) {
+    if (ptr == nullptr || !is_enabled()) {
+        return;
+    }
+    auto start = reinterpret_cast<uintptr_t>(ptr);
+    {
+        auto &shard = shards[(start >> kRegionBits) % kShardCount];
+        std::lock_guard<std::mutex> guard(shard.lock);
+        if (shard.blocks.erase(start) != 0) {
+            return;
+        }
+    }
+    std::lock_guard<std::mutex> guard(large_shard.lock);
+    large_shard.blocks.erase(start);
+}
+
+bool AllocationTracker::find_in_shard(shard_t &shard, uintptr_t addr,
+                                      tracked_allocation_t &allocation) {
+    std::lock_guard<std::mutex> guard(shard.lock);
+    // live blocks are disjoint, only the last one starting at or below addr can hold it
+    auto it = shard.blocks.upper_bound(addr);
+    if (it == shard.blocks.begin()) {
+        return false;
+    }
+    --it;
+    if (addr - it->first >= it->second.size) {
+        return false;
+    }
+    allocation = {it->first, it->second.size, it->second.id};
+    return true;
+}
+
+bool AllocationTracker::find(uintptr_t addr, tracked_allocation_t &allocation) {
+    if (!is_enabled()) {
+        return false;
+    }
+    // a small block starting in the region before may reach into this one
+    uintptr_t region = addr >> kRegionBits;
+    if (find_in_shard(shards[region % kShardCount], addr, allocation)) {
+        return true;
+    }
+    if (region > 0 && find_in_shard(shards[(region - 1) % kShardCount], addr, allocation)) {
+        return true;
+    }
+    return find_in_shard(large_shard, addr, allocation);
+}
@@ -0,0 +1,171 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2024 g2wfw
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_ALLOCATION_TRACKER_H
+#define QBDI_TRACER_ALLOCATION_TRACKER_H
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include "common.h"
+
+/**
+ * Fixed size nodes carved from mmap'd slabs. The shard maps of
+ * AllocationTracker are updated from inside the malloc hooks, their nodes
+ * must not come from malloc.
+ */
+class NodePool {
+public:
+    NodePool() = default;
+
+    void *allocate(size_t size);
+
+    void deallocate(void *node);
+
+private:
+    static constexpr size_t kSlabSize = 64 * 1024;
+
+    DISALLOW_COPY_AND_ASSIGN(NodePool);
+
+private:
+    // every node of one map has the same size, set by the first allocation
+    size_t node_size = 0;
+    void *free_list = nullptr;
+    uint8_t *slab = nullptr;
+    size_t slab_left = 0;
+};
+
+template<typename T>
+struct NodePoolAllocator {
+    typedef T value_type;
+
+    explicit NodePoolAllocator(NodePool *pool) : pool(pool) {}
+
+    template<typename U>
+    NodePoolAllocator(const NodePoolAllocator<U> &other) : pool(other.pool) {}
+
+    T *allocate(size_t n) {
+        return static_cast<T *>(pool->allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T *node, size_t) {
+        pool->deallocate(node);
+    }
+
+    template<typename U>
+    bool operator==(const NodePoolAllocator<U> &other) const {
+        return pool == other.pool;
+    }
+
+    template<typename U>
+    bool operator!=(const NodePoolAllocator<U> &other) const {
+        return pool != other.pool;
+    }
+
+    NodePool *pool;
+};
+
+/**
+ * Live heap blocks of the whole process, kept by hooks on the libc
+ * allocator. MemoryManager only sees the malloc/free calls of the traced
+ * code; with the tracker enabled a block allocated by another thread, or
+ * before tracing began, resolves to its start and size in O(log n) instead
+ * of a malloc_iterate walk of its mapping.
+ *
+ * Blocks are sharded by their 64 KiB region so threads allocating in
+ * different arenas rarely share a lock, larger blocks go to a shard of
+ * their own. enable() seeds the index with the blocks already live through
+ * bionic's malloc_iterate; without it those blocks stay unknown.
+ */
+typedef struct tracked_allocation {
+    uintptr_t start;
+    size_t size;
+    // unique per allocation, a block reusing a freed address gets a new one
+    uint64_t id;
+} tracked_allocation_t;
+
+class AllocationTracker {
+public:
+    static AllocationTracker *getInstance() {
+        static AllocationTracker instance;
+        return &instance;
+    }
+
+    // hooks stay installed once placed, disabling only stops recording
+    bool set_enable(bool enable);
+
+    [[nodiscard]] bool is_enabled() const {
+        return recording.load(std::memory_order_relaxed);
+    }
+
+    // live block holding addr
+    bool find(uintptr_t addr, tracked_allocation_t &allocation);
+
+    void on_alloc(void *ptr, size_t size);
+
+    void on_free(void *ptr);
+
+private:
+    static constexpr size_t kShardCount = 64;
+    static constexpr int kRegionBits = 16;
+
+    typedef struct block {
+        size_t size;
+        uint64_t id;
+    } block_t;
+
+    typedef std::map<uintptr_t, block_t, std::less<>,
+            NodePoolAllocator<std::pair<const uintptr_t, block_t>>> block_map_t;
+
+    typedef struct shard {
+        std::mutex lock;
+        NodePool pool;
+        block_map_t blocks{NodePoolAllocator<std::pair<const uintptr_t, block_t>>(&pool)};
+    } shard_t;
+
+    AllocationTracker() = default;
+
+    shard_t &get_shard(uintptr_t start, size_t size);
+
+    static bool find_in_shard(shard_t &shard, uintptr_t addr, tracked_allocation_t &allocation);
+
+    bool install_hooks();
+
+    // records the blocks allocated before recording started
+    void seed_live_blocks();
+
+    DISALLOW_COPY_AND_ASSIGN(AllocationTracker);
+
+private:
+    std::atomic_bool recording = false;
+    std::atomic_uint64_t next_id = 1;
+    bool hooked = false;
+    shard_t shards[kShardCount];
+    // blocks spanning more than a region
+    shard_t large_shard;
+};
+
+
+#endif //QBDI_TRACER_ALLOCATION_TRACKER_H
@@ -29,8 +29,10 @@
 #include <QBDI.h>
 #include <android/log.h>
 #include <cstdint>
+#include <memory>
 #include <sstream>
 #include <core/stl_macro.h>
+#include "record/trace_format.h"
 
 typedef enum fun_data_type {
     kUnknown = 0,
@@ -51,17 +53,39 @@ typedef struct trace_vm_status {
     QBDI::FPRState fpr_state;
 } trace_vm_status_t;
 
+// an argument captured at call time, rendered by whoever writes it out
+typedef struct fun_arg {
+    // static, or owned by a dispatcher table for the whole process
+    const char *name;
+    trace_call_arg_kind_t kind;
+    uint64_t value;
+    // bytes copied from the traced process into inst_fun_call_t::arg_data
+    uint32_t data_offset;
+    uint32_t data_size;
+} fun_arg_t;
+
+// see dispatch/dispatch_base.h
+struct dispatch_target;
+
 typedef struct inst_fun_call {
     uintptr_t fun_address = 0;
     uintptr_t memory_alloc_address = 0;
     uintptr_t memory_alloc_size = 0;
     uintptr_t memory_free_address = 0;
+    // the call may have changed /proc/self/maps, mmap, munmap, mprotect, brk...
+    bool memory_map_changed = false;
     fun_data_type_t ret_type = kUnknown;
     bool is_svc = false;
     std::string call_module_name;
     std::string fun_name;
     std::string ret_value;
+    // rendered by the dispatcher, only where rendering needs the call time state, e.g. JNI
     std::vector<std::string> args = {};
+    // rendered after args, off the traced thread for binary traces
+    std::vector<fun_arg_t> raw_args = {};
+    std::vector<uint8_t> arg_data = {};
+    // resolved when the args are dispatched, the ret goes to the same dispatcher
+    std::shared_ptr<const struct dispatch_target> target;
 } inst_fun_call_t;
 
 typedef struct module_export_details {
@@ -88,22 +112,6 @@ typedef struct inst_trace_info {
     const QBDI::InstAnalysis *inst_analysis = nullptr;
 } inst_trace_info_t;
 
-typedef struct serialize_file {
-    uint32_t magic = 0xDEADBEEF;
-    uint32_t version = 0x00000001;
-    uint32_t check_sum = 0;
-    bool memory_enable = false;
-    bool is_64bit = false;
-
-    uint64_t inst_count;
-    uint64_t inst_offset;
-
-    uint64_t module_base = 0;
-    uint64_t module_end = 0;
-
-    char module_name[64];
-} serialize_file_t;
-
 
 #define REGISTER_HANDLER(HANDLER_MAP, FUNC_NAME, HANDLER_BODY)                                                 \
     do {                                                                                                       \
@@ -114,6 +122,18 @@ typedef struct serialize_file {
         }                                                                                                      \
     } while (0)
 
+// runs once a call returned, ret_status holds the registers after it
+typedef void (*ret_handler_t)(inst_trace_info_t *trace_info, const QBDI::GPRState *ret_status);
+
+#define REGISTER_RET_HANDLER(HANDLER_MAP, FUNC_NAME, HANDLER_BODY)                                             \
+    do {                                                                                                       \
+        uintptr_t addr =(uintptr_t) module->find_symbol(#FUNC_NAME);                                        \
+        if (addr!=0) {                                                                                            \
+            ret_handler_t handler = [](inst_trace_info_t *trace_info, const QBDI::GPRState *ret_status) HANDLER_BODY; \
+            HANDLER_MAP.insert({addr, handler});                                                               \
+        }                                                                                                      \
+    } while (0)
+
 
 
 
@@ -0,0 +1,207 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2024 g2wfw
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "arg_capture.h"
+#include <QBDI.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <sys/uio.h>
+#include <unistd.h>
+
+// remote iovecs per process_vm_readv, far below IOV_MAX
+static constexpr size_t kMaxReadPages = 64;
+// a miss rebuilds the mappings snapshot at most this often, bad pointers are common
+static constexpr int64_t kMapsReloadMs = 100;
+
+static uintptr_t page_size() {
+    static const auto size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+static int64_t now_ms() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+ArgCapture *ArgCapture::get_instance() {
+    static ArgCapture instance;
+    return &instance;
+}
+
+ArgCapture::ArgCapture() {
+    limits[kCaptureString] = 1024;
+    limits[kCaptureInput] = 512;
+    limits[kCaptureOutput] = 512;
+}
+
+void ArgCapture::set_limit(capture_kind_t kind, uint32_t bytes) {
+    if (kind >= kCaptureKindCount) {
+        return;
+    }
+    limits[kind].store(std::min(bytes, kMaxCallArgData), std::memory_order_relaxed);
+}
+
+size_t ArgCapture::copy(uintptr_t address, void *out, size_t size) {
+    if (address == 0 || size == 0) {
+        return 0;
+    }
+    if (address + size < address) {
+        size = UINTPTR_MAX - address;
+    }
+    if (use_remote_read.load(std::memory_order_relaxed)) {
+        errno = 0;
+        auto copied = copy_remote(address, out, size);
+        if (copied != 0 || (errno != ENOSYS && errno != EPERM)) {
+            return copied;
+        }
+        // seccomp filters of some apps and old kernels refuse it, never try again
+        use_remote_read.store(false, std::memory_order_relaxed);
+    }
+    return copy_checked(address, out, size);
+}
+
+size_t ArgCapture::copy_remote(uintptr_t address, void *out, size_t size) {
+    static const auto self = getpid();
+    auto page_mask = page_size() - 1;
+    auto dest = static_cast<uint8_t *>(out);
+    size_t copied = 0;
+    struct iovec remote[kMaxReadPages];
+    while (copied < size) {
+        // one iovec per page, the kernel stops at the first one it can not read
+        size_t count = 0;
+        size_t batch = 0;
+        auto cursor = address + copied;
+        while (count < kMaxReadPages && copied + batch < size) {
+            auto chunk = std::min<size_t>(page_size() - (cursor & page_mask),
+                                          size - copied - batch);
+            remote[count].iov_base = reinterpret_cast<void *>(cursor);
+            remote[count].iov_len = chunk;
+            cursor += chunk;
+            batch += chunk;
+            count++;
+        }
+        struct iovec local = {dest + copied, batch};
+        auto read = process_vm_readv(self, &local, 1, remote, count, 0);
+        if (read <= 0) {
+            break;
+        }
+        copied += read;
+        if (static_cast<size_t>(read) < batch) {
+            break;
+        }
+    }
+    return copied;
+}
+
+size_t ArgCapture::copy_checked(uintptr_t address, void *out, size_t size) {
+    size = readable_size(address, size);
+    if (size != 0) {
+        memcpy(out, reinterpret_cast<const void *>(address), size);
+    }
+    return size;
+}
+
+void ArgCapture::load_maps() {
+    readable_ranges.clear();
+    for (const auto &map: QBDI::getCurrentProcessMaps(false)) {
+        // [vvar] claims to be readable, parts of it raise SIGBUS
+        if (!(map.permission & QBDI::PF_READ) || map.name.rfind("[vvar", 0) == 0) {
+            continue;
+        }
+        readable_ranges.push_back({map.range.start(), map.range.end()});
+    }
+    std::sort(readable_ranges.begin(), readable_ranges.end(),
+              [](const auto &a, const auto &b) {
+                  return a.start < b.start;
+              });
+    maps_loaded_at = now_ms();
+    maps_valid.store(true, std::memory_order_release);
+}
+
+size_t ArgCapture::readable_size(uintptr_t address, size_t size) {
+    std::lock_guard<std::mutex> lock(maps_mutex);
+    if (!maps_valid.load(std::memory_order_acquire)) {
+        load_maps();
+    }
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        auto it = std::upper_bound(readable_ranges.begin(), readable_ranges.end(), address,
+                                   [](uintptr_t addr, const readable_range_t &range) {
+                                       return addr < range.start;
+                                   });
+        if (it != readable_ranges.begin() && address < std::prev(it)->end) {
+            // adjacent mappings, a heap grown in steps, read as one
+            --it;
+            auto end = it->end;
+            while (++it != readable_ranges.end() && it->start == end && end - address < size) {
+                end = it->end;
+            }
+            return std::min<size_t>(size, end - address);
+        }
+        if (now_ms() - maps_loaded_at < kMapsReloadMs) {
+            break;
+        }
+        // mapped by a thread we do not trace, or before the last snapshot was taken
+        load_maps();
+    }
+    return 0;
+}
+
+size_t ArgCapture::append_string(uintptr_t address, std::vector<uint8_t> &out) {
+    auto limit = get_limit(kCaptureString);
+    auto base = out.size();
+    size_t length = 0;
+    while (length < limit) {
+        // never ask for the next page before the string turned out to continue there
+        auto cursor = address + length;
+        auto chunk = std::min<size_t>(page_size() - (cursor & (page_size() - 1)),
+                                      limit - length);
+        out.resize(base + length + chunk);
+        auto copied = copy(cursor, out.data() + base + length, chunk);
+        // memchr is the vectorized scan of bionic, one pass over the copied bytes
+        auto end = memchr(out.data() + base + length, 0, copied);
+        if (end != nullptr) {
+            length = static_cast<const uint8_t *>(end) - (out.data() + base);
+            break;
+        }
+        length += copied;
+        if (copied < chunk) {
+            break;
+        }
+    }
+    out.resize(base + length);
+    return length;
+}
+
+size_t ArgCapture::append_buffer(uintptr_t address, size_t size, capture_kind_t kind,
+                                 std::vector<uint8_t> &out) {
+    size = std::min<size_t>(size, get_limit(kind));
+    auto base = out.size();
+    out.resize(base + size);
+    auto copied = copy(address, out.data() + base, size);
+    out.resize(base + copied);
+    return copied;
+}
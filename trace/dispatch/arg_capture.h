@@ -0,0 +1,112 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2024 g2wfw
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_ARG_CAPTURE_H
+#define QBDI_TRACER_ARG_CAPTURE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "../common.h"
+
+typedef enum capture_kind : uint8_t {
+    // read up to the terminator
+    kCaptureString,
+    // buffers the callee reads, copied before the call
+    kCaptureInput,
+    // buffers the callee filled, copied once it returned
+    kCaptureOutput,
+    kCaptureKindCount,
+} capture_kind_t;
+
+/**
+ * Copies argument buffers out of the traced process for every dispatcher.
+ * Pointers come straight from the registers of the traced code, so nothing
+ * is dereferenced: bytes are read with process_vm_readv on our own pid, one
+ * remote iovec per page, and an unmapped page ends the copy instead of
+ * faulting the tracer. Kernels or sandboxes without process_vm_readv fall
+ * back to a snapshot of the readable mappings, rebuilt after the traced code
+ * changed its mappings or when an address misses it.
+ *
+ * Every kind has its own byte cap, a call never copies more than that into
+ * inst_fun_call_t::arg_data no matter what length the traced code passed.
+ */
+class ArgCapture {
+public:
+    static ArgCapture *get_instance();
+
+    // clamped to kMaxCallArgData, 0 keeps only the address of such arguments
+    void set_limit(capture_kind_t kind, uint32_t bytes);
+
+    [[nodiscard]] uint32_t get_limit(capture_kind_t kind) const {
+        return limits[kind].load(std::memory_order_relaxed);
+    }
+
+    // copies up to size bytes, stops at the first unreadable page, returns the bytes copied
+    size_t copy(uintptr_t address, void *out, size_t size);
+
+    // appends the string at address without its terminator, returns its length
+    size_t append_string(uintptr_t address, std::vector<uint8_t> &out);
+
+    // appends up to size bytes capped by the limit of kind, returns the bytes appended
+    size_t append_buffer(uintptr_t address, size_t size, capture_kind_t kind,
+                         std::vector<uint8_t> &out);
+
+    // the traced code mapped, unmapped or protected memory
+    void invalidate() {
+        maps_valid.store(false, std::memory_order_release);
+    }
+
+private:
+    ArgCapture();
+
+    size_t copy_remote(uintptr_t address, void *out, size_t size);
+
+    size_t copy_checked(uintptr_t address, void *out, size_t size);
+
+    // readable bytes from address on, up to size, by the mappings snapshot
+    size_t readable_size(uintptr_t address, size_t size);
+
+    void load_maps();
+
+private:
+    typedef struct readable_range {
+        uintptr_t start;
+        uintptr_t end;
+    } readable_range_t;
+
+    std::atomic<uint32_t> limits[kCaptureKindCount];
+    std::atomic<bool> use_remote_read{true};
+    std::atomic<bool> maps_valid{false};
+    std::mutex maps_mutex;
+    std::vector<readable_range_t> readable_ranges;
+    int64_t maps_loaded_at = 0;
+    DISALLOW_COPY_AND_ASSIGN(ArgCapture);
+};
+
+
+#endif //QBDI_TRACER_ARG_CAPTURE_H
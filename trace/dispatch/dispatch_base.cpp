@@ -6,6 +6,9 @@
 #include <unordered_map>
 #include <spdlog/fmt/fmt.h>
 #include <core/memory.h>
+#include <algorithm>
+#include <cstring>
+#include "../record/call_arg_format.h"
 
 void dispatch_export_func(const char *symbol, uintptr_t addr, void *user_data) {
     auto dispatch_base = (DispatchBase *) user_data;
@@ -32,71 +35,120 @@ std::string DispatchBase::get_address_symbol(uintptr_t address) {
     return find->second;
 }
 
-
-const char *DispatchBase::read_string_from_address(uintptr_t address) {
-    if (address == 0) {
-        return "";
+void DispatchBase::resolve(uintptr_t address, dispatch_target_t *target) {
+    auto find = this->symbol_info.find(address);
+    if (find != this->symbol_info.end()) {
+        target->fun_name = find->second.c_str();
     }
-    return reinterpret_cast<const char *>(address);
 }
 
-static std::string hexdump(const void *data, size_t size) {
-    auto *byteData = static_cast<const unsigned char *>(data);
-    std::string result;
-
-    for (size_t i = 0; i < size; i += 16) {
-        result += fmt::format("{}: ", fmt::ptr((byteData + i)));
-
-        for (size_t j = 0; j < 16; ++j) {
-            if (i + j < size) {
-                result += fmt::format("{:02X} ", byteData[i + j]);
-            } else {
-                result += "   ";
-            }
-        }
-
-        result += " |";
-        for (size_t j = 0; j < 16; ++j) {
-            if (i + j < size) {
-                char c = byteData[i + j];
-                result += (c >= 32 && c <= 126) ? c : '.';
-            }
-        }
-        result += "| \t";
-    }
-    return result;
+std::string DispatchBase::read_string_from_address(uintptr_t address) {
+    std::vector<uint8_t> bytes;
+    ArgCapture::get_instance()->append_string(address, bytes);
+    return {bytes.begin(), bytes.end()};
 }
 
 std::string DispatchBase::read_buffer_hexdump_from_address(uintptr_t address, size_t size) {
-    if (address == 0 || size == 0) {
+    std::vector<uint8_t> bytes;
+    ArgCapture::get_instance()->append_buffer(address, size, kCaptureOutput, bytes);
+    if (bytes.empty()) {
         return "";
     }
-    auto addr = reinterpret_cast<uint8_t *>(address);
-    return hexdump(addr, size);
-
+    std::string result;
+    append_call_arg_hexdump(result, address, bytes.data(), bytes.size());
+    return result;
 }
 
 bool DispatchBase::add_common_reg_values(inst_trace_info_t *info) {
-    auto instCall = info->fun_call;
     auto state = info->pre_status.gpr_state;
 #ifdef __arm__
-    instCall->args.push_back(fmt::format("R0={:#x}", state.r0));
-    instCall->args.push_back(fmt::format("R1={:#x}", state.r1));
-    instCall->args.push_back(fmt::format("R2={:#x}", state.r2));
-    instCall->args.push_back(fmt::format("R3={:#x}", state.r3));
+    capture_value(info, "R0", kCallArgHex, state.r0);
+    capture_value(info, "R1", kCallArgHex, state.r1);
+    capture_value(info, "R2", kCallArgHex, state.r2);
+    capture_value(info, "R3", kCallArgHex, state.r3);
 #else
-    instCall->args.push_back(fmt::format("X0={:#x}", state.x0));
-    instCall->args.push_back(fmt::format("X1={:#x}", state.x1));
-    instCall->args.push_back(fmt::format("X2={:#x}", state.x2));
-    instCall->args.push_back(fmt::format("X3={:#x}", state.x3));
-    instCall->args.push_back(fmt::format("X4={:#x}", state.x4));
-    instCall->args.push_back(fmt::format("X5={:#x}", state.x5));
-    instCall->args.push_back(fmt::format("X6={:#x}", state.x6));
-    instCall->args.push_back(fmt::format("X7={:#x}", state.x7));
+    capture_value(info, "X0", kCallArgHex, state.x0);
+    capture_value(info, "X1", kCallArgHex, state.x1);
+    capture_value(info, "X2", kCallArgHex, state.x2);
+    capture_value(info, "X3", kCallArgHex, state.x3);
+    capture_value(info, "X4", kCallArgHex, state.x4);
+    capture_value(info, "X5", kCallArgHex, state.x5);
+    capture_value(info, "X6", kCallArgHex, state.x6);
+    capture_value(info, "X7", kCallArgHex, state.x7);
 #endif
     return true;
 }
 
+void DispatchBase::clear_args(inst_trace_info_t *info) {
+    info->fun_call->args.clear();
+    info->fun_call->raw_args.clear();
+    info->fun_call->arg_data.clear();
+}
+
+void DispatchBase::capture_value(inst_trace_info_t *info, const char *name,
+                                 trace_call_arg_kind_t kind, uint64_t value) {
+    info->fun_call->raw_args.push_back({name, kind, value, 0, 0});
+}
+
+void DispatchBase::capture_double(inst_trace_info_t *info, const char *name, double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    info->fun_call->raw_args.push_back({name, kCallArgDouble, bits, 0, 0});
+}
+
+void DispatchBase::capture_string(inst_trace_info_t *info, const char *name, uintptr_t address,
+                                  bool quoted) {
+    auto call = info->fun_call;
+    auto offset = static_cast<uint32_t>(call->arg_data.size());
+    auto size = ArgCapture::get_instance()->append_string(address, call->arg_data);
+    call->raw_args.push_back({name, quoted ? kCallArgQuoted : kCallArgString, address, offset,
+                              static_cast<uint32_t>(size)});
+}
+
+void DispatchBase::capture_text(inst_trace_info_t *info, const char *name,
+                                const std::string &text) {
+    auto call = info->fun_call;
+    auto offset = static_cast<uint32_t>(call->arg_data.size());
+    auto size = std::min<size_t>(text.size(),
+                                 ArgCapture::get_instance()->get_limit(kCaptureString));
+    call->arg_data.insert(call->arg_data.end(), text.begin(), text.begin() + size);
+    call->raw_args.push_back({name, kCallArgString, 0, offset, static_cast<uint32_t>(size)});
+}
+
+void DispatchBase::capture_labeled(inst_trace_info_t *info, const char *name,
+                                   const std::string &text, uint64_t value) {
+    capture_text(info, name, text);
+    auto &arg = info->fun_call->raw_args.back();
+    arg.kind = kCallArgLabeled;
+    arg.value = value;
+}
+
+void DispatchBase::capture_buffer(inst_trace_info_t *info, const char *name, uintptr_t address,
+                                  size_t size, capture_kind_t kind) {
+    auto call = info->fun_call;
+    auto offset = static_cast<uint32_t>(call->arg_data.size());
+    size = ArgCapture::get_instance()->append_buffer(address, size, kind, call->arg_data);
+    call->raw_args.push_back({name, kCallArgHexdump, address, offset,
+                              static_cast<uint32_t>(size)});
+}
+
+void DispatchBase::capture_output(inst_trace_info_t *info, size_t index, size_t size) {
+    auto call = info->fun_call;
+    if (index >= call->raw_args.size()) {
+        return;
+    }
+    auto &arg = call->raw_args[index];
+    auto offset = static_cast<uint32_t>(call->arg_data.size());
+    auto copied = ArgCapture::get_instance()->append_buffer(arg.value, size, kCaptureOutput,
+                                                            call->arg_data);
+    if (copied == 0) {
+        return;
+    }
+    arg.kind = kCallArgHexdump;
+    arg.data_offset = offset;
+    arg.data_size = static_cast<uint32_t>(copied);
+}
+
 bool DispatchBase::add_common_return_value(inst_trace_info_t *info, const QBDI::GPRState *state) {
     auto instCall = info->fun_call;
 #if __arm__
@@ -194,6 +246,13 @@ uintptr_t DispatchBase::get_ret_register_value(const QBDI::GPRState *state, uint
     return 0;
 }
 
+void DispatchBase::ensure_loaded() {
+    std::call_once(load_once, [this]() {
+        load();
+        loaded.store(true, std::memory_order_release);
+    });
+}
+
 void DispatchBase::add_export_info(const char *symbol, uintptr_t addr) {
     this->symbol_info.emplace(addr, symbol);
 }
@@ -6,32 +6,119 @@
 #define ITRACE_NATIVE_DISPATCH_BASE_H
 
 #include <QBDI.h>
+#include <core/library.h>
 
 #include <cstdint>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include "../common.h"
+#include "arg_capture.h"
 
 void dispatch_export_func(const char *symbol, uintptr_t addr, void *user_data);
 
+class DispatchBase;
+
+struct function_signature;
+
+// jni_slot of targets outside the JNIEnv function table
+inline constexpr uint32_t kNoJniSlot = UINT32_MAX;
+
+/**
+ * A call target resolved to its dispatcher, name and handlers. The owning
+ * dispatcher fills it once per target and InstructionDispatchManager keeps
+ * it, so later calls to the same target skip every table lookup.
+ */
+typedef struct dispatch_target {
+    DispatchBase *dispatcher = nullptr;
+    // owned by the tables of the dispatcher, nullptr when the export is unknown
+    const char *fun_name = nullptr;
+    const std::function<void(inst_trace_info_t *)> *args_handler = nullptr;
+    ret_handler_t ret_handler = nullptr;
+    // copies the buffers the call filled, before ret_handler runs
+    ret_handler_t output_handler = nullptr;
+    // formats the result of calls whose ret_type stayed kUnknown
+    ret_handler_t format_handler = nullptr;
+    // set when SignatureRegistry decodes the target, dispatcher is DispatchSignature then
+    const struct function_signature *signature = nullptr;
+    // DispatchSymbol only, the other dispatchers own a single module
+    const char *module_name = nullptr;
+    // DispatchJNIEnv only, index of the function in JNINativeInterface
+    uint32_t jni_slot = kNoJniSlot;
+} dispatch_target_t;
+
 
 class DispatchBase {
 public:
     virtual ~DispatchBase() = default;
 
+    // builds the handler tables and export names once, blocks while another thread does
+    void ensure_loaded();
+
+    // false until ensure_loaded finished, resolve must not be called before
+    [[nodiscard]] bool is_loaded() const {
+        return loaded.load(std::memory_order_acquire);
+    }
+
     [[nodiscard]] bool is_module_address(uintptr_t address) const;
 
     void add_export_info(const char *symbol, uintptr_t addr);
 
     std::string get_address_symbol(uintptr_t address);
 
-    virtual bool dispatch_args(inst_trace_info_t *info) = 0;
+    [[nodiscard]] const std::string &get_module_name() const {
+        return module_name;
+    }
+
+    [[nodiscard]] const module_range_t &get_module_range() const {
+        return module_range;
+    }
+
+    // export address to name, as collected by dispatch_export_func
+    [[nodiscard]] const std::unordered_map<uintptr_t, std::string> &get_export_infos() const {
+        return symbol_info;
+    }
 
-    virtual bool dispatch_ret(inst_trace_info_t *info, const QBDI::GPRState *ret_status) = 0;
+    // fills name and handlers of an address inside the module, the default only names exports
+    virtual void resolve(uintptr_t address, dispatch_target_t *target);
+
+    virtual bool dispatch_args(inst_trace_info_t *info, const dispatch_target_t &target) = 0;
+
+    virtual bool dispatch_ret(inst_trace_info_t *info, const QBDI::GPRState *ret_status,
+                              const dispatch_target_t &target) = 0;
     static uintptr_t get_arg_register_value(trace_vm_status_t *instCall, uint32_t arg_index);
+
+    // raw arguments, the value now, the rendering when the call is written out
+    static void capture_value(inst_trace_info_t *info, const char *name,
+                              trace_call_arg_kind_t kind, uint64_t value);
+
+    // rendered like %g, value keeps the bits of the double
+    static void capture_double(inst_trace_info_t *info, const char *name, double value);
+
+    // copies the string through ArgCapture, buffers change after the call
+    static void capture_string(inst_trace_info_t *info, const char *name, uintptr_t address,
+                               bool quoted = false);
+
+    // a value only the dispatcher can render, kept as a string argument
+    static void capture_text(inst_trace_info_t *info, const char *name, const std::string &text);
+
+    // a handle and what the dispatcher knows about it, rendered as name=<text> 0x1f
+    static void capture_labeled(inst_trace_info_t *info, const char *name,
+                                const std::string &text, uint64_t value);
+
+protected:
+    // the expensive part of construction, find_symbol may read .symtab from disk
+    virtual void load() {}
+
 protected:
     std::unordered_map<uintptr_t, std::string> symbol_info;
     module_range_t module_range = {};
+    std::string module_name;
+    // kept from the constructor for load()
+    std::unique_ptr<stl::Library> module;
 
 protected:
     /**
@@ -48,13 +135,28 @@ protected:
 
     static uintptr_t get_ret_register_value(const QBDI::GPRState *state, uint32_t arg_index);
 
-    static const char *read_string_from_address(uintptr_t address);
+    // bounded and fault tolerant, an unreadable address gives an empty string
+    static std::string read_string_from_address(uintptr_t address);
 
     static std::string read_buffer_hexdump_from_address(uintptr_t address, size_t size = 16);
 
     static bool add_common_reg_values(inst_trace_info_t *info);
 
+    // at most the ArgCapture limit of kind, kCaptureOutput from a ret handler
+    static void capture_buffer(inst_trace_info_t *info, const char *name, uintptr_t address,
+                               size_t size, capture_kind_t kind = kCaptureInput);
+
+    // turns the raw arg at index, a buffer address, into a dump of the size bytes the call filled
+    static void capture_output(inst_trace_info_t *info, size_t index, size_t size);
+
+    // drops rendered and raw arguments, for handlers that decode a call again
+    static void clear_args(inst_trace_info_t *info);
+
     static bool add_common_return_value(inst_trace_info_t *info, const QBDI::GPRState *state);
+
+private:
+    std::once_flag load_once;
+    std::atomic<bool> loaded{false};
 };
 
 #endif  //ITRACE_NATIVE_DISPATCH_BASE_H
@@ -3,6 +3,8 @@
 //
 
 #include <jni.h>
+#include <array>
+#include <cstddef>
 #include <spdlog/fmt/fmt.h>
 #include <smjni.h>
 #include <core/library.h>
@@ -11,7 +13,8 @@
 #include "core/logging/check.h"
 #include <core/containers/stl_Collections.h>
 
-static std::unordered_map<uintptr_t, std::string> env_fun_table;
+// address of a JNIEnv function to its slot in JNINativeInterface
+static std::unordered_map<uintptr_t, uint32_t> env_fun_slots;
 
 DispatchJNIEnv *DispatchJNIEnv::get_instance() {
     static DispatchJNIEnv dispatchJniEnv;
@@ -20,11 +23,15 @@ DispatchJNIEnv *DispatchJNIEnv::get_instance() {
 
 
 DispatchJNIEnv::DispatchJNIEnv() {
-    init_env_fun_table();
-    auto module = stl::Library::find_library("libart.so");
+    module = stl::Library::find_library("libart.so");
+    module_name = "libart.so";
     auto range = module->get_library_range();
     module_range.base = range.start();
     module_range.end = range.end();
+}
+
+void DispatchJNIEnv::load() {
+    init_env_fun_table();
     module->enumerate_exports(dispatch_export_func, this);
 }
 
@@ -43,7 +50,7 @@ static void FindClass(inst_trace_info_t *trace_info) {
     auto *env = reinterpret_cast<JNIEnv *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 0));
     const char *name = reinterpret_cast<const char *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     //LOGI("FindClass: name=%s", name);
-    trace_info->fun_call->args.push_back(fmt::format("name={}", name));
+    DispatchBase::capture_string(trace_info, "name", (uintptr_t) name);
 }
 
 static void FromReflectedMethod(inst_trace_info_t *trace_info) {
@@ -51,7 +58,7 @@ static void FromReflectedMethod(inst_trace_info_t *trace_info) {
     auto method = reinterpret_cast<jobject>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     auto info = get_reflected_method_info(env, method);
     //LOGI("FromReflectedMethod: method=%s", info.c_str());
-    trace_info->fun_call->args.push_back(fmt::format("method={} {:#x}", info, (uintptr_t) method));
+    DispatchBase::capture_labeled(trace_info, "method", info, (uintptr_t) method);
 }
 
 static void FromReflectedField(inst_trace_info_t *trace_info) {
@@ -59,8 +66,7 @@ static void FromReflectedField(inst_trace_info_t *trace_info) {
     auto field = reinterpret_cast<jobject>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     auto info = get_reflected_field_info(env, field);
     //LOGI("FromReflectedField: field=%s", info.c_str());
-    trace_info->fun_call->args.push_back(
-            fmt::format("field={}", info));
+    DispatchBase::capture_labeled(trace_info, "field", info, (uintptr_t) field);
 }
 
 // static jobject ToReflectedField(JNIEnv *env, jclass clazz, jfieldID fid, jboolean isStatic)
@@ -73,9 +79,9 @@ ToReflectedField(inst_trace_info_t *trace_info) {
     auto clazz_name = get_jni_class_or_java_class_name(env, clazz);
     auto field_sign = get_jni_field_signature(env, fid);
     //LOGI("ToReflectedField: clazz=%s, fid=%s, isStatic=%d", clazz_name.c_str(), field_sign.c_str(), isStatic);
-    trace_info->fun_call->args.push_back(fmt::format("clazz={}", clazz_name));
-    trace_info->fun_call->args.push_back(fmt::format("fid={}", field_sign));
-    trace_info->fun_call->args.push_back(fmt::format("isStatic={}", isStatic));
+    DispatchBase::capture_text(trace_info, "clazz", clazz_name);
+    DispatchBase::capture_text(trace_info, "fid", field_sign);
+    DispatchBase::capture_value(trace_info, "isStatic", kCallArgUnsigned, isStatic);
 }
 
 static void
@@ -88,9 +94,9 @@ ToReflectedMethod(inst_trace_info_t *trace_info) {
     auto class_name = get_jni_class_or_java_class_name(env, clazz);
     auto method_sign = get_jni_method_signature(env, mid);
     //LOGI("ToReflectedMethod: clazz=%s, mid=%s, isStatic=%d", class_name.c_str(), method_sign.c_str(), isStatic);
-    trace_info->fun_call->args.push_back(fmt::format("clazz={}", class_name));
-    trace_info->fun_call->args.push_back(fmt::format("mid={}", method_sign));
-    trace_info->fun_call->args.push_back(fmt::format("isStatic={}", isStatic));
+    DispatchBase::capture_text(trace_info, "clazz", class_name);
+    DispatchBase::capture_text(trace_info, "mid", method_sign);
+    DispatchBase::capture_value(trace_info, "isStatic", kCallArgUnsigned, isStatic);
 }
 
 //static jclass GetObjectClass(JNIEnv *env, jobject java_object)
@@ -99,7 +105,7 @@ static void GetObjectClass(inst_trace_info_t *trace_info) {
     auto java_object = reinterpret_cast<jobject>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     auto object_name = get_jni_jobject_name(env, java_object);
     //LOGI("GetObjectClass: java_object=%s", object_name.c_str());
-    trace_info->fun_call->args.push_back(fmt::format("object={} {:#x}", object_name, (uintptr_t) java_object));
+    DispatchBase::capture_labeled(trace_info, "object", object_name, (uintptr_t) java_object);
 }
 
 // static jclass GetSuperclass(JNIEnv *env, jclass java_class)
@@ -108,7 +114,7 @@ static void GetSuperclass(inst_trace_info_t *trace_info) {
     auto java_class = reinterpret_cast<jclass>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     auto clazz_info = get_jni_class_or_java_class_name(env, java_class);
     //LOGI("GetSuperclass: java_class=%s %p", clazz_info.c_str(), java_class);
-    trace_info->fun_call->args.push_back(fmt::format("java_class={} {:#x}", clazz_info, (uintptr_t) java_class));
+    DispatchBase::capture_labeled(trace_info, "java_class", clazz_info, (uintptr_t) java_class);
 }
 
 //static jboolean IsAssignableFrom(JNIEnv *env, jclass java_class1, jclass java_class2)
@@ -119,8 +125,8 @@ static void IsAssignableFrom(inst_trace_info_t *trace_info) {
     auto clazz1_info = get_jni_class_or_java_class_name(env, java_class1);
     auto clazz2_info = get_jni_class_or_java_class_name(env, java_class2);
     //LOGI("IsAssignableFrom: java_class1=%s, java_class2=%s", clazz1_info.c_str(), clazz2_info.c_str());
-    trace_info->fun_call->args.push_back(fmt::format("java_class1={} {:#x}", clazz1_info, (uintptr_t) java_class1));
-    trace_info->fun_call->args.push_back(fmt::format("java_class2={} {:#x}", clazz2_info, (uintptr_t) java_class2));
+    DispatchBase::capture_labeled(trace_info, "java_class1", clazz1_info, (uintptr_t) java_class1);
+    DispatchBase::capture_labeled(trace_info, "java_class2", clazz2_info, (uintptr_t) java_class2);
 }
 
 //static jint Throw(JNIEnv *env, jthrowable java_exception)
@@ -130,8 +136,7 @@ static void Throw(inst_trace_info_t *trace_info) {
                                                                                             1));
     auto java_exception_msg = get_jni_jobject_name(env, java_exception);
     //LOGI("Throw: java_exception=%s", java_exception_msg.c_str());
-    trace_info->fun_call->args.push_back(fmt::format("java_exception={} {:#x}", java_exception_msg,
-                                                     (uintptr_t) java_exception));
+    DispatchBase::capture_labeled(trace_info, "java_exception", java_exception_msg, (uintptr_t) java_exception);
 }
 
 //static jint ThrowNew(JNIEnv *env, jclass c, const char *msg) {
@@ -141,8 +146,8 @@ static void ThrowNew(inst_trace_info_t *trace_info) {
     auto msg = reinterpret_cast<const char *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));
     auto clazz_info = get_jni_class_or_java_class_name(env, c);
     //LOGI("ThrowNew: java_class=%s, msg=%s", clazz_info.c_str(), msg);
-    trace_info->fun_call->args.push_back(fmt::format("java_class={} {:#x}", clazz_info, (uintptr_t) c));
-    trace_info->fun_call->args.push_back(fmt::format("msg={}", msg));
+    DispatchBase::capture_labeled(trace_info, "java_class", clazz_info, (uintptr_t) c);
+    DispatchBase::capture_string(trace_info, "msg", (uintptr_t) msg);
 }
 
 //static jint PushLocalFrame(JNIEnv *env, jint capacity)
@@ -150,7 +155,7 @@ static void PushLocalFrame(inst_trace_info_t *trace_info) {
     auto *env = reinterpret_cast<JNIEnv *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 0));
     auto capacity = DispatchBase::get_arg_register_value(&trace_info->pre_status, 1);
     //LOGI("PushLocalFrame: capacity=%lu", capacity);
-    trace_info->fun_call->args.push_back(fmt::format("capacity={}", capacity));
+    DispatchBase::capture_value(trace_info, "capacity", kCallArgUnsigned, capacity);
 }
 
 //static jobject PopLocalFrame(JNIEnv *env, jobject java_survivor) {
@@ -159,7 +164,7 @@ static void PopLocalFrame(inst_trace_info_t *trace_info) {
     auto java_survivor = reinterpret_cast<jobject>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     auto object_name = get_jni_jobject_name(env, java_survivor);
     //LOGI("PopLocalFrame: java_survivor=%s", object_name.c_str());
-    trace_info->fun_call->args.push_back(fmt::format("java_survivor={} {:#x}", object_name, (uintptr_t) java_survivor));
+    DispatchBase::capture_labeled(trace_info, "java_survivor", object_name, (uintptr_t) java_survivor);
 }
 
 //static jobject NewGlobalRef(JNIEnv *env, jobject obj)
@@ -168,7 +173,7 @@ static void NewGlobalRef(inst_trace_info_t *trace_info) {
     auto obj = reinterpret_cast<jobject>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     auto object_name = get_jni_jobject_name(env, obj);
     //LOGI("NewGlobalRef: obj=%s", object_name.c_str());
-    trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t) obj));
+    DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);
 }
 
 //static void DeleteGlobalRef(JNIEnv *env, jobject obj)
@@ -177,7 +182,7 @@ static void DeleteGlobalRef(inst_trace_info_t *trace_info) {
     auto obj = reinterpret_cast<jobject>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     auto object_name = get_jni_jobject_name(env, obj);
     //LOGI("DeleteGlobalRef: obj=%s", object_name.c_str());
-    trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t) obj));
+    DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);
 }
 
 //static void DeleteLocalRef(JNIEnv *env, jobject obj)
@@ -186,7 +191,7 @@ static void DeleteLocalRef(inst_trace_info_t *trace_info) {
     auto obj = reinterpret_cast<jobject>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     auto object_name = get_jni_jobject_name(env, obj);
     //LOGI("DeleteLocalRef: obj=%s", object_name.c_str());
-    trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t) obj));
+    DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);
 }
 
 //static jboolean IsSameObject(JNIEnv *env, jobject obj1, jobject obj2)
@@ -197,8 +202,8 @@ static void IsSameObject(inst_trace_info_t *trace_info) {
     auto object_name1 = get_jni_jobject_name(env, obj1);
     auto object_name2 = get_jni_jobject_name(env, obj2);
     //LOGI("IsSameObject: obj1=%s, obj2=%s", object_name1.c_str(), object_name2.c_str());
-    trace_info->fun_call->args.push_back(fmt::format("obj1={} {:#x}", object_name1, (uintptr_t) obj1));
-    trace_info->fun_call->args.push_back(fmt::format("obj2={} {:#x}", object_name2, (uintptr_t) obj2));
+    DispatchBase::capture_labeled(trace_info, "obj1", object_name1, (uintptr_t) obj1);
+    DispatchBase::capture_labeled(trace_info, "obj2", object_name2, (uintptr_t) obj2);
 }
 
 //static jobject NewLocalRef(JNIEnv *env, jobject obj)
@@ -207,7 +212,7 @@ static void NewLocalRef(inst_trace_info_t *trace_info) {
     auto obj = reinterpret_cast<jobject>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     auto object_name = get_jni_jobject_name(env, obj);
     //LOGI("NewLocalRef: obj=%s", object_name.c_str());
-    trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t) obj));
+    DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);
 }
 
 //static jint EnsureLocalCapacity(JNIEnv *env, jint capacity)
@@ -215,7 +220,7 @@ static void EnsureLocalCapacity(inst_trace_info_t *trace_info) {
     auto *env = reinterpret_cast<JNIEnv *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 0));
     auto capacity = DispatchBase::get_arg_register_value(&trace_info->pre_status, 1);
     //LOGI("EnsureLocalCapacity: capacity=%lu", capacity);
-    trace_info->fun_call->args.push_back(fmt::format("capacity={}", capacity));
+    DispatchBase::capture_value(trace_info, "capacity", kCallArgUnsigned, capacity);
 }
 
 //static jobject AllocObject(JNIEnv *env, jclass java_class)
@@ -224,7 +229,7 @@ static void AllocObject(inst_trace_info_t *trace_info) {
     auto java_class = reinterpret_cast<jclass>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     auto clazz_info = get_jni_class_or_java_class_name(env, java_class);
     //LOGI("AllocObject: java_class=%s", clazz_info.c_str());
-    trace_info->fun_call->args.push_back(fmt::format("java_class={} {:#x}", clazz_info, (uintptr_t) java_class));
+    DispatchBase::capture_labeled(trace_info, "java_class", clazz_info, (uintptr_t) java_class);
 }
 
 // static jobject NewObject(JNIEnv *env, jclass java_class, jmethodID mid, ...)
@@ -235,8 +240,8 @@ static void NewObject(inst_trace_info_t *trace_info) {
     auto clazz_info = get_jni_class_or_java_class_name(env, java_class);
     auto method_info = get_jni_method_signature(env, mid);
     //LOGI("NewObject: java_class=%s, mid=%s", clazz_info.c_str(), method_info.c_str());
-    trace_info->fun_call->args.push_back(fmt::format("java_class={} {:#x}", clazz_info, (uintptr_t) java_class));
-    trace_info->fun_call->args.push_back(fmt::format("mid={} {:#x}", method_info, (uintptr_t) mid));
+    DispatchBase::capture_labeled(trace_info, "java_class", clazz_info, (uintptr_t) java_class);
+    DispatchBase::capture_labeled(trace_info, "mid", method_info, (uintptr_t) mid);
 }
 
 //static jobject NewObjectA(JNIEnv *env, jclass java_class, jmethodID mid, const jvalue *args)
@@ -247,8 +252,8 @@ static void NewObjectA(inst_trace_info_t *trace_info) {
     auto clazz_info = get_jni_class_or_java_class_name(env, java_class);
     auto method_info = get_jni_method_signature(env, mid);
     //LOGI("NewObjectA: java_class=%s, mid=%s", clazz_info.c_str(), method_info.c_str());
-    trace_info->fun_call->args.push_back(fmt::format("java_class={} {:#x}", clazz_info, (uintptr_t) java_class));
-    trace_info->fun_call->args.push_back(fmt::format("mid={} {:#x}", method_info, (uintptr_t) mid));
+    DispatchBase::capture_labeled(trace_info, "java_class", clazz_info, (uintptr_t) java_class);
+    DispatchBase::capture_labeled(trace_info, "mid", method_info, (uintptr_t) mid);
 }
 
 //static jobject NewObjectV(JNIEnv *env, jclass java_class, jmethodID mid, va_list args)
@@ -259,8 +264,8 @@ static void NewObjectV(inst_trace_info_t *trace_info) {
     auto clazz_info = get_jni_class_or_java_class_name(env, java_class);
     auto method_info = get_jni_method_signature(env, mid);
     //LOGI("NewObjectV: java_class=%s, mid=%s", clazz_info.c_str(), method_info.c_str());
-    trace_info->fun_call->args.push_back(fmt::format("java_class={} {:#x}", clazz_info, (uintptr_t) java_class));
-    trace_info->fun_call->args.push_back(fmt::format("mid={} {:#x}", method_info, (uintptr_t) mid));
+    DispatchBase::capture_labeled(trace_info, "java_class", clazz_info, (uintptr_t) java_class);
+    DispatchBase::capture_labeled(trace_info, "mid", method_info, (uintptr_t) mid);
 }
 
 //static jboolean IsInstanceOf(JNIEnv *env, jobject jobj, jclass java_class)
@@ -271,8 +276,8 @@ static void IsInstanceOf(inst_trace_info_t *trace_info) {
     auto clazz_info = get_jni_class_or_java_class_name(env, java_class);
     auto object_name = get_jni_jobject_name(env, jobj);
     //LOGI("IsInstanceOf: jobj=%s, java_class=%s", object_name.c_str(), clazz_info.c_str());
-    trace_info->fun_call->args.push_back(fmt::format("jobj={} {:#x}", object_name, (uintptr_t) jobj));
-    trace_info->fun_call->args.push_back(fmt::format("java_class={} {:#x}", clazz_info, (uintptr_t) java_class));
+    DispatchBase::capture_labeled(trace_info, "jobj", object_name, (uintptr_t) jobj);
+    DispatchBase::capture_labeled(trace_info, "java_class", clazz_info, (uintptr_t) java_class);
 }
 
 //static jmethodID GetMethodID(JNIEnv *env, jclass java_class, const char *name, const char *sig)
@@ -283,9 +288,9 @@ static void GetMethodID(inst_trace_info_t *trace_info) {
     auto sig = reinterpret_cast<const char *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 3));
     auto clazz_info = get_jni_class_or_java_class_name(env, java_class);
     //LOGI("GetMethodID: java_class=%s, name=%s, sig=%s", clazz_info.c_str(), name, sig);
-    trace_info->fun_call->args.push_back(fmt::format("java_class={} {:#x}", clazz_info, (uintptr_t) java_class));
-    trace_info->fun_call->args.push_back(fmt::format("name={}", name));
-    trace_info->fun_call->args.push_back(fmt::format("sig={}", sig));
+    DispatchBase::capture_labeled(trace_info, "java_class", clazz_info, (uintptr_t) java_class);
+    DispatchBase::capture_string(trace_info, "name", (uintptr_t) name);
+    DispatchBase::capture_string(trace_info, "sig", (uintptr_t) sig);
 }
 
 
@@ -297,8 +302,8 @@ static void GetMethodID(inst_trace_info_t *trace_info) {
         auto mid = reinterpret_cast<jmethodID>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));\
         auto object_name = get_jni_jobject_name(env, obj);\
         auto method_info = get_jni_method_signature(env, mid);\
-        trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t) obj));\
-        trace_info->fun_call->args.push_back(fmt::format("mid={} {:#x}", method_info, (uintptr_t) mid));\
+        DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);\
+        DispatchBase::capture_labeled(trace_info, "mid", method_info, (uintptr_t) mid);\
     }
 #define PROXY_CALL_TYPE_METHODV(_jname) \
    static void Call##_jname##MethodV(inst_trace_info_t *trace_info) \
@@ -308,8 +313,8 @@ static void GetMethodID(inst_trace_info_t *trace_info) {
     auto mid = reinterpret_cast<jmethodID>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));\
     auto object_name = get_jni_jobject_name(env, obj);\
     auto method_info = get_jni_method_signature(env, mid);\
-    trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t) obj));\
-    trace_info->fun_call->args.push_back(fmt::format("mid={} {:#x}", method_info, (uintptr_t) mid));\
+    DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);\
+    DispatchBase::capture_labeled(trace_info, "mid", method_info, (uintptr_t) mid);\
    }
 #define PROXY_CALL_TYPE_METHODA(_jname) \
    static void Call##_jname##MethodA(inst_trace_info_t *trace_info) \
@@ -319,8 +324,8 @@ static void GetMethodID(inst_trace_info_t *trace_info) {
         auto mid = reinterpret_cast<jmethodID>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));\
         auto object_name = get_jni_jobject_name(env, obj);\
         auto method_info = get_jni_method_signature(env, mid);\
-        trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t) obj));\
-        trace_info->fun_call->args.push_back(fmt::format("mid={} {:#x}", method_info, (uintptr_t) mid));\
+        DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);\
+        DispatchBase::capture_labeled(trace_info, "mid", method_info, (uintptr_t) mid);\
     }
 
 
@@ -362,9 +367,9 @@ PROXY_CALL_TYPE(Void)
         auto object_name = get_jni_jobject_name(env, obj);\
         auto clazz_info = get_jni_class_or_java_class_name(env, clazz);\
         auto method_info = get_jni_method_signature(env, mid);\
-        trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t) obj));\
-        trace_info->fun_call->args.push_back(fmt::format("clazz={} {:#x}", clazz_info, (uintptr_t) clazz));\
-        trace_info->fun_call->args.push_back(fmt::format("mid={} {:#x}", method_info, (uintptr_t) mid));\
+        DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);\
+        DispatchBase::capture_labeled(trace_info, "clazz", clazz_info, (uintptr_t) clazz);\
+        DispatchBase::capture_labeled(trace_info, "mid", method_info, (uintptr_t) mid);\
     }
 #define PROXY_CALL_NONVIRT_TYPE_METHODV(_jname)                                                 \
    static void CallNonvirtual##_jname##MethodV(inst_trace_info_t *trace_info)\
@@ -376,9 +381,9 @@ PROXY_CALL_TYPE(Void)
         auto object_name = get_jni_jobject_name(env, obj);\
         auto clazz_info = get_jni_class_or_java_class_name(env, clazz);\
         auto method_info = get_jni_method_signature(env, mid);\
-        trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t) obj));\
-        trace_info->fun_call->args.push_back(fmt::format("clazz={} {:#x}", clazz_info, (uintptr_t) clazz));\
-        trace_info->fun_call->args.push_back(fmt::format("mid={} {:#x}", method_info, (uintptr_t) mid));\
+        DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);\
+        DispatchBase::capture_labeled(trace_info, "clazz", clazz_info, (uintptr_t) clazz);\
+        DispatchBase::capture_labeled(trace_info, "mid", method_info, (uintptr_t) mid);\
     }
 
 #define PROXY_CALL_NONVIRT_TYPE_METHODA(_jname) \
@@ -391,9 +396,9 @@ PROXY_CALL_TYPE(Void)
         auto object_name = get_jni_jobject_name(env, obj);\
         auto clazz_info = get_jni_class_or_java_class_name(env, clazz);\
         auto method_info = get_jni_method_signature(env, mid);\
-        trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t) obj));\
-        trace_info->fun_call->args.push_back(fmt::format("clazz={} {:#x}", clazz_info, (uintptr_t) clazz));\
-        trace_info->fun_call->args.push_back(fmt::format("mid={} {:#x}", method_info, (uintptr_t) mid));\
+        DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);\
+        DispatchBase::capture_labeled(trace_info, "clazz", clazz_info, (uintptr_t) clazz);\
+        DispatchBase::capture_labeled(trace_info, "mid", method_info, (uintptr_t) mid);\
     }
 
 #define PROXY_CALL_NONVIRT_TYPE(_jname)                                   \
@@ -428,9 +433,9 @@ static void GetFieldID(inst_trace_info_t *trace_info) {
     auto name = reinterpret_cast<const char *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));
     auto sig = reinterpret_cast<const char *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 3));
     auto clazz_info = get_jni_class_or_java_class_name(env, java_class);
-    trace_info->fun_call->args.push_back(fmt::format("clazz={} {:#x}", clazz_info, (uintptr_t) java_class));
-    trace_info->fun_call->args.push_back(fmt::format("name={}", name));
-    trace_info->fun_call->args.push_back(fmt::format("sig={}", sig));
+    DispatchBase::capture_labeled(trace_info, "clazz", clazz_info, (uintptr_t) java_class);
+    DispatchBase::capture_string(trace_info, "name", (uintptr_t) name);
+    DispatchBase::capture_string(trace_info, "sig", (uintptr_t) sig);
 }
 
 //static jobject GetObjectField(JNIEnv *env, jobject obj, jfieldID fid)
@@ -442,8 +447,8 @@ static void GetFieldID(inst_trace_info_t *trace_info) {
         auto fid = reinterpret_cast<jfieldID>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));\
         auto object_name = get_jni_jobject_name(env, obj);\
         auto field_info = get_jni_field_signature(env, fid);\
-        trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t)obj));\
-        trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t)fid));\
+        DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);\
+        DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);\
     }
 
 PROXY_GET_FIELD(Object)
@@ -476,9 +481,9 @@ static void SetObjectField(inst_trace_info_t *trace_info) {
     auto field_info = get_jni_field_signature(env, fid);
     auto value_info = get_jni_object_to_string(env, value);
     //LOGI("%s: obj=%s, fid=%s, value=%s", "SetObjectField", object_name.c_str(), field_info.c_str(), value_info.c_str());
-    trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t) obj));
-    trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t) fid));
-    trace_info->fun_call->args.push_back(fmt::format("value={} {:#x}", value_info, (uintptr_t) value));
+    DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);
+    DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);
+    DispatchBase::capture_labeled(trace_info, "value", value_info, (uintptr_t) value);
 }
 
 // static void SetBooleanField(JNIEnv *env, jobject obj, jfieldID fieldID, jboolean value)
@@ -491,9 +496,9 @@ static void SetBooleanField(inst_trace_info_t *trace_info) {
     auto field_info = get_jni_field_signature(env, fid);
     //LOGI("%s: obj=%s, fid=%s, value=%s", "SetBooleanField", object_name.c_str(), field_info.c_str(),
     //value ? "true" : "false");
-    trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t) obj));
-    trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t) fid));
-    trace_info->fun_call->args.push_back(fmt::format("value={}", value ? "true" : "false"));
+    DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);
+    DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);
+    DispatchBase::capture_text(trace_info, "value", value ? "true" : "false");
 }
 
 static void SetByteField(inst_trace_info_t *trace_info) {
@@ -504,9 +509,9 @@ static void SetByteField(inst_trace_info_t *trace_info) {
     auto object_name = get_jni_jobject_name(env, obj);
     auto field_info = get_jni_field_signature(env, fid);
     //LOGI("%s: obj=%s, fid=%s, value=%d", "SetByteField", object_name.c_str(), field_info.c_str(), value);
-    trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t) obj));
-    trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t) fid));
-    trace_info->fun_call->args.push_back(fmt::format("value={}", value));
+    DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);
+    DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);
+    DispatchBase::capture_value(trace_info, "value", kCallArgSigned, value);
 }
 
 static void SetCharField(inst_trace_info_t *trace_info) {
@@ -517,9 +522,9 @@ static void SetCharField(inst_trace_info_t *trace_info) {
     auto object_name = get_jni_jobject_name(env, obj);
     auto field_info = get_jni_field_signature(env, fid);
     //LOGI("%s: obj=%s, fid=%s, value=%d", "SetCharField", object_name.c_str(), field_info.c_str(), value);
-    trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t) obj));
-    trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t) fid));
-    trace_info->fun_call->args.push_back(fmt::format("value={}", value));
+    DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);
+    DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);
+    DispatchBase::capture_value(trace_info, "value", kCallArgUnsigned, value);
 }
 
 static void SetShortField(inst_trace_info_t *trace_info) {
@@ -530,9 +535,9 @@ static void SetShortField(inst_trace_info_t *trace_info) {
     auto object_name = get_jni_jobject_name(env, obj);
     auto field_info = get_jni_field_signature(env, fid);
     //LOGI("%s: obj=%s, fid=%s, value=%d", "SetShortField", object_name.c_str(), field_info.c_str(), value);
-    trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t) obj));
-    trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t) fid));
-    trace_info->fun_call->args.push_back(fmt::format("value={}", value));
+    DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);
+    DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);
+    DispatchBase::capture_value(trace_info, "value", kCallArgSigned, value);
 }
 
 static void SetIntField(inst_trace_info_t *trace_info) {
@@ -543,9 +548,9 @@ static void SetIntField(inst_trace_info_t *trace_info) {
     auto object_name = get_jni_jobject_name(env, obj);
     auto field_info = get_jni_field_signature(env, fid);
     //LOGI("%s: obj=%s, fid=%s, value=%d", "SetIntField", object_name.c_str(), field_info.c_str(), value);
-    trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t) obj));
-    trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t) fid));
-    trace_info->fun_call->args.push_back(fmt::format("value={}", value));
+    DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);
+    DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);
+    DispatchBase::capture_value(trace_info, "value", kCallArgSigned, value);
 }
 
 static void SetLongField(inst_trace_info_t *trace_info) {
@@ -556,9 +561,9 @@ static void SetLongField(inst_trace_info_t *trace_info) {
     auto object_name = get_jni_jobject_name(env, obj);
     auto field_info = get_jni_field_signature(env, fid);
     //LOGI("%s: obj=%s, fid=%s, value=%ld", "SetLongField", object_name.c_str(), field_info.c_str(), value);
-    trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t) obj));
-    trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t) fid));
-    trace_info->fun_call->args.push_back(fmt::format("value={}", value));
+    DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);
+    DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);
+    DispatchBase::capture_value(trace_info, "value", kCallArgSigned, value);
 }
 
 static void SetFloatField(inst_trace_info_t *trace_info) {
@@ -569,9 +574,9 @@ static void SetFloatField(inst_trace_info_t *trace_info) {
     auto object_name = get_jni_jobject_name(env, obj);
     auto field_info = get_jni_field_signature(env, fid);
     //LOGI("%s: obj=%s, fid=%s, value=%f", "SetFloatField", object_name.c_str(), field_info.c_str(), value);
-    trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t) obj));
-    trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t) fid));
-    trace_info->fun_call->args.push_back(fmt::format("value={}", value));
+    DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);
+    DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);
+    DispatchBase::capture_double(trace_info, "value", value);
 }
 
 static void SetDoubleField(inst_trace_info_t *trace_info) {
@@ -582,9 +587,9 @@ static void SetDoubleField(inst_trace_info_t *trace_info) {
     auto object_name = get_jni_jobject_name(env, obj);
     auto field_info = get_jni_field_signature(env, fid);
     //LOGI("%s: obj=%s, fid=%s, value=%f", "SetDoubleField", object_name.c_str(), field_info.c_str(), value);
-    trace_info->fun_call->args.push_back(fmt::format("obj={} {:#x}", object_name, (uintptr_t) obj));
-    trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t) fid));
-    trace_info->fun_call->args.push_back(fmt::format("value={}", value));
+    DispatchBase::capture_labeled(trace_info, "obj", object_name, (uintptr_t) obj);
+    DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);
+    DispatchBase::capture_double(trace_info, "value", value);
 }
 
 // static jmethodID GetStaticMethodID(JNIEnv *env, jclass java_class, const char *name,const char *sig)
@@ -595,9 +600,9 @@ static void GetStaticMethodID(inst_trace_info_t *trace_info) {
     auto sig = reinterpret_cast<const char *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 3));
     auto class_name = get_jni_class_or_java_class_name(env, java_class);
     //LOGI("%s: java_class=%s, name=%s, sig=%s", "GetStaticMethodID", class_name.c_str(), name, sig);
-    trace_info->fun_call->args.push_back(fmt::format("java_class={} {:#x}", class_name, (uintptr_t) java_class));
-    trace_info->fun_call->args.push_back(fmt::format("name={}", name));
-    trace_info->fun_call->args.push_back(fmt::format("sig={}", sig));
+    DispatchBase::capture_labeled(trace_info, "java_class", class_name, (uintptr_t) java_class);
+    DispatchBase::capture_string(trace_info, "name", (uintptr_t) name);
+    DispatchBase::capture_string(trace_info, "sig", (uintptr_t) sig);
 }
 
 //JNIEnv *env, jclass clazz, jmethodID mid,
@@ -609,8 +614,8 @@ static void GetStaticMethodID(inst_trace_info_t *trace_info) {
     auto mid = reinterpret_cast<jmethodID>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));\
     auto class_name = get_jni_class_or_java_class_name(env, clazz);\
     auto method_info = get_jni_method_signature(env, mid);\
-    trace_info->fun_call->args.push_back(fmt::format("clazz={} {:#x}", class_name, (uintptr_t)clazz));\
-    trace_info->fun_call->args.push_back(fmt::format("mid={} {:#x}", method_info, (uintptr_t)mid));\
+    DispatchBase::capture_labeled(trace_info, "clazz", class_name, (uintptr_t) clazz);\
+    DispatchBase::capture_labeled(trace_info, "mid", method_info, (uintptr_t) mid);\
     }
 
 #define PROXY_CALL_STATIC_TYPE_METHODV(_jname)                                                      \
@@ -621,8 +626,8 @@ static void GetStaticMethodID(inst_trace_info_t *trace_info) {
     auto mid = reinterpret_cast<jmethodID>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));\
     auto class_name = get_jni_class_or_java_class_name(env, clazz);\
     auto method_info = get_jni_method_signature(env, mid);\
-    trace_info->fun_call->args.push_back(fmt::format("clazz={} {:#x}", class_name, (uintptr_t)clazz));\
-    trace_info->fun_call->args.push_back(fmt::format("mid={} {:#x}", method_info, (uintptr_t)mid));\
+    DispatchBase::capture_labeled(trace_info, "clazz", class_name, (uintptr_t) clazz);\
+    DispatchBase::capture_labeled(trace_info, "mid", method_info, (uintptr_t) mid);\
     }
 
 #define PROXY_CALL_STATIC_TYPE_METHODA(_jname)                                                      \
@@ -633,8 +638,8 @@ static void GetStaticMethodID(inst_trace_info_t *trace_info) {
     auto mid = reinterpret_cast<jmethodID>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));\
     auto class_name = get_jni_class_or_java_class_name(env, clazz);\
     auto method_info = get_jni_method_signature(env, mid);\
-    trace_info->fun_call->args.push_back(fmt::format("clazz={} {:#x}", class_name, (uintptr_t)clazz));\
-    trace_info->fun_call->args.push_back(fmt::format("mid={} {:#x}", method_info, (uintptr_t)mid));\
+    DispatchBase::capture_labeled(trace_info, "clazz", class_name, (uintptr_t) clazz);\
+    DispatchBase::capture_labeled(trace_info, "mid", method_info, (uintptr_t) mid);\
     }
 #define PROXY_CALL_STATIC_TYPE(_jname)                                    \
     PROXY_CALL_STATIC_TYPE_METHOD(_jname)                                 \
@@ -668,9 +673,9 @@ static void GetStaticFieldID(inst_trace_info_t *trace_info) {
     auto name = reinterpret_cast<const char *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));
     auto sig = reinterpret_cast<const char *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 3));
     auto class_name = get_jni_class_or_java_class_name(env, java_class);
-    trace_info->fun_call->args.push_back(fmt::format("java_class={} {:#x}", class_name, (uintptr_t) java_class));
-    trace_info->fun_call->args.push_back(fmt::format("name={}", name));
-    trace_info->fun_call->args.push_back(fmt::format("sig={}", sig));
+    DispatchBase::capture_labeled(trace_info, "java_class", class_name, (uintptr_t) java_class);
+    DispatchBase::capture_string(trace_info, "name", (uintptr_t) name);
+    DispatchBase::capture_string(trace_info, "sig", (uintptr_t) sig);
 }
 
 #define PROXY_GET_STATIC_TYPE_Field(_jname)                                             \
@@ -681,8 +686,8 @@ static void GetStaticFieldID(inst_trace_info_t *trace_info) {
         auto fid = reinterpret_cast<jfieldID>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));\
         auto class_name = get_jni_class_or_java_class_name(env, clazz);\
         auto field_info = get_jni_field_signature(env, fid);\
-        trace_info->fun_call->args.push_back(fmt::format("clazz={} {:#x}", class_name, (uintptr_t)clazz));\
-        trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t)fid));\
+        DispatchBase::capture_labeled(trace_info, "clazz", class_name, (uintptr_t) clazz);\
+        DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);\
     }
 
 PROXY_GET_STATIC_TYPE_Field(Object)
@@ -712,9 +717,9 @@ static void SetStaticObjectField(inst_trace_info_t *trace_info) {
     auto class_name = get_jni_class_or_java_class_name(env, clazz);
     auto field_info = get_jni_field_signature(env, fid);
     auto value_info = get_jni_object_to_string(env, value);
-    trace_info->fun_call->args.push_back(fmt::format("clazz={} {:#x}", class_name, (uintptr_t) clazz));
-    trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t) fid));
-    trace_info->fun_call->args.push_back(fmt::format("value={} {:#x}", value_info, (uintptr_t) value));
+    DispatchBase::capture_labeled(trace_info, "clazz", class_name, (uintptr_t) clazz);
+    DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);
+    DispatchBase::capture_labeled(trace_info, "value", value_info, (uintptr_t) value);
 }
 
 static void SetStaticBooleanField(inst_trace_info_t *trace_info) {
@@ -724,10 +729,9 @@ static void SetStaticBooleanField(inst_trace_info_t *trace_info) {
     auto value = (jboolean) (DispatchBase::get_arg_register_value(&trace_info->pre_status, 3));
     auto class_name = get_jni_class_or_java_class_name(env, clazz);
     auto field_info = get_jni_field_signature(env, fid);
-    trace_info->fun_call->args.push_back(fmt::format("clazz={} {:#x}", class_name, (uintptr_t) clazz));
-    trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t) fid));
-    trace_info->fun_call->args.push_back(fmt::format(
-            "value={}", value ? "true" : "false"));
+    DispatchBase::capture_labeled(trace_info, "clazz", class_name, (uintptr_t) clazz);
+    DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);
+    DispatchBase::capture_text(trace_info, "value", value ? "true" : "false");
 }
 
 static void SetStaticByteField(inst_trace_info_t *trace_info) {
@@ -737,9 +741,9 @@ static void SetStaticByteField(inst_trace_info_t *trace_info) {
     auto value = (jbyte) (DispatchBase::get_arg_register_value(&trace_info->pre_status, 3));
     auto class_name = get_jni_class_or_java_class_name(env, clazz);
     auto field_info = get_jni_field_signature(env, fid);
-    trace_info->fun_call->args.push_back(fmt::format("clazz={} {:#x}", class_name, (uintptr_t) clazz));
-    trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t) fid));
-    trace_info->fun_call->args.push_back(fmt::format("value={}", value));
+    DispatchBase::capture_labeled(trace_info, "clazz", class_name, (uintptr_t) clazz);
+    DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);
+    DispatchBase::capture_value(trace_info, "value", kCallArgSigned, value);
 }
 
 static void SetStaticCharField(inst_trace_info_t *trace_info) {
@@ -749,9 +753,9 @@ static void SetStaticCharField(inst_trace_info_t *trace_info) {
     auto value = (jchar) (DispatchBase::get_arg_register_value(&trace_info->pre_status, 3));
     auto class_name = get_jni_class_or_java_class_name(env, clazz);
     auto field_info = get_jni_field_signature(env, fid);
-    trace_info->fun_call->args.push_back(fmt::format("clazz={} {:#x}", class_name, (uintptr_t) clazz));
-    trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t) fid));
-    trace_info->fun_call->args.push_back(fmt::format("value={}", value));
+    DispatchBase::capture_labeled(trace_info, "clazz", class_name, (uintptr_t) clazz);
+    DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);
+    DispatchBase::capture_value(trace_info, "value", kCallArgUnsigned, value);
 }
 
 static void SetStaticShortField(inst_trace_info_t *trace_info) {
@@ -761,9 +765,9 @@ static void SetStaticShortField(inst_trace_info_t *trace_info) {
     auto value = (jshort) (DispatchBase::get_arg_register_value(&trace_info->pre_status, 3));
     auto class_name = get_jni_class_or_java_class_name(env, clazz);
     auto field_info = get_jni_field_signature(env, fid);
-    trace_info->fun_call->args.push_back(fmt::format("clazz={} {:#x}", class_name, (uintptr_t) clazz));
-    trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t) fid));
-    trace_info->fun_call->args.push_back(fmt::format("value={}", value));
+    DispatchBase::capture_labeled(trace_info, "clazz", class_name, (uintptr_t) clazz);
+    DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);
+    DispatchBase::capture_value(trace_info, "value", kCallArgSigned, value);
 }
 
 static void SetStaticIntField(inst_trace_info_t *trace_info) {
@@ -774,9 +778,9 @@ static void SetStaticIntField(inst_trace_info_t *trace_info) {
     auto class_name = get_jni_class_or_java_class_name(env, clazz);
     auto field_info = get_jni_field_signature(env, fid);
     //LOGI("%s: clazz=%s, fid=%s, value=%d", "SetStaticIntField", class_name.c_str(), field_info.c_str(), value);
-    trace_info->fun_call->args.push_back(fmt::format("clazz={} {:#x}", class_name, (uintptr_t) clazz));
-    trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t) fid));
-    trace_info->fun_call->args.push_back(fmt::format("value={}", value));
+    DispatchBase::capture_labeled(trace_info, "clazz", class_name, (uintptr_t) clazz);
+    DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);
+    DispatchBase::capture_value(trace_info, "value", kCallArgSigned, value);
 }
 
 static void SetStaticLongField(inst_trace_info_t *trace_info) {
@@ -787,9 +791,9 @@ static void SetStaticLongField(inst_trace_info_t *trace_info) {
     auto class_name = get_jni_class_or_java_class_name(env, clazz);
     auto field_info = get_jni_field_signature(env, fid);
     //LOGI("%s: clazz=%s, fid=%s, value=%ld", "SetStaticLongField", class_name.c_str(), field_info.c_str(), value);
-    trace_info->fun_call->args.push_back(fmt::format("clazz={} {:#x}", class_name, (uintptr_t) clazz));
-    trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t) fid));
-    trace_info->fun_call->args.push_back(fmt::format("value={}", value));
+    DispatchBase::capture_labeled(trace_info, "clazz", class_name, (uintptr_t) clazz);
+    DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);
+    DispatchBase::capture_value(trace_info, "value", kCallArgSigned, value);
 }
 
 static void SetStaticFloatField(inst_trace_info_t *trace_info) {
@@ -800,9 +804,9 @@ static void SetStaticFloatField(inst_trace_info_t *trace_info) {
     auto class_name = get_jni_class_or_java_class_name(env, clazz);
     auto field_info = get_jni_field_signature(env, fid);
     //LOGI("%s: clazz=%s, fid=%s, value=%f", "SetStaticFloatField", class_name.c_str(), field_info.c_str(), value);
-    trace_info->fun_call->args.push_back(fmt::format("clazz={} {:#x}", class_name, (uintptr_t) clazz));
-    trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t) fid));
-    trace_info->fun_call->args.push_back(fmt::format("value={}", value));
+    DispatchBase::capture_labeled(trace_info, "clazz", class_name, (uintptr_t) clazz);
+    DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);
+    DispatchBase::capture_double(trace_info, "value", value);
 }
 
 
@@ -814,9 +818,9 @@ static void SetStaticDoubleField(inst_trace_info_t *trace_info) {
     auto class_name = get_jni_class_or_java_class_name(env, clazz);
     auto field_info = get_jni_field_signature(env, fid);
     //LOGI("%s: clazz=%s, fid=%s, value=%f", "SetStaticDoubleField", class_name.c_str(), field_info.c_str(), value);
-    trace_info->fun_call->args.push_back(fmt::format("clazz={} {:#x}", class_name, (uintptr_t) clazz));
-    trace_info->fun_call->args.push_back(fmt::format("fid={} {:#x}", field_info, (uintptr_t) fid));
-    trace_info->fun_call->args.push_back(fmt::format("value={}", value));
+    DispatchBase::capture_labeled(trace_info, "clazz", class_name, (uintptr_t) clazz);
+    DispatchBase::capture_labeled(trace_info, "fid", field_info, (uintptr_t) fid);
+    DispatchBase::capture_double(trace_info, "value", value);
 }
 
 //NewString
@@ -826,8 +830,8 @@ static void NewString(inst_trace_info_t *trace_info) {
     auto str_len = (jsize) (DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));
     std::wstring wstr = std::wstring(str, str + str_len);
     //LOGI("%s: str=%ls, str_len=%d", "NewString", wstr.c_str(), str_len);
-    trace_info->fun_call->args.push_back(fmt::format("str={:#x}", static_cast<void *>(str)));
-    trace_info->fun_call->args.push_back(fmt::format("str_len={}", str_len));
+    DispatchBase::capture_value(trace_info, "str", kCallArgHex, (uintptr_t) str);
+    DispatchBase::capture_value(trace_info, "str_len", kCallArgSigned, str_len);
 }
 
 //GetStringLength
@@ -836,8 +840,8 @@ static void GetStringLength(inst_trace_info_t *trace_info) {
     auto str = reinterpret_cast<jstring>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     auto len = env->GetStringLength(str);
     //LOGI("%s: str:%p len=%d", "GetStringLength", str, len);
-    trace_info->fun_call->args.push_back(fmt::format("str={:#x}", (uintptr_t) str));
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
+    DispatchBase::capture_value(trace_info, "str", kCallArgHex, (uintptr_t) str);
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
 }
 
 //GetStringChars
@@ -848,8 +852,8 @@ static void GetStringChars(inst_trace_info_t *trace_info) {
     auto chars = env->GetStringChars(str, nullptr);
     std::wstring wstr = std::wstring(chars, chars + env->GetStringLength(str));
     //LOGI("%s: str=%ls, copy=%d", "GetStringChars", wstr.c_str(), copy);
-    trace_info->fun_call->args.push_back(fmt::format("str={:#x}", (uintptr_t) str));
-    trace_info->fun_call->args.push_back(fmt::format("copy={}", copy));
+    DispatchBase::capture_value(trace_info, "str", kCallArgHex, (uintptr_t) str);
+    DispatchBase::capture_value(trace_info, "copy", kCallArgUnsigned, copy);
     env->ReleaseStringChars(str, chars);
 }
 
@@ -859,8 +863,8 @@ static void ReleaseStringChars(inst_trace_info_t *trace_info) {
     auto str = reinterpret_cast<jstring>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     auto chars = reinterpret_cast<const jchar *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));
     //LOGI("%s: str:%p chars=%p", "ReleaseStringChars", str, chars);
-    trace_info->fun_call->args.push_back(fmt::format("str={:#x}", (uintptr_t) str));
-    trace_info->fun_call->args.push_back(fmt::format("chars={}", (uintptr_t) chars));
+    DispatchBase::capture_value(trace_info, "str", kCallArgHex, (uintptr_t) str);
+    DispatchBase::capture_value(trace_info, "chars", kCallArgHex, (uintptr_t) chars);
 }
 
 //static jstring NewStringUTF(JNIEnv *env, const char *bytes)
@@ -868,7 +872,7 @@ static void NewStringUTF(inst_trace_info_t *trace_info) {
     auto *env = reinterpret_cast<JNIEnv *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 0));
     auto str = reinterpret_cast<const char *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     //LOGI("%s: str=%s", "NewStringUTF", str);
-    trace_info->fun_call->args.push_back(fmt::format("str={}", str));
+    DispatchBase::capture_string(trace_info, "str", (uintptr_t) str);
 }
 
 // static jsize GetStringUTFLength(JNIEnv *env, jstring string)
@@ -877,8 +881,8 @@ static void GetStringUTFLength(inst_trace_info_t *trace_info) {
     auto str = reinterpret_cast<jstring>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     auto len = env->GetStringUTFLength(str);
     //LOGI("%s: str:%p len=%d", "GetStringUTFLength", str, len);
-    trace_info->fun_call->args.push_back(fmt::format("str={:#x}", (uintptr_t) str));
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
+    DispatchBase::capture_value(trace_info, "str", kCallArgHex, (uintptr_t) str);
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
 }
 
 //static const char *GetStringUTFChars(JNIEnv *env, jstring string, jboolean *isCopy)
@@ -888,8 +892,8 @@ static void GetStringUTFChars(inst_trace_info_t *trace_info) {
     auto copy = reinterpret_cast<jboolean *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));
     auto chars = env->GetStringUTFChars(str, copy);
     //LOGI("%s: str:%p chars=%p", "GetStringUTFChars", str, chars);
-    trace_info->fun_call->args.push_back(fmt::format("str={:#x}", (uintptr_t) str));
-    trace_info->fun_call->args.push_back(fmt::format("chars={}", chars));
+    DispatchBase::capture_value(trace_info, "str", kCallArgHex, (uintptr_t) str);
+    DispatchBase::capture_string(trace_info, "chars", (uintptr_t) chars);
     env->ReleaseStringUTFChars(str, chars);
 }
 
@@ -899,8 +903,8 @@ static void ReleaseStringUTFChars(inst_trace_info_t *trace_info) {
     auto str = reinterpret_cast<jstring>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     auto chars = reinterpret_cast<const char *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));
     //LOGI("%s: str:%p chars=%p", "ReleaseStringUTFChars", str, chars);
-    trace_info->fun_call->args.push_back(fmt::format("str={:#x}", (uintptr_t) str));
-    trace_info->fun_call->args.push_back(fmt::format("chars={}", chars));
+    DispatchBase::capture_value(trace_info, "str", kCallArgHex, (uintptr_t) str);
+    DispatchBase::capture_string(trace_info, "chars", (uintptr_t) chars);
 }
 
 //static jsize GetArrayLength(JNIEnv *env, jarray array) {
@@ -909,8 +913,8 @@ static void GetArrayLength(inst_trace_info_t *trace_info) {
     auto array = reinterpret_cast<jarray>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     auto len = env->GetArrayLength(array);
     //LOGI("%s: array:%p len=%d", "GetArrayLength", array, len);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
 }
 
 //static jobjectArray NewObjectArray(JNIEnv *env, jsize length, jclass elementClass, jobject initialElement)
@@ -921,9 +925,9 @@ static void NewObjectArray(inst_trace_info_t *trace_info) {
     auto initialElement = reinterpret_cast<jobject>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 3));
     auto element_info = get_jni_class_or_java_class_name(env, elementClass);
     //LOGI("%s: len=%d elementClass=%s initialElement=%p", "NewObjectArray", len, element_info.c_str(), initialElement);
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
-    trace_info->fun_call->args.push_back(fmt::format("elementClass={}", element_info));
-    trace_info->fun_call->args.push_back(fmt::format("initialElement={:#x}", (uintptr_t) initialElement));
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
+    DispatchBase::capture_text(trace_info, "elementClass", element_info);
+    DispatchBase::capture_value(trace_info, "initialElement", kCallArgHex, (uintptr_t) initialElement);
 }
 
 //static jobject GetObjectArrayElement(JNIEnv *env, jobjectArray array, jsize index)
@@ -932,8 +936,8 @@ static void GetObjectArrayElement(inst_trace_info_t *trace_info) {
     auto array = reinterpret_cast<jobjectArray>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     auto index = (jsize) DispatchBase::get_arg_register_value(&trace_info->pre_status, 2);
     //LOGI("%s: array:%p index=%d ", "GetObjectArrayElement", array, index);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("index={}", index));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "index", kCallArgSigned, index);
 }
 
 // static void SetObjectArrayElement(JNIEnv *env, jobjectArray array, jsize index, jobject val)
@@ -944,9 +948,9 @@ static void SetObjectArrayElement(inst_trace_info_t *trace_info) {
     auto val = reinterpret_cast<jobject>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 3));
     auto val_info = get_jni_object_to_string(env, val);
     //LOGI("%s: array:%p index=%d val=%p", "SetObjectArrayElement", array, index, val_info.c_str());
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("index={}", index));
-    trace_info->fun_call->args.push_back(fmt::format("val={}", val_info));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "index", kCallArgSigned, index);
+    DispatchBase::capture_text(trace_info, "val", val_info);
 }
 
 
@@ -955,7 +959,7 @@ static void SetObjectArrayElement(inst_trace_info_t *trace_info) {
     {\
         auto* env = reinterpret_cast<JNIEnv*>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 0));\
         auto len = (jsize)DispatchBase::get_arg_register_value(&trace_info->pre_status, 1);\
-        trace_info->fun_call->args.push_back(fmt::format("len={}", len));\
+        DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);\
     }
 
 
@@ -982,8 +986,8 @@ PROXY_New_Array(Double)
         auto* env = reinterpret_cast<JNIEnv*>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 0));\
         auto array = reinterpret_cast<_jtype>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));\
         auto isCopy = reinterpret_cast<jboolean*>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));\
-        trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t)array));\
-        trace_info->fun_call->args.push_back(fmt::format("isCopy={}", (bool)isCopy));\
+        DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);\
+        DispatchBase::capture_text(trace_info, "isCopy", isCopy != nullptr ? "true" : "false");\
     }
 
 PROXY_GET_Array_Elements(jbooleanArray, Boolean)
@@ -1008,9 +1012,9 @@ static void ReleaseBooleanArrayElements(inst_trace_info_t *trace_info) {
     auto array = reinterpret_cast<jbooleanArray>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     auto elems = reinterpret_cast<jboolean *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));
     auto mode = (jint) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("elems={:#x}", (uintptr_t) elems));
-    trace_info->fun_call->args.push_back(fmt::format("mode={}", mode));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "elems", kCallArgHex, (uintptr_t) elems);
+    DispatchBase::capture_value(trace_info, "mode", kCallArgSigned, mode);
 }
 
 static void ReleaseByteArrayElements(inst_trace_info_t *trace_info) {
@@ -1019,9 +1023,9 @@ static void ReleaseByteArrayElements(inst_trace_info_t *trace_info) {
     auto elems = reinterpret_cast<jbyte *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));
     auto mode = (jint) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     //LOGI("%s: array:%p elems=%p mode=%d", "ReleaseByteArrayElements", array, elems, mode);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("elems={:#x}", (uintptr_t) elems));
-    trace_info->fun_call->args.push_back(fmt::format("mode={}", mode));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "elems", kCallArgHex, (uintptr_t) elems);
+    DispatchBase::capture_value(trace_info, "mode", kCallArgSigned, mode);
 }
 
 static void ReleaseCharArrayElements(inst_trace_info_t *trace_info) {
@@ -1030,9 +1034,9 @@ static void ReleaseCharArrayElements(inst_trace_info_t *trace_info) {
     auto elems = reinterpret_cast<jchar *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));
     auto mode = (jint) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     //LOGI("%s: array:%p elems=%p mode=%d", "ReleaseCharArrayElements", array, elems, mode);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("elems={:#x}", (uintptr_t) elems));
-    trace_info->fun_call->args.push_back(fmt::format("mode={}", mode));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "elems", kCallArgHex, (uintptr_t) elems);
+    DispatchBase::capture_value(trace_info, "mode", kCallArgSigned, mode);
 }
 
 static void ReleaseShortArrayElements(inst_trace_info_t *trace_info) {
@@ -1041,7 +1045,7 @@ static void ReleaseShortArrayElements(inst_trace_info_t *trace_info) {
     auto elems = reinterpret_cast<jshort *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));
     auto mode = (jint) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     //LOGI("%s: array:%p elems=%p mode=%d", "ReleaseShortArrayElements", array, elems, mode);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
 }
 
 static void ReleaseIntArrayElements(inst_trace_info_t *trace_info) {
@@ -1050,9 +1054,9 @@ static void ReleaseIntArrayElements(inst_trace_info_t *trace_info) {
     auto elems = reinterpret_cast<jint *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));
     auto mode = (jint) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     //LOGI("%s: array:%p elems=%p mode=%d", "ReleaseIntArrayElements", array, elems, mode);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("elems={:#x}", (uintptr_t) elems));
-    trace_info->fun_call->args.push_back(fmt::format("mode={}", mode));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "elems", kCallArgHex, (uintptr_t) elems);
+    DispatchBase::capture_value(trace_info, "mode", kCallArgSigned, mode);
 }
 
 static void ReleaseLongArrayElements(inst_trace_info_t *trace_info) {
@@ -1061,9 +1065,9 @@ static void ReleaseLongArrayElements(inst_trace_info_t *trace_info) {
     auto elems = reinterpret_cast<jlong *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));
     auto mode = (jint) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     //LOGI("%s: array:%p elems=%p mode=%d", "ReleaseLongArrayElements", array, elems, mode);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("elems={:#x}", (uintptr_t) elems));
-    trace_info->fun_call->args.push_back(fmt::format("mode={}", mode));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "elems", kCallArgHex, (uintptr_t) elems);
+    DispatchBase::capture_value(trace_info, "mode", kCallArgSigned, mode);
 }
 
 static void ReleaseFloatArrayElements(inst_trace_info_t *trace_info) {
@@ -1072,9 +1076,9 @@ static void ReleaseFloatArrayElements(inst_trace_info_t *trace_info) {
     auto elems = reinterpret_cast<jfloat *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));
     auto mode = (jint) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     //LOGI("%s: array:%p elems=%p mode=%d", "ReleaseFloatArrayElements", array, elems, mode);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("elems={:#x}", (uintptr_t) elems));
-    trace_info->fun_call->args.push_back(fmt::format("mode={}", mode));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "elems", kCallArgHex, (uintptr_t) elems);
+    DispatchBase::capture_value(trace_info, "mode", kCallArgSigned, mode);
 }
 
 static void ReleaseDoubleArrayElements(inst_trace_info_t *trace_info) {
@@ -1083,9 +1087,9 @@ static void ReleaseDoubleArrayElements(inst_trace_info_t *trace_info) {
     auto elems = reinterpret_cast<jdouble *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 2));
     auto mode = (jint) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     //LOGI("%s: array:%p elems=%p mode=%d", "ReleaseDoubleArrayElements", array, elems, mode);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("elems={:#x}", (uintptr_t) elems));
-    trace_info->fun_call->args.push_back(fmt::format("mode={}", mode));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "elems", kCallArgHex, (uintptr_t) elems);
+    DispatchBase::capture_value(trace_info, "mode", kCallArgSigned, mode);
 }
 
 //void GetBooleanArrayRegion(jbooleanArray array, jsize start, jsize len,
@@ -1097,10 +1101,10 @@ static void GetByteArrayRegion(inst_trace_info_t *trace_info) {
     auto len = (jsize) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     auto buf = reinterpret_cast<jbyte *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 4));
     //LOGI("%s: array:%p start=%d len=%d buf=%p", "GetByteArrayRegion", array, start, len, buf);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("start={}", start));
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
-    trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", (uintptr_t) buf));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "start", kCallArgSigned, start);
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
+    DispatchBase::capture_value(trace_info, "buf", kCallArgHex, (uintptr_t) buf);
 }
 
 
@@ -1111,10 +1115,10 @@ static void GetBooleanArrayRegion(inst_trace_info_t *trace_info) {
     auto len = (jsize) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     auto buf = reinterpret_cast<jboolean *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 4));
     //LOGI("%s: array:%p start=%d len=%d buf=%p", "GetBooleanArrayRegion", array, start, len, buf);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("start={}", start));
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
-    trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", (uintptr_t) buf));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "start", kCallArgSigned, start);
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
+    DispatchBase::capture_value(trace_info, "buf", kCallArgHex, (uintptr_t) buf);
 }
 
 
@@ -1125,10 +1129,10 @@ static void GetCharArrayRegion(inst_trace_info_t *trace_info) {
     auto len = (jsize) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     auto buf = reinterpret_cast<jchar *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 4));
     //LOGI("%s: array:%p start=%d len=%d buf=%p", "GetCharArrayRegion", array, start, len, buf);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("start={}", start));
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
-    trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", (uintptr_t) buf));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "start", kCallArgSigned, start);
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
+    DispatchBase::capture_value(trace_info, "buf", kCallArgHex, (uintptr_t) buf);
 }
 
 static void GetShortArrayRegion(inst_trace_info_t *trace_info) {
@@ -1138,10 +1142,10 @@ static void GetShortArrayRegion(inst_trace_info_t *trace_info) {
     auto len = (jsize) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     auto buf = reinterpret_cast<jshort *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 4));
     //LOGI("%s: array:%p start=%d len=%d buf=%p", "GetShortArrayRegion", array, start, len, buf);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("start={}", start));
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
-    trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", (uintptr_t) buf));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "start", kCallArgSigned, start);
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
+    DispatchBase::capture_value(trace_info, "buf", kCallArgHex, (uintptr_t) buf);
 }
 
 static void GetIntArrayRegion(inst_trace_info_t *trace_info) {
@@ -1151,10 +1155,10 @@ static void GetIntArrayRegion(inst_trace_info_t *trace_info) {
     auto len = (jsize) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     auto buf = reinterpret_cast<jint *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 4));
     //LOGI("%s: array:%p start=%d len=%d buf=%p", "GetIntArrayRegion", array, start, len, buf);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("start={}", start));
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
-    trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", (uintptr_t) buf));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "start", kCallArgSigned, start);
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
+    DispatchBase::capture_value(trace_info, "buf", kCallArgHex, (uintptr_t) buf);
 }
 
 static void GetLongArrayRegion(inst_trace_info_t *trace_info) {
@@ -1164,10 +1168,10 @@ static void GetLongArrayRegion(inst_trace_info_t *trace_info) {
     auto len = (jsize) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     auto buf = reinterpret_cast<jlong *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 4));
     //LOGI("%s: array:%p start=%d len=%d buf=%p", "GetLongArrayRegion", array, start, len, buf);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("start={}", start));
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
-    trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", (uintptr_t) buf));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "start", kCallArgSigned, start);
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
+    DispatchBase::capture_value(trace_info, "buf", kCallArgHex, (uintptr_t) buf);
 }
 
 static void GetFloatArrayRegion(inst_trace_info_t *trace_info) {
@@ -1176,10 +1180,10 @@ static void GetFloatArrayRegion(inst_trace_info_t *trace_info) {
     auto start = (jsize) DispatchBase::get_arg_register_value(&trace_info->pre_status, 2);
     auto len = (jsize) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     auto buf = reinterpret_cast<jfloat *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 4));
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("start={}", start));
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
-    trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", (uintptr_t) buf));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "start", kCallArgSigned, start);
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
+    DispatchBase::capture_value(trace_info, "buf", kCallArgHex, (uintptr_t) buf);
 }
 
 static void GetDoubleArrayRegion(inst_trace_info_t *trace_info) {
@@ -1189,10 +1193,10 @@ static void GetDoubleArrayRegion(inst_trace_info_t *trace_info) {
     auto len = (jsize) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     auto buf = reinterpret_cast<jdouble *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 4));
     //LOGI("%s: array:%p start=%d len=%d buf=%p", "GetDoubleArrayRegion", array, start, len, buf);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("start={}", start));
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
-    trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", (uintptr_t) buf));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "start", kCallArgSigned, start);
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
+    DispatchBase::capture_value(trace_info, "buf", kCallArgHex, (uintptr_t) buf);
 }
 
 /*
@@ -1207,10 +1211,10 @@ static void SetBooleanArrayRegion(inst_trace_info_t *trace_info) {
     auto len = (jsize) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     auto buf = reinterpret_cast<jboolean *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 4));
     //LOGI("%s: array:%p start=%d len=%d buf=%p", "SetBooleanArrayRegion", array, start, len, buf);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("start={}", start));
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
-    trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", (uintptr_t) buf));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "start", kCallArgSigned, start);
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
+    DispatchBase::capture_value(trace_info, "buf", kCallArgHex, (uintptr_t) buf);
 }
 
 static void SetByteArrayRegion(inst_trace_info_t *trace_info) {
@@ -1220,10 +1224,10 @@ static void SetByteArrayRegion(inst_trace_info_t *trace_info) {
     auto len = (jsize) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     auto buf = reinterpret_cast<jbyte *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 4));
     //LOGI("%s: array:%p start=%d len=%d buf=%p", "SetByteArrayRegion", array, start, len, buf);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("start={}", start));
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
-    trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", (uintptr_t) buf));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "start", kCallArgSigned, start);
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
+    DispatchBase::capture_value(trace_info, "buf", kCallArgHex, (uintptr_t) buf);
 }
 
 static void SetCharArrayRegion(inst_trace_info_t *trace_info) {
@@ -1233,10 +1237,10 @@ static void SetCharArrayRegion(inst_trace_info_t *trace_info) {
     auto len = (jsize) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     auto buf = reinterpret_cast<jchar *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 4));
     //LOGI("%s: array:%p start=%d len=%d buf=%p", "SetCharArrayRegion", array, start, len, buf);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("start={}", start));
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
-    trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", (uintptr_t) buf));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "start", kCallArgSigned, start);
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
+    DispatchBase::capture_value(trace_info, "buf", kCallArgHex, (uintptr_t) buf);
 }
 
 static void SetShortArrayRegion(inst_trace_info_t *trace_info) {
@@ -1246,10 +1250,10 @@ static void SetShortArrayRegion(inst_trace_info_t *trace_info) {
     auto len = (jsize) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     auto buf = reinterpret_cast<jshort *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 4));
     //LOGI("%s: array:%p start=%d len=%d buf=%p", "SetShortArrayRegion", array, start, len, buf);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("start={}", start));
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
-    trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", (uintptr_t) buf));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "start", kCallArgSigned, start);
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
+    DispatchBase::capture_value(trace_info, "buf", kCallArgHex, (uintptr_t) buf);
 }
 
 static void SetIntArrayRegion(inst_trace_info_t *trace_info) {
@@ -1259,10 +1263,10 @@ static void SetIntArrayRegion(inst_trace_info_t *trace_info) {
     auto len = (jsize) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     auto buf = reinterpret_cast<jint *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 4));
     //LOGI("%s: array:%p start=%d len=%d buf=%p", "SetIntArrayRegion", array, start, len, buf);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("start={}", start));
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
-    trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", (uintptr_t) buf));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "start", kCallArgSigned, start);
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
+    DispatchBase::capture_value(trace_info, "buf", kCallArgHex, (uintptr_t) buf);
 }
 
 static void SetLongArrayRegion(inst_trace_info_t *trace_info) {
@@ -1272,10 +1276,10 @@ static void SetLongArrayRegion(inst_trace_info_t *trace_info) {
     auto len = (jsize) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     auto buf = reinterpret_cast<jlong *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 4));
     //LOGI("%s: array:%p start=%d len=%d buf=%p", "SetLongArrayRegion", array, start, len, buf);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("start={}", start));
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
-    trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", (uintptr_t) buf));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "start", kCallArgSigned, start);
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
+    DispatchBase::capture_value(trace_info, "buf", kCallArgHex, (uintptr_t) buf);
 }
 
 static void SetFloatArrayRegion(inst_trace_info_t *trace_info) {
@@ -1285,10 +1289,10 @@ static void SetFloatArrayRegion(inst_trace_info_t *trace_info) {
     auto len = (jsize) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     auto buf = reinterpret_cast<jfloat *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 4));
     //LOGI("%s: array:%p start=%d len=%d buf=%p", "SetFloatArrayRegion", array, start, len, buf);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("start={}", start));
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
-    trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", (uintptr_t) buf));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "start", kCallArgSigned, start);
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
+    DispatchBase::capture_value(trace_info, "buf", kCallArgHex, (uintptr_t) buf);
 }
 
 static void SetDoubleArrayRegion(inst_trace_info_t *trace_info) {
@@ -1298,10 +1302,10 @@ static void SetDoubleArrayRegion(inst_trace_info_t *trace_info) {
     auto len = (jsize) DispatchBase::get_arg_register_value(&trace_info->pre_status, 3);
     auto buf = reinterpret_cast<jdouble *>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 4));
     //LOGI("%s: array:%p start=%d len=%d buf=%p", "SetDoubleArrayRegion", array, start, len, buf);
-    trace_info->fun_call->args.push_back(fmt::format("array={:#x}", (uintptr_t) array));
-    trace_info->fun_call->args.push_back(fmt::format("start={}", start));
-    trace_info->fun_call->args.push_back(fmt::format("len={}", len));
-    trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", (uintptr_t) buf));
+    DispatchBase::capture_value(trace_info, "array", kCallArgHex, (uintptr_t) array);
+    DispatchBase::capture_value(trace_info, "start", kCallArgSigned, start);
+    DispatchBase::capture_value(trace_info, "len", kCallArgSigned, len);
+    DispatchBase::capture_value(trace_info, "buf", kCallArgHex, (uintptr_t) buf);
 }
 
 //    static jint RegisterNatives(JNIEnv *env, jclass clazz, const JNINativeMethod *methods,
@@ -1328,496 +1332,520 @@ static void UnregisterNatives(inst_trace_info_t *trace_info) {
     auto clazz = reinterpret_cast<jclass>(DispatchBase::get_arg_register_value(&trace_info->pre_status, 1));
     auto clazz_info = get_jni_class_or_java_class_name(env, clazz);
     LOGI("UnregisterNatives: clazz=%s", clazz_info.c_str());
-    trace_info->fun_call->args.push_back(fmt::format("clazz={}", clazz_info));
-}
-
-
-static const std::unordered_map<std::string, std::function<void(inst_trace_info_t *)>> arg_handlers_ = {
-        {"FindClass",                    FindClass},
-        {"FromReflectedMethod",          FromReflectedMethod},
-        {"FromReflectedField",           FromReflectedField},
-        {"ToReflectedField",             ToReflectedField},
-        {"ToReflectedMethod",            ToReflectedMethod},
-        {"GetObjectClass",               GetObjectClass},
-        {"GetSuperclass",                GetSuperclass},
-        {"IsAssignableFrom",             IsAssignableFrom},
-        {"Throw",                        Throw},
-        {"ThrowNew",                     ThrowNew},
-        {"PushLocalFrame",               PushLocalFrame},
-        {"PopLocalFrame",                PopLocalFrame},
-        {"NewGlobalRef",                 NewGlobalRef},
-        {"DeleteGlobalRef",              DeleteGlobalRef},
-        {"DeleteLocalRef",               DeleteLocalRef},
-        {"IsSameObject",                 IsSameObject},
-        {"NewLocalRef",                  NewLocalRef},
-        {"EnsureLocalCapacity",          EnsureLocalCapacity},
-        {"AllocObject",                  AllocObject},
-        {"NewObject",                    NewObject},
-        {"NewObjectV",                   NewObjectV},
-        {"NewObjectA",                   NewObjectA},
-        {"IsInstanceOf",                 IsInstanceOf},
-        {"GetMethodID",                  GetMethodID},
-        {"CallObjectMethod",             CallObjectMethod},
-        {"CallObjectMethodV",            CallObjectMethodV},
-        {"CallObjectMethodA",            CallObjectMethodA},
-        {"CallBooleanMethod",            CallBooleanMethod},
-        {"CallBooleanMethodV",           CallBooleanMethodV},
-        {"CallBooleanMethodA",           CallBooleanMethodA},
-        {"CallByteMethod",               CallByteMethod},
-        {"CallByteMethodV",              CallByteMethodV},
-        {"CallByteMethodA",              CallByteMethodA},
-        {"CallCharMethod",               CallCharMethod},
-        {"CallCharMethodV",              CallCharMethodV},
-        {"CallCharMethodA",              CallCharMethodA},
-        {"CallShortMethod",              CallShortMethod},
-        {"CallShortMethodV",             CallShortMethodV},
-        {"CallShortMethodA",             CallShortMethodA},
-        {"CallIntMethod",                CallIntMethod},
-        {"CallIntMethodV",               CallIntMethodV},
-        {"CallIntMethodA",               CallIntMethodA},
-        {"CallLongMethod",               CallLongMethod},
-        {"CallLongMethodV",              CallLongMethodV},
-        {"CallLongMethodA",              CallLongMethodA},
-        {"CallFloatMethod",              CallFloatMethod},
-        {"CallFloatMethodV",             CallFloatMethodV},
-        {"CallFloatMethodA",             CallFloatMethodA},
-        {"CallDoubleMethod",             CallDoubleMethod},
-        {"CallDoubleMethodV",            CallDoubleMethodV},
-        {"CallDoubleMethodA",            CallDoubleMethodA},
-        {"CallVoidMethod",               CallVoidMethod},
-        {"CallVoidMethodV",              CallVoidMethodV},
-        {"CallVoidMethodA",              CallVoidMethodA},
-        {"CallNonvirtualObjectMethod",   CallNonvirtualObjectMethod},
-        {"CallNonvirtualObjectMethodV",  CallNonvirtualObjectMethodV},
-        {"CallNonvirtualObjectMethodA",  CallNonvirtualObjectMethodA},
-        {"CallNonvirtualBooleanMethod",  CallNonvirtualBooleanMethod},
-        {"CallNonvirtualBooleanMethodV", CallNonvirtualBooleanMethodV},
-        {"CallNonvirtualBooleanMethodA", CallNonvirtualBooleanMethodA},
-        {"CallNonvirtualByteMethod",     CallNonvirtualByteMethod},
-        {"CallNonvirtualByteMethodV",    CallNonvirtualByteMethodV},
-        {"CallNonvirtualByteMethodA",    CallNonvirtualByteMethodA},
-        {"CallNonvirtualCharMethod",     CallNonvirtualCharMethod},
-        {"CallNonvirtualCharMethodV",    CallNonvirtualCharMethodV},
-        {"CallNonvirtualCharMethodA",    CallNonvirtualCharMethodA},
-        {"CallNonvirtualShortMethod",    CallNonvirtualShortMethod},
-        {"CallNonvirtualShortMethodV",   CallNonvirtualShortMethodV},
-        {"CallNonvirtualShortMethodA",   CallNonvirtualShortMethodA},
-        {"CallNonvirtualIntMethod",      CallNonvirtualIntMethod},
-        {"CallNonvirtualIntMethodV",     CallNonvirtualIntMethodV},
-        {"CallNonvirtualIntMethodA",     CallNonvirtualIntMethodA},
-        {"CallNonvirtualLongMethod",     CallNonvirtualLongMethod},
-        {"CallNonvirtualLongMethodV",    CallNonvirtualLongMethodV},
-        {"CallNonvirtualLongMethodA",    CallNonvirtualLongMethodA},
-        {"CallNonvirtualFloatMethod",    CallNonvirtualFloatMethod},
-        {"CallNonvirtualFloatMethodV",   CallNonvirtualFloatMethodV},
-        {"CallNonvirtualFloatMethodA",   CallNonvirtualFloatMethodA},
-        {"CallNonvirtualDoubleMethod",   CallNonvirtualDoubleMethod},
-        {"CallNonvirtualDoubleMethodV",  CallNonvirtualDoubleMethodV},
-        {"CallNonvirtualDoubleMethodA",  CallNonvirtualDoubleMethodA},
-        {"CallNonvirtualVoidMethod",     CallNonvirtualVoidMethod},
-        {"CallNonvirtualVoidMethodV",    CallNonvirtualVoidMethodV},
-        {"CallNonvirtualVoidMethodA",    CallNonvirtualVoidMethodA},
-        {"GetFieldID",                   GetFieldID},
-        {"GetObjectField",               GetObjectField},
-        {"GetBooleanField",              GetBooleanField},
-        {"GetByteField",                 GetByteField},
-        {"GetCharField",                 GetCharField},
-        {"GetShortField",                GetShortField},
-        {"GetIntField",                  GetIntField},
-        {"GetLongField",                 GetLongField},
-        {"GetFloatField",                GetFloatField},
-        {"GetDoubleField",               GetDoubleField},
-        {"SetObjectField",               SetObjectField},
-        {"SetBooleanField",              SetBooleanField},
-        {"SetByteField",                 SetByteField},
-        {"SetCharField",                 SetCharField},
-        {"SetShortField",                SetShortField},
-        {"SetIntField",                  SetIntField},
-        {"SetLongField",                 SetLongField},
-        {"SetFloatField",                SetFloatField},
-        {"SetDoubleField",               SetDoubleField},
-        {"GetStaticMethodID",            GetStaticMethodID},
-        {"CallStaticObjectMethod",       CallStaticObjectMethod},
-        {"CallStaticObjectMethodV",      CallStaticObjectMethodV},
-        {"CallStaticObjectMethodA",      CallStaticObjectMethodA},
-        {"CallStaticBooleanMethod",      CallStaticBooleanMethod},
-        {"CallStaticBooleanMethodV",     CallStaticBooleanMethodV},
-        {"CallStaticBooleanMethodA",     CallStaticBooleanMethodA},
-        {"CallStaticByteMethod",         CallStaticByteMethod},
-        {"CallStaticByteMethodV",        CallStaticByteMethodV},
-        {"CallStaticByteMethodA",        CallStaticByteMethodA},
-        {"CallStaticCharMethod",         CallStaticCharMethod},
-        {"CallStaticCharMethodV",        CallStaticCharMethodV},
-        {"CallStaticCharMethodA",        CallStaticCharMethodA},
-        {"CallStaticShortMethod",        CallStaticShortMethod},
-        {"CallStaticShortMethodV",       CallStaticShortMethodV},
-        {"CallStaticShortMethodA",       CallStaticShortMethodA},
-        {"CallStaticIntMethod",          CallStaticIntMethod},
-        {"CallStaticIntMethodV",         CallStaticIntMethodV},
-        {"CallStaticIntMethodA",         CallStaticIntMethodA},
-        {"CallStaticLongMethod",         CallStaticLongMethod},
-        {"CallStaticLongMethodV",        CallStaticLongMethodV},
-        {"CallStaticLongMethodA",        CallStaticLongMethodA},
-        {"CallStaticFloatMethod",        CallStaticFloatMethod},
-        {"CallStaticFloatMethodV",       CallStaticFloatMethodV},
-        {"CallStaticFloatMethodA",       CallStaticFloatMethodA},
-        {"CallStaticDoubleMethod",       CallStaticDoubleMethod},
-        {"CallStaticDoubleMethodV",      CallStaticDoubleMethodV},
-        {"CallStaticDoubleMethodA",      CallStaticDoubleMethodA},
-        {"CallStaticVoidMethod",         CallStaticVoidMethod},
-        {"CallStaticVoidMethodV",        CallStaticVoidMethodV},
-        {"CallStaticVoidMethodA",        CallStaticVoidMethodA},
-        {"GetStaticFieldID",             GetStaticFieldID},
-        {"GetStaticObjectField",         GetStaticObjectField},
-        {"GetStaticBooleanField",        GetStaticBooleanField},
-        {"GetStaticByteField",           GetStaticByteField},
-        {"GetStaticCharField",           GetStaticCharField},
-        {"GetStaticShortField",          GetStaticShortField},
-        {"GetStaticIntField",            GetStaticIntField},
-        {"GetStaticLongField",           GetStaticLongField},
-        {"GetStaticFloatField",          GetStaticFloatField},
-        {"GetStaticDoubleField",         GetStaticDoubleField},
-        {"SetStaticObjectField",         SetStaticObjectField},
-        {"SetStaticBooleanField",        SetStaticBooleanField},
-        {"SetStaticByteField",           SetStaticByteField},
-        {"SetStaticCharField",           SetStaticCharField},
-        {"SetStaticShortField",          SetStaticShortField},
-        {"SetStaticIntField",            SetStaticIntField},
-        {"SetStaticLongField",           SetStaticLongField},
-        {"SetStaticFloatField",          SetStaticFloatField},
-        {"SetStaticDoubleField",         SetStaticDoubleField},
-        {"NewString",                    NewString},
-        {"GetStringLength",              GetStringLength},
-        {"GetStringChars",               GetStringChars},
-        {"ReleaseStringChars",           ReleaseStringChars},
-        {"NewStringUTF",                 NewStringUTF},
-        {"GetStringUTFLength",           GetStringUTFLength},
-        {"ReleaseStringUTFChars",        ReleaseStringUTFChars},
-        {"GetArrayLength",               GetArrayLength},
-        {"NewObjectArray",               NewObjectArray},
-        {"GetObjectArrayElement",        GetObjectArrayElement},
-        {"SetObjectArrayElement",        SetObjectArrayElement},
-        {"NewBooleanArray",              NewBooleanArray},
-        {"NewByteArray",                 NewByteArray},
-        {"NewCharArray",                 NewCharArray},
-        {"NewShortArray",                NewShortArray},
-        {"NewIntArray",                  NewIntArray},
-        {"NewLongArray",                 NewLongArray},
-        {"NewFloatArray",                NewFloatArray},
-        {"NewDoubleArray",               NewDoubleArray},
-        {"GetBooleanArrayElements",      GetBooleanArrayElements},
-        {"GetByteArrayElements",         GetByteArrayElements},
-        {"GetCharArrayElements",         GetCharArrayElements},
-        {"GetShortArrayElements",        GetShortArrayElements},
-        {"GetIntArrayElements",          GetIntArrayElements},
-        {"GetLongArrayElements",         GetLongArrayElements},
-        {"GetFloatArrayElements",        GetFloatArrayElements},
-        {"GetDoubleArrayElements",       GetDoubleArrayElements},
-        {"ReleaseBooleanArrayElements",  ReleaseBooleanArrayElements},
-        {"ReleaseByteArrayElements",     ReleaseByteArrayElements},
-        {"ReleaseCharArrayElements",     ReleaseCharArrayElements},
-        {"ReleaseShortArrayElements",    ReleaseShortArrayElements},
-        {"ReleaseIntArrayElements",      ReleaseIntArrayElements},
-        {"ReleaseLongArrayElements",     ReleaseLongArrayElements},
-        {"ReleaseFloatArrayElements",    ReleaseFloatArrayElements},
-        {"ReleaseDoubleArrayElements",   ReleaseDoubleArrayElements},
-        {"GetBooleanArrayRegion",        GetBooleanArrayRegion},
-        {"GetByteArrayRegion",           GetByteArrayRegion},
-        {"GetCharArrayRegion",           GetCharArrayRegion},
-        {"GetShortArrayRegion",          GetShortArrayRegion},
-        {"GetIntArrayRegion",            GetIntArrayRegion},
-        {"GetLongArrayRegion",           GetLongArrayRegion},
-        {"GetFloatArrayRegion",          GetFloatArrayRegion},
-        {"GetDoubleArrayRegion",         GetDoubleArrayRegion},
-        {"SetBooleanArrayRegion",        SetBooleanArrayRegion},
-        {"SetByteArrayRegion",           SetByteArrayRegion},
-        {"SetCharArrayRegion",           SetCharArrayRegion},
-        {"SetShortArrayRegion",          SetShortArrayRegion},
-        {"SetIntArrayRegion",            SetIntArrayRegion},
-        {"SetLongArrayRegion",           SetLongArrayRegion},
-        {"SetFloatArrayRegion",          SetFloatArrayRegion},
-        {"SetDoubleArrayRegion",         SetDoubleArrayRegion},
-        {"RegisterNatives",              RegisterNatives},
-        {"UnregisterNatives",            UnregisterNatives},
-};
-
-
-void DispatchJNIEnv::dispatch_env(std::string name, inst_trace_info_t *trace_info) {
+    DispatchBase::capture_text(trace_info, "clazz", clazz_info);
+}
+
+
+// every function of JNINativeInterface in slot order, the reserved slots are left out
+#define JNI_ENV_FUNCTIONS(V) \
+    V(GetVersion) \
+    V(DefineClass) \
+    V(FindClass) \
+    V(FromReflectedMethod) \
+    V(FromReflectedField) \
+    V(ToReflectedMethod) \
+    V(GetSuperclass) \
+    V(IsAssignableFrom) \
+    V(ToReflectedField) \
+    V(Throw) \
+    V(ThrowNew) \
+    V(ExceptionOccurred) \
+    V(ExceptionDescribe) \
+    V(ExceptionClear) \
+    V(FatalError) \
+    V(PushLocalFrame) \
+    V(PopLocalFrame) \
+    V(NewGlobalRef) \
+    V(DeleteGlobalRef) \
+    V(DeleteLocalRef) \
+    V(IsSameObject) \
+    V(NewLocalRef) \
+    V(EnsureLocalCapacity) \
+    V(AllocObject) \
+    V(NewObject) \
+    V(NewObjectV) \
+    V(NewObjectA) \
+    V(GetObjectClass) \
+    V(IsInstanceOf) \
+    V(GetMethodID) \
+    V(CallObjectMethod) \
+    V(CallObjectMethodV) \
+    V(CallObjectMethodA) \
+    V(CallBooleanMethod) \
+    V(CallBooleanMethodV) \
+    V(CallBooleanMethodA) \
+    V(CallByteMethod) \
+    V(CallByteMethodV) \
+    V(CallByteMethodA) \
+    V(CallCharMethod) \
+    V(CallCharMethodV) \
+    V(CallCharMethodA) \
+    V(CallShortMethod) \
+    V(CallShortMethodV) \
+    V(CallShortMethodA) \
+    V(CallIntMethod) \
+    V(CallIntMethodV) \
+    V(CallIntMethodA) \
+    V(CallLongMethod) \
+    V(CallLongMethodV) \
+    V(CallLongMethodA) \
+    V(CallFloatMethod) \
+    V(CallFloatMethodV) \
+    V(CallFloatMethodA) \
+    V(CallDoubleMethod) \
+    V(CallDoubleMethodV) \
+    V(CallDoubleMethodA) \
+    V(CallVoidMethod) \
+    V(CallVoidMethodV) \
+    V(CallVoidMethodA) \
+    V(CallNonvirtualObjectMethod) \
+    V(CallNonvirtualObjectMethodV) \
+    V(CallNonvirtualObjectMethodA) \
+    V(CallNonvirtualBooleanMethod) \
+    V(CallNonvirtualBooleanMethodV) \
+    V(CallNonvirtualBooleanMethodA) \
+    V(CallNonvirtualByteMethod) \
+    V(CallNonvirtualByteMethodV) \
+    V(CallNonvirtualByteMethodA) \
+    V(CallNonvirtualCharMethod) \
+    V(CallNonvirtualCharMethodV) \
+    V(CallNonvirtualCharMethodA) \
+    V(CallNonvirtualShortMethod) \
+    V(CallNonvirtualShortMethodV) \
+    V(CallNonvirtualShortMethodA) \
+    V(CallNonvirtualIntMethod) \
+    V(CallNonvirtualIntMethodV) \
+    V(CallNonvirtualIntMethodA) \
+    V(CallNonvirtualLongMethod) \
+    V(CallNonvirtualLongMethodV) \
+    V(CallNonvirtualLongMethodA) \
+    V(CallNonvirtualFloatMethod) \
+    V(CallNonvirtualFloatMethodV) \
+    V(CallNonvirtualFloatMethodA) \
+    V(CallNonvirtualDoubleMethod) \
+    V(CallNonvirtualDoubleMethodV) \
+    V(CallNonvirtualDoubleMethodA) \
+    V(CallNonvirtualVoidMethod) \
+    V(CallNonvirtualVoidMethodV) \
+    V(CallNonvirtualVoidMethodA) \
+    V(GetFieldID) \
+    V(GetObjectField) \
+    V(GetBooleanField) \
+    V(GetByteField) \
+    V(GetCharField) \
+    V(GetShortField) \
+    V(GetIntField) \
+    V(GetLongField) \
+    V(GetFloatField) \
+    V(GetDoubleField) \
+    V(SetObjectField) \
+    V(SetBooleanField) \
+    V(SetByteField) \
+    V(SetCharField) \
+    V(SetShortField) \
+    V(SetIntField) \
+    V(SetLongField) \
+    V(SetFloatField) \
+    V(SetDoubleField) \
+    V(GetStaticMethodID) \
+    V(CallStaticObjectMethod) \
+    V(CallStaticObjectMethodV) \
+    V(CallStaticObjectMethodA) \
+    V(CallStaticBooleanMethod) \
+    V(CallStaticBooleanMethodV) \
+    V(CallStaticBooleanMethodA) \
+    V(CallStaticByteMethod) \
+    V(CallStaticByteMethodV) \
+    V(CallStaticByteMethodA) \
+    V(CallStaticCharMethod) \
+    V(CallStaticCharMethodV) \
+    V(CallStaticCharMethodA) \
+    V(CallStaticShortMethod) \
+    V(CallStaticShortMethodV) \
+    V(CallStaticShortMethodA) \
+    V(CallStaticIntMethod) \
+    V(CallStaticIntMethodV) \
+    V(CallStaticIntMethodA) \
+    V(CallStaticLongMethod) \
+    V(CallStaticLongMethodV) \
+    V(CallStaticLongMethodA) \
+    V(CallStaticFloatMethod) \
+    V(CallStaticFloatMethodV) \
+    V(CallStaticFloatMethodA) \
+    V(CallStaticDoubleMethod) \
+    V(CallStaticDoubleMethodV) \
+    V(CallStaticDoubleMethodA) \
+    V(CallStaticVoidMethod) \
+    V(CallStaticVoidMethodV) \
+    V(CallStaticVoidMethodA) \
+    V(GetStaticFieldID) \
+    V(GetStaticObjectField) \
+    V(GetStaticBooleanField) \
+    V(GetStaticByteField) \
+    V(GetStaticCharField) \
+    V(GetStaticShortField) \
+    V(GetStaticIntField) \
+    V(GetStaticLongField) \
+    V(GetStaticFloatField) \
+    V(GetStaticDoubleField) \
+    V(SetStaticObjectField) \
+    V(SetStaticBooleanField) \
+    V(SetStaticByteField) \
+    V(SetStaticCharField) \
+    V(SetStaticShortField) \
+    V(SetStaticIntField) \
+    V(SetStaticLongField) \
+    V(SetStaticFloatField) \
+    V(SetStaticDoubleField) \
+    V(NewString) \
+    V(GetStringLength) \
+    V(GetStringChars) \
+    V(ReleaseStringChars) \
+    V(NewStringUTF) \
+    V(GetStringUTFLength) \
+    V(GetStringUTFChars) \
+    V(ReleaseStringUTFChars) \
+    V(GetArrayLength) \
+    V(NewObjectArray) \
+    V(GetObjectArrayElement) \
+    V(SetObjectArrayElement) \
+    V(NewBooleanArray) \
+    V(NewByteArray) \
+    V(NewCharArray) \
+    V(NewShortArray) \
+    V(NewIntArray) \
+    V(NewLongArray) \
+    V(NewFloatArray) \
+    V(NewDoubleArray) \
+    V(GetBooleanArrayElements) \
+    V(ReleaseBooleanArrayElements) \
+    V(GetByteArrayElements) \
+    V(ReleaseByteArrayElements) \
+    V(GetCharArrayElements) \
+    V(ReleaseCharArrayElements) \
+    V(GetShortArrayElements) \
+    V(ReleaseShortArrayElements) \
+    V(GetIntArrayElements) \
+    V(ReleaseIntArrayElements) \
+    V(GetLongArrayElements) \
+    V(ReleaseLongArrayElements) \
+    V(GetFloatArrayElements) \
+    V(ReleaseFloatArrayElements) \
+    V(GetDoubleArrayElements) \
+    V(ReleaseDoubleArrayElements) \
+    V(GetBooleanArrayRegion) \
+    V(SetBooleanArrayRegion) \
+    V(GetByteArrayRegion) \
+    V(SetByteArrayRegion) \
+    V(GetCharArrayRegion) \
+    V(SetCharArrayRegion) \
+    V(GetShortArrayRegion) \
+    V(SetShortArrayRegion) \
+    V(GetIntArrayRegion) \
+    V(SetIntArrayRegion) \
+    V(GetLongArrayRegion) \
+    V(SetLongArrayRegion) \
+    V(GetFloatArrayRegion) \
+    V(SetFloatArrayRegion) \
+    V(GetDoubleArrayRegion) \
+    V(SetDoubleArrayRegion) \
+    V(RegisterNatives) \
+    V(UnregisterNatives) \
+    V(MonitorEnter) \
+    V(MonitorExit) \
+    V(GetJavaVM) \
+    V(GetStringRegion) \
+    V(GetStringUTFRegion) \
+    V(GetPrimitiveArrayCritical) \
+    V(ReleasePrimitiveArrayCritical) \
+    V(GetStringCritical) \
+    V(ReleaseStringCritical) \
+    V(NewWeakGlobalRef) \
+    V(DeleteWeakGlobalRef) \
+    V(ExceptionCheck) \
+    V(NewDirectByteBuffer) \
+    V(GetDirectBufferAddress) \
+    V(GetDirectBufferCapacity) \
+    V(GetObjectRefType)
+
+// position of a function in JNINativeInterface, the slot of a JNIEnv function pointer
+#define JNI_ENV_SLOT(fun) (offsetof(JNINativeInterface, fun) / sizeof(void *))
+
+typedef void (*jni_env_handler_t)(inst_trace_info_t *trace_info);
+
+typedef struct jni_env_slot {
+    // nullptr for the reserved slots
+    const char *name;
+    // nullptr when only the env pointer is printed
+    jni_env_handler_t handler;
+} jni_env_slot_t;
+
+static constexpr size_t kJniEnvSlotCount = sizeof(JNINativeInterface) / sizeof(void *);
+
+static constexpr std::array<jni_env_slot_t, kJniEnvSlotCount> build_jni_env_slots() {
+    std::array<jni_env_slot_t, kJniEnvSlotCount> slots{};
+#define JNI_ENV_NAME(fun) slots[JNI_ENV_SLOT(fun)].name = #fun;
+    JNI_ENV_FUNCTIONS(JNI_ENV_NAME)
+#undef JNI_ENV_NAME
+#define JNI_ENV_HANDLER(fun) slots[JNI_ENV_SLOT(fun)].handler = fun;
+    JNI_ENV_HANDLER(FindClass)
+    JNI_ENV_HANDLER(FromReflectedMethod)
+    JNI_ENV_HANDLER(FromReflectedField)
+    JNI_ENV_HANDLER(ToReflectedField)
+    JNI_ENV_HANDLER(ToReflectedMethod)
+    JNI_ENV_HANDLER(GetObjectClass)
+    JNI_ENV_HANDLER(GetSuperclass)
+    JNI_ENV_HANDLER(IsAssignableFrom)
+    JNI_ENV_HANDLER(Throw)
+    JNI_ENV_HANDLER(ThrowNew)
+    JNI_ENV_HANDLER(PushLocalFrame)
+    JNI_ENV_HANDLER(PopLocalFrame)
+    JNI_ENV_HANDLER(NewGlobalRef)
+    JNI_ENV_HANDLER(DeleteGlobalRef)
+    JNI_ENV_HANDLER(DeleteLocalRef)
+    JNI_ENV_HANDLER(IsSameObject)
+    JNI_ENV_HANDLER(NewLocalRef)
+    JNI_ENV_HANDLER(EnsureLocalCapacity)
+    JNI_ENV_HANDLER(AllocObject)
+    JNI_ENV_HANDLER(NewObject)
+    JNI_ENV_HANDLER(NewObjectV)
+    JNI_ENV_HANDLER(NewObjectA)
+    JNI_ENV_HANDLER(IsInstanceOf)
+    JNI_ENV_HANDLER(GetMethodID)
+    JNI_ENV_HANDLER(CallObjectMethod)
+    JNI_ENV_HANDLER(CallObjectMethodV)
+    JNI_ENV_HANDLER(CallObjectMethodA)
+    JNI_ENV_HANDLER(CallBooleanMethod)
+    JNI_ENV_HANDLER(CallBooleanMethodV)
+    JNI_ENV_HANDLER(CallBooleanMethodA)
+    JNI_ENV_HANDLER(CallByteMethod)
+    JNI_ENV_HANDLER(CallByteMethodV)
+    JNI_ENV_HANDLER(CallByteMethodA)
+    JNI_ENV_HANDLER(CallCharMethod)
+    JNI_ENV_HANDLER(CallCharMethodV)
+    JNI_ENV_HANDLER(CallCharMethodA)
+    JNI_ENV_HANDLER(CallShortMethod)
+    JNI_ENV_HANDLER(CallShortMethodV)
+    JNI_ENV_HANDLER(CallShortMethodA)
+    JNI_ENV_HANDLER(CallIntMethod)
+    JNI_ENV_HANDLER(CallIntMethodV)
+    JNI_ENV_HANDLER(CallIntMethodA)
+    JNI_ENV_HANDLER(CallLongMethod)
+    JNI_ENV_HANDLER(CallLongMethodV)
+    JNI_ENV_HANDLER(CallLongMethodA)
+    JNI_ENV_HANDLER(CallFloatMethod)
+    JNI_ENV_HANDLER(CallFloatMethodV)
+    JNI_ENV_HANDLER(CallFloatMethodA)
+    JNI_ENV_HANDLER(CallDoubleMethod)
+    JNI_ENV_HANDLER(CallDoubleMethodV)
+    JNI_ENV_HANDLER(CallDoubleMethodA)
+    JNI_ENV_HANDLER(CallVoidMethod)
+    JNI_ENV_HANDLER(CallVoidMethodV)
+    JNI_ENV_HANDLER(CallVoidMethodA)
+    JNI_ENV_HANDLER(CallNonvirtualObjectMethod)
+    JNI_ENV_HANDLER(CallNonvirtualObjectMethodV)
+    JNI_ENV_HANDLER(CallNonvirtualObjectMethodA)
+    JNI_ENV_HANDLER(CallNonvirtualBooleanMethod)
+    JNI_ENV_HANDLER(CallNonvirtualBooleanMethodV)
+    JNI_ENV_HANDLER(CallNonvirtualBooleanMethodA)
+    JNI_ENV_HANDLER(CallNonvirtualByteMethod)
+    JNI_ENV_HANDLER(CallNonvirtualByteMethodV)
+    JNI_ENV_HANDLER(CallNonvirtualByteMethodA)
+    JNI_ENV_HANDLER(CallNonvirtualCharMethod)
+    JNI_ENV_HANDLER(CallNonvirtualCharMethodV)
+    JNI_ENV_HANDLER(CallNonvirtualCharMethodA)
+    JNI_ENV_HANDLER(CallNonvirtualShortMethod)
+    JNI_ENV_HANDLER(CallNonvirtualShortMethodV)
+    JNI_ENV_HANDLER(CallNonvirtualShortMethodA)
+    JNI_ENV_HANDLER(CallNonvirtualIntMethod)
+    JNI_ENV_HANDLER(CallNonvirtualIntMethodV)
+    JNI_ENV_HANDLER(CallNonvirtualIntMethodA)
+    JNI_ENV_HANDLER(CallNonvirtualLongMethod)
+    JNI_ENV_HANDLER(CallNonvirtualLongMethodV)
+    JNI_ENV_HANDLER(CallNonvirtualLongMethodA)
+    JNI_ENV_HANDLER(CallNonvirtualFloatMethod)
+    JNI_ENV_HANDLER(CallNonvirtualFloatMethodV)
+    JNI_ENV_HANDLER(CallNonvirtualFloatMethodA)
+    JNI_ENV_HANDLER(CallNonvirtualDoubleMethod)
+    JNI_ENV_HANDLER(CallNonvirtualDoubleMethodV)
+    JNI_ENV_HANDLER(CallNonvirtualDoubleMethodA)
+    JNI_ENV_HANDLER(CallNonvirtualVoidMethod)
+    JNI_ENV_HANDLER(CallNonvirtualVoidMethodV)
+    JNI_ENV_HANDLER(CallNonvirtualVoidMethodA)
+    JNI_ENV_HANDLER(GetFieldID)
+    JNI_ENV_HANDLER(GetObjectField)
+    JNI_ENV_HANDLER(GetBooleanField)
+    JNI_ENV_HANDLER(GetByteField)
+    JNI_ENV_HANDLER(GetCharField)
+    JNI_ENV_HANDLER(GetShortField)
+    JNI_ENV_HANDLER(GetIntField)
+    JNI_ENV_HANDLER(GetLongField)
+    JNI_ENV_HANDLER(GetFloatField)
+    JNI_ENV_HANDLER(GetDoubleField)
+    JNI_ENV_HANDLER(SetObjectField)
+    JNI_ENV_HANDLER(SetBooleanField)
+    JNI_ENV_HANDLER(SetByteField)
+    JNI_ENV_HANDLER(SetCharField)
+    JNI_ENV_HANDLER(SetShortField)
+    JNI_ENV_HANDLER(SetIntField)
+    JNI_ENV_HANDLER(SetLongField)
+    JNI_ENV_HANDLER(SetFloatField)
+    JNI_ENV_HANDLER(SetDoubleField)
+    JNI_ENV_HANDLER(GetStaticMethodID)
+    JNI_ENV_HANDLER(CallStaticObjectMethod)
+    JNI_ENV_HANDLER(CallStaticObjectMethodV)
+    JNI_ENV_HANDLER(CallStaticObjectMethodA)
+    JNI_ENV_HANDLER(CallStaticBooleanMethod)
+    JNI_ENV_HANDLER(CallStaticBooleanMethodV)
+    JNI_ENV_HANDLER(CallStaticBooleanMethodA)
+    JNI_ENV_HANDLER(CallStaticByteMethod)
+    JNI_ENV_HANDLER(CallStaticByteMethodV)
+    JNI_ENV_HANDLER(CallStaticByteMethodA)
+    JNI_ENV_HANDLER(CallStaticCharMethod)
+    JNI_ENV_HANDLER(CallStaticCharMethodV)
+    JNI_ENV_HANDLER(CallStaticCharMethodA)
+    JNI_ENV_HANDLER(CallStaticShortMethod)
+    JNI_ENV_HANDLER(CallStaticShortMethodV)
+    JNI_ENV_HANDLER(CallStaticShortMethodA)
+    JNI_ENV_HANDLER(CallStaticIntMethod)
+    JNI_ENV_HANDLER(CallStaticIntMethodV)
+    JNI_ENV_HANDLER(CallStaticIntMethodA)
+    JNI_ENV_HANDLER(CallStaticLongMethod)
+    JNI_ENV_HANDLER(CallStaticLongMethodV)
+    JNI_ENV_HANDLER(CallStaticLongMethodA)
+    JNI_ENV_HANDLER(CallStaticFloatMethod)
+    JNI_ENV_HANDLER(CallStaticFloatMethodV)
+    JNI_ENV_HANDLER(CallStaticFloatMethodA)
+    JNI_ENV_HANDLER(CallStaticDoubleMethod)
+    JNI_ENV_HANDLER(CallStaticDoubleMethodV)
+    JNI_ENV_HANDLER(CallStaticDoubleMethodA)
+    JNI_ENV_HANDLER(CallStaticVoidMethod)
+    JNI_ENV_HANDLER(CallStaticVoidMethodV)
+    JNI_ENV_HANDLER(CallStaticVoidMethodA)
+    JNI_ENV_HANDLER(GetStaticFieldID)
+    JNI_ENV_HANDLER(GetStaticObjectField)
+    JNI_ENV_HANDLER(GetStaticBooleanField)
+    JNI_ENV_HANDLER(GetStaticByteField)
+    JNI_ENV_HANDLER(GetStaticCharField)
+    JNI_ENV_HANDLER(GetStaticShortField)
+    JNI_ENV_HANDLER(GetStaticIntField)
+    JNI_ENV_HANDLER(GetStaticLongField)
+    JNI_ENV_HANDLER(GetStaticFloatField)
+    JNI_ENV_HANDLER(GetStaticDoubleField)
+    JNI_ENV_HANDLER(SetStaticObjectField)
+    JNI_ENV_HANDLER(SetStaticBooleanField)
+    JNI_ENV_HANDLER(SetStaticByteField)
+    JNI_ENV_HANDLER(SetStaticCharField)
+    JNI_ENV_HANDLER(SetStaticShortField)
+    JNI_ENV_HANDLER(SetStaticIntField)
+    JNI_ENV_HANDLER(SetStaticLongField)
+    JNI_ENV_HANDLER(SetStaticFloatField)
+    JNI_ENV_HANDLER(SetStaticDoubleField)
+    JNI_ENV_HANDLER(NewString)
+    JNI_ENV_HANDLER(GetStringLength)
+    JNI_ENV_HANDLER(GetStringChars)
+    JNI_ENV_HANDLER(ReleaseStringChars)
+    JNI_ENV_HANDLER(NewStringUTF)
+    JNI_ENV_HANDLER(GetStringUTFLength)
+    JNI_ENV_HANDLER(ReleaseStringUTFChars)
+    JNI_ENV_HANDLER(GetArrayLength)
+    JNI_ENV_HANDLER(NewObjectArray)
+    JNI_ENV_HANDLER(GetObjectArrayElement)
+    JNI_ENV_HANDLER(SetObjectArrayElement)
+    JNI_ENV_HANDLER(NewBooleanArray)
+    JNI_ENV_HANDLER(NewByteArray)
+    JNI_ENV_HANDLER(NewCharArray)
+    JNI_ENV_HANDLER(NewShortArray)
+    JNI_ENV_HANDLER(NewIntArray)
+    JNI_ENV_HANDLER(NewLongArray)
+    JNI_ENV_HANDLER(NewFloatArray)
+    JNI_ENV_HANDLER(NewDoubleArray)
+    JNI_ENV_HANDLER(GetBooleanArrayElements)
+    JNI_ENV_HANDLER(GetByteArrayElements)
+    JNI_ENV_HANDLER(GetCharArrayElements)
+    JNI_ENV_HANDLER(GetShortArrayElements)
+    JNI_ENV_HANDLER(GetIntArrayElements)
+    JNI_ENV_HANDLER(GetLongArrayElements)
+    JNI_ENV_HANDLER(GetFloatArrayElements)
+    JNI_ENV_HANDLER(GetDoubleArrayElements)
+    JNI_ENV_HANDLER(ReleaseBooleanArrayElements)
+    JNI_ENV_HANDLER(ReleaseByteArrayElements)
+    JNI_ENV_HANDLER(ReleaseCharArrayElements)
+    JNI_ENV_HANDLER(ReleaseShortArrayElements)
+    JNI_ENV_HANDLER(ReleaseIntArrayElements)
+    JNI_ENV_HANDLER(ReleaseLongArrayElements)
+    JNI_ENV_HANDLER(ReleaseFloatArrayElements)
+    JNI_ENV_HANDLER(ReleaseDoubleArrayElements)
+    JNI_ENV_HANDLER(GetBooleanArrayRegion)
+    JNI_ENV_HANDLER(GetByteArrayRegion)
+    JNI_ENV_HANDLER(GetCharArrayRegion)
+    JNI_ENV_HANDLER(GetShortArrayRegion)
+    JNI_ENV_HANDLER(GetIntArrayRegion)
+    JNI_ENV_HANDLER(GetLongArrayRegion)
+    JNI_ENV_HANDLER(GetFloatArrayRegion)
+    JNI_ENV_HANDLER(GetDoubleArrayRegion)
+    JNI_ENV_HANDLER(SetBooleanArrayRegion)
+    JNI_ENV_HANDLER(SetByteArrayRegion)
+    JNI_ENV_HANDLER(SetCharArrayRegion)
+    JNI_ENV_HANDLER(SetShortArrayRegion)
+    JNI_ENV_HANDLER(SetIntArrayRegion)
+    JNI_ENV_HANDLER(SetLongArrayRegion)
+    JNI_ENV_HANDLER(SetFloatArrayRegion)
+    JNI_ENV_HANDLER(SetDoubleArrayRegion)
+    JNI_ENV_HANDLER(RegisterNatives)
+    JNI_ENV_HANDLER(UnregisterNatives)
+#undef JNI_ENV_HANDLER
+    return slots;
+}
+
+// slot to name and argument handler, built by the compiler
+static constexpr auto kJniEnvSlots = build_jni_env_slots();
+
+
+void DispatchJNIEnv::dispatch_env(uint32_t slot, inst_trace_info_t *trace_info) {
     auto env_ptr = get_arg_register_value(&trace_info->pre_status, 0);
-    trace_info->fun_call->args.push_back(fmt::format("env={:#x}", env_ptr));
-    auto it = arg_handlers_.find(name);
-    if (it != arg_handlers_.end()) {
-        it->second(trace_info);
+    DispatchBase::capture_value(trace_info, "env", kCallArgHex, env_ptr);
+    if (kJniEnvSlots[slot].handler != nullptr) {
+        kJniEnvSlots[slot].handler(trace_info);
     }
 }
 
-
-#define JNI_TABLE_FUN(name)     env_fun_table.emplace(fun_table[(offsetof(JNINativeInterface, name))/sizeof(void *)],#name)
-
 void DispatchJNIEnv::init_env_fun_table() {
     auto env = smjni::jni_provider::get_jni();
     const auto *fun_table = reinterpret_cast<const uintptr_t *>(env->functions);
-    JNI_TABLE_FUN(GetVersion);
-    JNI_TABLE_FUN(DefineClass);
-    JNI_TABLE_FUN(FindClass);
-    JNI_TABLE_FUN(FromReflectedMethod);
-    JNI_TABLE_FUN(FromReflectedField);
-    JNI_TABLE_FUN(ToReflectedMethod);
-    JNI_TABLE_FUN(GetSuperclass);
-    JNI_TABLE_FUN(IsAssignableFrom);
-    JNI_TABLE_FUN(ToReflectedField);
-    JNI_TABLE_FUN(Throw);
-    JNI_TABLE_FUN(ThrowNew);
-    JNI_TABLE_FUN(ExceptionOccurred);
-    JNI_TABLE_FUN(ExceptionDescribe);
-    JNI_TABLE_FUN(ExceptionClear);
-    JNI_TABLE_FUN(FatalError);
-    JNI_TABLE_FUN(PushLocalFrame);
-    JNI_TABLE_FUN(PopLocalFrame);
-    JNI_TABLE_FUN(NewGlobalRef);
-    JNI_TABLE_FUN(DeleteGlobalRef);
-    JNI_TABLE_FUN(DeleteLocalRef);
-    JNI_TABLE_FUN(IsSameObject);
-    JNI_TABLE_FUN(NewLocalRef);
-    JNI_TABLE_FUN(EnsureLocalCapacity);
-    JNI_TABLE_FUN(AllocObject);
-    JNI_TABLE_FUN(NewObject);
-    JNI_TABLE_FUN(NewObjectV);
-    JNI_TABLE_FUN(NewObjectA);
-    JNI_TABLE_FUN(GetObjectClass);
-    JNI_TABLE_FUN(IsInstanceOf);
-    JNI_TABLE_FUN(GetMethodID);
-    JNI_TABLE_FUN(CallObjectMethod);
-    JNI_TABLE_FUN(CallObjectMethodV);
-    JNI_TABLE_FUN(CallObjectMethodA);
-    JNI_TABLE_FUN(CallBooleanMethod);
-    JNI_TABLE_FUN(CallBooleanMethodV);
-    JNI_TABLE_FUN(CallBooleanMethodA);
-    JNI_TABLE_FUN(CallByteMethod);
-    JNI_TABLE_FUN(CallByteMethodV);
-    JNI_TABLE_FUN(CallByteMethodA);
-    JNI_TABLE_FUN(CallCharMethod);
-    JNI_TABLE_FUN(CallCharMethodV);
-    JNI_TABLE_FUN(CallCharMethodA);
-    JNI_TABLE_FUN(CallShortMethod);
-    JNI_TABLE_FUN(CallShortMethodV);
-    JNI_TABLE_FUN(CallShortMethodA);
-    JNI_TABLE_FUN(CallIntMethod);
-    JNI_TABLE_FUN(CallIntMethodV);
-    JNI_TABLE_FUN(CallIntMethodA);
-    JNI_TABLE_FUN(CallLongMethod);
-    JNI_TABLE_FUN(CallLongMethodV);
-    JNI_TABLE_FUN(CallLongMethodA);
-    JNI_TABLE_FUN(CallFloatMethod);
-    JNI_TABLE_FUN(CallFloatMethodV);
-    JNI_TABLE_FUN(CallFloatMethodA);
-    JNI_TABLE_FUN(CallDoubleMethod);
-    JNI_TABLE_FUN(CallDoubleMethodV);
-    JNI_TABLE_FUN(CallDoubleMethodA);
-    JNI_TABLE_FUN(CallVoidMethod);
-    JNI_TABLE_FUN(CallVoidMethodV);
-    JNI_TABLE_FUN(CallVoidMethodA);
-    JNI_TABLE_FUN(CallNonvirtualObjectMethod);
-    JNI_TABLE_FUN(CallNonvirtualObjectMethodV);
-    JNI_TABLE_FUN(CallNonvirtualObjectMethodA);
-    JNI_TABLE_FUN(CallNonvirtualBooleanMethod);
-    JNI_TABLE_FUN(CallNonvirtualBooleanMethodV);
-    JNI_TABLE_FUN(CallNonvirtualBooleanMethodA);
-    JNI_TABLE_FUN(CallNonvirtualByteMethod);
-    JNI_TABLE_FUN(CallNonvirtualByteMethodV);
-    JNI_TABLE_FUN(CallNonvirtualByteMethodA);
-    JNI_TABLE_FUN(CallNonvirtualCharMethod);
-    JNI_TABLE_FUN(CallNonvirtualCharMethodV);
-    JNI_TABLE_FUN(CallNonvirtualCharMethodA);
-    JNI_TABLE_FUN(CallNonvirtualShortMethod);
-    JNI_TABLE_FUN(CallNonvirtualShortMethodV);
-    JNI_TABLE_FUN(CallNonvirtualShortMethodA);
-    JNI_TABLE_FUN(CallNonvirtualIntMethod);
-    JNI_TABLE_FUN(CallNonvirtualIntMethodV);
-    JNI_TABLE_FUN(CallNonvirtualIntMethodA);
-    JNI_TABLE_FUN(CallNonvirtualLongMethod);
-    JNI_TABLE_FUN(CallNonvirtualLongMethodV);
-    JNI_TABLE_FUN(CallNonvirtualLongMethodA);
-    JNI_TABLE_FUN(CallNonvirtualFloatMethod);
-    JNI_TABLE_FUN(CallNonvirtualFloatMethodV);
-    JNI_TABLE_FUN(CallNonvirtualFloatMethodA);
-    JNI_TABLE_FUN(CallNonvirtualDoubleMethod);
-    JNI_TABLE_FUN(CallNonvirtualDoubleMethodV);
-    JNI_TABLE_FUN(CallNonvirtualDoubleMethodA);
-    JNI_TABLE_FUN(CallNonvirtualVoidMethod);
-    JNI_TABLE_FUN(CallNonvirtualVoidMethodV);
-    JNI_TABLE_FUN(CallNonvirtualVoidMethodA);
-    JNI_TABLE_FUN(GetFieldID);
-    JNI_TABLE_FUN(GetObjectField);
-    JNI_TABLE_FUN(GetBooleanField);
-    JNI_TABLE_FUN(GetByteField);
-    JNI_TABLE_FUN(GetCharField);
-    JNI_TABLE_FUN(GetShortField);
-    JNI_TABLE_FUN(GetIntField);
-    JNI_TABLE_FUN(GetLongField);
-    JNI_TABLE_FUN(GetFloatField);
-    JNI_TABLE_FUN(GetDoubleField);
-    JNI_TABLE_FUN(SetObjectField);
-    JNI_TABLE_FUN(SetBooleanField);
-    JNI_TABLE_FUN(SetByteField);
-    JNI_TABLE_FUN(SetCharField);
-    JNI_TABLE_FUN(SetShortField);
-    JNI_TABLE_FUN(SetIntField);
-    JNI_TABLE_FUN(SetLongField);
-    JNI_TABLE_FUN(SetFloatField);
-    JNI_TABLE_FUN(SetDoubleField);
-    JNI_TABLE_FUN(GetStaticMethodID);
-    JNI_TABLE_FUN(CallStaticObjectMethod);
-    JNI_TABLE_FUN(CallStaticObjectMethodV);
-    JNI_TABLE_FUN(CallStaticObjectMethodA);
-    JNI_TABLE_FUN(CallStaticBooleanMethod);
-    JNI_TABLE_FUN(CallStaticBooleanMethodV);
-    JNI_TABLE_FUN(CallStaticBooleanMethodA);
-    JNI_TABLE_FUN(CallStaticByteMethod);
-    JNI_TABLE_FUN(CallStaticByteMethodV);
-    JNI_TABLE_FUN(CallStaticByteMethodA);
-    JNI_TABLE_FUN(CallStaticCharMethod);
-    JNI_TABLE_FUN(CallStaticCharMethodV);
-    JNI_TABLE_FUN(CallStaticCharMethodA);
-    JNI_TABLE_FUN(CallStaticShortMethod);
-    JNI_TABLE_FUN(CallStaticShortMethodV);
-    JNI_TABLE_FUN(CallStaticShortMethodA);
-    JNI_TABLE_FUN(CallStaticIntMethod);
-    JNI_TABLE_FUN(CallStaticIntMethodV);
-    JNI_TABLE_FUN(CallStaticIntMethodA);
-    JNI_TABLE_FUN(CallStaticLongMethod);
-    JNI_TABLE_FUN(CallStaticLongMethodV);
-    JNI_TABLE_FUN(CallStaticLongMethodA);
-    JNI_TABLE_FUN(CallStaticFloatMethod);
-    JNI_TABLE_FUN(CallStaticFloatMethodV);
-    JNI_TABLE_FUN(CallStaticFloatMethodA);
-    JNI_TABLE_FUN(CallStaticDoubleMethod);
-    JNI_TABLE_FUN(CallStaticDoubleMethodV);
-    JNI_TABLE_FUN(CallStaticDoubleMethodA);
-    JNI_TABLE_FUN(CallStaticVoidMethod);
-    JNI_TABLE_FUN(CallStaticVoidMethodV);
-    JNI_TABLE_FUN(CallStaticVoidMethodA);
-    JNI_TABLE_FUN(GetStaticFieldID);
-    JNI_TABLE_FUN(GetStaticObjectField);
-    JNI_TABLE_FUN(GetStaticBooleanField);
-    JNI_TABLE_FUN(GetStaticByteField);
-    JNI_TABLE_FUN(GetStaticCharField);
-    JNI_TABLE_FUN(GetStaticShortField);
-    JNI_TABLE_FUN(GetStaticIntField);
-    JNI_TABLE_FUN(GetStaticLongField);
-    JNI_TABLE_FUN(GetStaticFloatField);
-    JNI_TABLE_FUN(GetStaticDoubleField);
-    JNI_TABLE_FUN(SetStaticObjectField);
-    JNI_TABLE_FUN(SetStaticBooleanField);
-    JNI_TABLE_FUN(SetStaticByteField);
-    JNI_TABLE_FUN(SetStaticCharField);
-    JNI_TABLE_FUN(SetStaticShortField);
-    JNI_TABLE_FUN(SetStaticIntField);
-    JNI_TABLE_FUN(SetStaticLongField);
-    JNI_TABLE_FUN(SetStaticFloatField);
-    JNI_TABLE_FUN(SetStaticDoubleField);
-    JNI_TABLE_FUN(NewString);
-    JNI_TABLE_FUN(GetStringLength);
-    JNI_TABLE_FUN(GetStringChars);
-    JNI_TABLE_FUN(ReleaseStringChars);
-    JNI_TABLE_FUN(NewStringUTF);
-    JNI_TABLE_FUN(GetStringUTFLength);
-    JNI_TABLE_FUN(GetStringUTFChars);
-    JNI_TABLE_FUN(ReleaseStringUTFChars);
-    JNI_TABLE_FUN(GetArrayLength);
-    JNI_TABLE_FUN(NewObjectArray);
-    JNI_TABLE_FUN(GetObjectArrayElement);
-    JNI_TABLE_FUN(SetObjectArrayElement);
-    JNI_TABLE_FUN(NewBooleanArray);
-    JNI_TABLE_FUN(NewByteArray);
-    JNI_TABLE_FUN(NewCharArray);
-    JNI_TABLE_FUN(NewShortArray);
-    JNI_TABLE_FUN(NewIntArray);
-    JNI_TABLE_FUN(NewLongArray);
-    JNI_TABLE_FUN(NewFloatArray);
-    JNI_TABLE_FUN(NewDoubleArray);
-    JNI_TABLE_FUN(GetBooleanArrayElements);
-    JNI_TABLE_FUN(ReleaseBooleanArrayElements);
-    JNI_TABLE_FUN(GetByteArrayElements);
-    JNI_TABLE_FUN(ReleaseByteArrayElements);
-    JNI_TABLE_FUN(GetCharArrayElements);
-    JNI_TABLE_FUN(ReleaseCharArrayElements);
-    JNI_TABLE_FUN(GetShortArrayElements);
-    JNI_TABLE_FUN(ReleaseShortArrayElements);
-    JNI_TABLE_FUN(GetIntArrayElements);
-    JNI_TABLE_FUN(ReleaseIntArrayElements);
-    JNI_TABLE_FUN(GetLongArrayElements);
-    JNI_TABLE_FUN(ReleaseLongArrayElements);
-    JNI_TABLE_FUN(GetFloatArrayElements);
-    JNI_TABLE_FUN(ReleaseFloatArrayElements);
-    JNI_TABLE_FUN(GetDoubleArrayElements);
-    JNI_TABLE_FUN(ReleaseDoubleArrayElements);
-    JNI_TABLE_FUN(GetBooleanArrayRegion);
-    JNI_TABLE_FUN(SetBooleanArrayRegion);
-    JNI_TABLE_FUN(GetByteArrayRegion);
-    JNI_TABLE_FUN(SetByteArrayRegion);
-    JNI_TABLE_FUN(GetCharArrayRegion);
-    JNI_TABLE_FUN(SetCharArrayRegion);
-    JNI_TABLE_FUN(GetShortArrayRegion);
-    JNI_TABLE_FUN(SetShortArrayRegion);
-    JNI_TABLE_FUN(GetIntArrayRegion);
-    JNI_TABLE_FUN(SetIntArrayRegion);
-    JNI_TABLE_FUN(GetLongArrayRegion);
-    JNI_TABLE_FUN(SetLongArrayRegion);
-    JNI_TABLE_FUN(GetFloatArrayRegion);
-    JNI_TABLE_FUN(SetFloatArrayRegion);
-    JNI_TABLE_FUN(GetDoubleArrayRegion);
-    JNI_TABLE_FUN(SetDoubleArrayRegion);
-    JNI_TABLE_FUN(RegisterNatives);
-    JNI_TABLE_FUN(UnregisterNatives);
-    JNI_TABLE_FUN(MonitorEnter);
-    JNI_TABLE_FUN(MonitorExit);
-    JNI_TABLE_FUN(GetJavaVM);
-    JNI_TABLE_FUN(GetStringRegion);
-    JNI_TABLE_FUN(GetStringUTFRegion);
-    JNI_TABLE_FUN(GetPrimitiveArrayCritical);
-    JNI_TABLE_FUN(ReleasePrimitiveArrayCritical);
-    JNI_TABLE_FUN(GetStringCritical);
-    JNI_TABLE_FUN(ReleaseStringCritical);
-    JNI_TABLE_FUN(NewWeakGlobalRef);
-    JNI_TABLE_FUN(DeleteWeakGlobalRef);
-    JNI_TABLE_FUN(ExceptionCheck);
-    JNI_TABLE_FUN(NewDirectByteBuffer);
-    JNI_TABLE_FUN(GetDirectBufferAddress);
-    JNI_TABLE_FUN(GetDirectBufferCapacity);
-    JNI_TABLE_FUN(GetObjectRefType);
-}
-
-bool DispatchJNIEnv::dispatch_args(inst_trace_info_t *info) {
-    if (!is_module_address(info->fun_call->fun_address)) {
-        return false;
+    env_fun_slots.reserve(kJniEnvSlotCount);
+    for (uint32_t slot = 0; slot < kJniEnvSlotCount; ++slot) {
+        if (kJniEnvSlots[slot].name != nullptr && fun_table[slot] != 0) {
+            env_fun_slots.emplace(fun_table[slot], slot);
+        }
+    }
+}
+
+void DispatchJNIEnv::resolve(uintptr_t address, dispatch_target_t *target) {
+    // only the JNIEnv functions are decoded, other libart.so exports stay unnamed
+    auto env_fun_find = env_fun_slots.find(address);
+    if (env_fun_find != env_fun_slots.end()) {
+        target->jni_slot = env_fun_find->second;
+        target->fun_name = kJniEnvSlots[env_fun_find->second].name;
     }
+}
+
+bool DispatchJNIEnv::dispatch_args(inst_trace_info_t *info, const dispatch_target_t &target) {
     info->fun_call->call_module_name = "libart.so";
-    auto env_fun_find = env_fun_table.find(info->fun_call->fun_address);
-    if (env_fun_find != env_fun_table.end()) {
-        auto name = env_fun_find->second;
-        info->fun_call->fun_name = name;
-        dispatch_env(name, info);
-        return true;
+    if (target.jni_slot != kNoJniSlot) {
+        info->fun_call->fun_name = target.fun_name;
+        dispatch_env(target.jni_slot, info);
     }
     return true;
 }
 
 
-static const std::unordered_map<std::string, std::function<void(inst_trace_info_t *)>> ret_handlers_ = {
-
-
-};
-
-
-bool DispatchJNIEnv::dispatch_ret(inst_trace_info_t *info, const QBDI::GPRState *ret_status) {
-    if (!is_module_address(info->fun_call->fun_address)) {
-        return false;
-    }
+bool DispatchJNIEnv::dispatch_ret(inst_trace_info_t *info, const QBDI::GPRState *ret_status,
+                                  const dispatch_target_t &target) {
     auto ret_value = get_ret_register_value(ret_status, 0);
 
 
-    if (info->fun_call->fun_name == "GetSuperclass") {
+    if (target.jni_slot == JNI_ENV_SLOT(GetSuperclass)) {
         auto env = smjni::jni_provider::get_jni();
         info->fun_call->ret_value = (fmt::format("ret class={}:{:#x}",
                                                  get_jni_class_or_java_class_name(env,
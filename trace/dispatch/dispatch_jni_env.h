@@ -10,9 +10,15 @@ public:
 
     ~DispatchJNIEnv() override = default;
 
-    bool dispatch_args(inst_trace_info_t *info) override;
+    void resolve(uintptr_t address, dispatch_target_t *target) override;
 
-    bool dispatch_ret(inst_trace_info_t *info, const QBDI::GPRState *ret_status) override;
+    bool dispatch_args(inst_trace_info_t *info, const dispatch_target_t &target) override;
+
+    bool dispatch_ret(inst_trace_info_t *info, const QBDI::GPRState *ret_status,
+                      const dispatch_target_t &target) override;
+
+protected:
+    void load() override;
 
 private:
     DispatchJNIEnv();
@@ -20,7 +26,7 @@ private:
     void init_env_fun_table();
 
 private:
-    static void dispatch_env(std::string name, inst_trace_info_t *trace_info);
+    static void dispatch_env(uint32_t slot, inst_trace_info_t *trace_info);
 
     std::string getJNIType(jclass clazz);
 };
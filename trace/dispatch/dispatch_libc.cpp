@@ -12,6 +12,10 @@
 
 static std::unordered_map<uintptr_t, std::pair<const char *, std::function<void(
         inst_trace_info_t *info)>>> libc_handlers;
+// run on return, by function address like libc_handlers
+static std::unordered_map<uintptr_t, ret_handler_t> libc_memory_handlers;
+static std::unordered_map<uintptr_t, ret_handler_t> libc_format_handlers;
+static std::unordered_map<uintptr_t, ret_handler_t> libc_output_handlers;
 
 
 DispatchLibc *DispatchLibc::get_instance() {
@@ -21,24 +25,28 @@ DispatchLibc *DispatchLibc::get_instance() {
 
 
 DispatchLibc::DispatchLibc() {
-    auto module = stl::Library::find_library("libc.so");
+    module = stl::Library::find_library("libc.so");
+    module_name = "libc.so";
     auto range = module->get_library_range();
     module_range.base = range.start();
     module_range.end = range.end();
+}
+
+void DispatchLibc::load() {
     //string.h
 
     REGISTER_HANDLER(libc_handlers, strlen, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         //size_t strlen(const char* __s)
-        trace_info->fun_call->args.push_back(fmt::format("s={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "s", arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     REGISTER_HANDLER(libc_handlers, __strlen_chk, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         //size_t __strlen_chk(const char* __s, size_t __len)
-        trace_info->fun_call->args.push_back(fmt::format("s={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("len={}", arg1));
+        capture_string(trace_info, "s", arg0);
+        capture_value(trace_info, "len", kCallArgUnsigned, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
     //memccpy
@@ -48,10 +56,10 @@ DispatchLibc::DispatchLibc() {
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(fmt::format("dest={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("src={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("c={:#x}", arg2));
-        trace_info->fun_call->args.push_back(fmt::format("n={:#x}", arg3));
+        capture_value(trace_info, "dest", kCallArgHex, arg0);
+        capture_buffer(trace_info, "src", arg1, arg3);
+        capture_value(trace_info, "c", kCallArgHex, arg2);
+        capture_value(trace_info, "n", kCallArgHex, arg3);
         trace_info->fun_call->ret_type = kPointer;
     });
     REGISTER_HANDLER(libc_handlers, memchr, {
@@ -59,9 +67,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("s={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("c={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("n={:#x}", arg2));
+        capture_value(trace_info, "s", kCallArgHex, arg0);
+        capture_value(trace_info, "c", kCallArgHex, arg1);
+        capture_value(trace_info, "n", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kPointer;
     });
     REGISTER_HANDLER(libc_handlers, memcpy, {
@@ -69,9 +77,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("dest={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("src={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("n={:#x}", arg2));
+        capture_value(trace_info, "dest", kCallArgHex, arg0);
+        capture_buffer(trace_info, "src", arg1, arg2);
+        capture_value(trace_info, "n", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kPointer;
     });
     //memcmp
@@ -80,9 +88,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("s1={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("s2={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("n={:#x}", arg2));
+        capture_value(trace_info, "s1", kCallArgHex, arg0);
+        capture_value(trace_info, "s2", kCallArgHex, arg1);
+        capture_value(trace_info, "n", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
     REGISTER_HANDLER(libc_handlers, memmove, {
@@ -90,9 +98,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("dest={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("src={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("n={:#x}", arg2));
+        capture_value(trace_info, "dest", kCallArgHex, arg0);
+        capture_buffer(trace_info, "src", arg1, arg2);
+        capture_value(trace_info, "n", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kPointer;
     });
     REGISTER_HANDLER(libc_handlers, memset, {
@@ -100,23 +108,22 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("s={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("c={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("n={:#x}", arg2));
+        capture_value(trace_info, "s", kCallArgHex, arg0);
+        capture_value(trace_info, "c", kCallArgHex, arg1);
+        capture_value(trace_info, "n", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kPointer;
     });
     //memmem
     REGISTER_HANDLER(libc_handlers, memmem, {
         //void *memmem(const void *__haystack, size_t __haystacklen, const void *__needle, size_t __needlelen)
-        trace_info->fun_call->args.push_back(
-                fmt::format("haystack={:#x}", get_arg_register_value(&trace_info->pre_status, 0)));
-        trace_info->fun_call->args.push_back(
-                fmt::format("haystacklen={:#x}",
-                            get_arg_register_value(&trace_info->pre_status, 1)));
-        trace_info->fun_call->args.push_back(
-                fmt::format("needle={:#x}", get_arg_register_value(&trace_info->pre_status, 2)));
-        trace_info->fun_call->args.push_back(
-                fmt::format("needlelen={:#x}", get_arg_register_value(&trace_info->pre_status, 3)));
+        capture_value(trace_info, "haystack", kCallArgHex,
+                      get_arg_register_value(&trace_info->pre_status, 0));
+        capture_value(trace_info, "haystacklen", kCallArgHex,
+                      get_arg_register_value(&trace_info->pre_status, 1));
+        capture_value(trace_info, "needle", kCallArgHex,
+                      get_arg_register_value(&trace_info->pre_status, 2));
+        capture_value(trace_info, "needlelen", kCallArgHex,
+                      get_arg_register_value(&trace_info->pre_status, 3));
         trace_info->fun_call->ret_type = kPointer;
     });
     //strchr
@@ -124,8 +131,8 @@ DispatchLibc::DispatchLibc() {
         //char *strchr(const char *__s, int __c)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("s={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("c={:#x}", arg1));
+        capture_string(trace_info, "s", arg0);
+        capture_value(trace_info, "c", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kString;
     });
     //__strchr_chk
@@ -134,9 +141,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("s={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("c={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("n={:#x}", arg2));
+        capture_string(trace_info, "s", arg0);
+        capture_value(trace_info, "c", kCallArgHex, arg1);
+        capture_value(trace_info, "n", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kString;
     });
     //strrchr
@@ -144,8 +151,8 @@ DispatchLibc::DispatchLibc() {
         //char *strrchr(const char *__s, int __c)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("s={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("c={:#x}", arg1));
+        capture_string(trace_info, "s", arg0);
+        capture_value(trace_info, "c", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kString;
     });
     //__strrchr_chk
@@ -154,9 +161,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("s={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("c={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("n={:#x}", arg2));
+        capture_string(trace_info, "s", arg0);
+        capture_value(trace_info, "c", kCallArgHex, arg1);
+        capture_value(trace_info, "n", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kString;
     });
     //strcmp
@@ -164,8 +171,8 @@ DispatchLibc::DispatchLibc() {
         //int strcmp(const char *__s1, const char *__s2)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("s1={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("s2={}", read_string_from_address(arg1)));
+        capture_string(trace_info, "s1", arg0);
+        capture_string(trace_info, "s2", arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
     //stpcpy
@@ -173,9 +180,8 @@ DispatchLibc::DispatchLibc() {
         //char *stpcpy(char *__dest, const char *__src)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("dest={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("src={}", read_string_from_address(arg1)));
+        capture_value(trace_info, "dest", kCallArgHex, arg0);
+        capture_string(trace_info, "src", arg1);
         trace_info->fun_call->ret_type = kString;
     });
     //strcpy
@@ -183,9 +189,8 @@ DispatchLibc::DispatchLibc() {
         //char *strcpy(char *__dest, const char *__src)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("dest={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("src={}", read_string_from_address(arg1)));
+        capture_value(trace_info, "dest", kCallArgHex, arg0);
+        capture_string(trace_info, "src", arg1);
         trace_info->fun_call->ret_type = kString;
     });
     //strcat
@@ -193,16 +198,15 @@ DispatchLibc::DispatchLibc() {
         //char *strcat(char *__dest, const char *__src)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("dest={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("src={}", read_string_from_address(arg1)));
+        capture_string(trace_info, "dest", arg0);
+        capture_string(trace_info, "src", arg1);
         trace_info->fun_call->ret_type = kString;
     });
     //strdup
     REGISTER_HANDLER(libc_handlers, strdup, {
         //char *strdup(const char *__s)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("s={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "s", arg0);
         trace_info->fun_call->ret_type = kString;
     });
     //strstr
@@ -210,10 +214,8 @@ DispatchLibc::DispatchLibc() {
         //char *strstr(const char *__haystack, const char *__needle)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("haystack={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(
-                fmt::format("needle={}", read_string_from_address(arg1)));
+        capture_string(trace_info, "haystack", arg0);
+        capture_string(trace_info, "needle", arg1);
         trace_info->fun_call->ret_type = kString;
     });
     //strcasestr
@@ -221,10 +223,8 @@ DispatchLibc::DispatchLibc() {
         //char *strcasestr(const char *__haystack, const char *__needle)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("haystack={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(
-                fmt::format("needle={}", read_string_from_address(arg1)));
+        capture_string(trace_info, "haystack", arg0);
+        capture_string(trace_info, "needle", arg1);
         trace_info->fun_call->ret_type = kString;
     });
     //strcasestr
@@ -233,11 +233,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(
-                fmt::format("haystack={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(
-                fmt::format("needle={}", read_string_from_address(arg1)));
-        trace_info->fun_call->args.push_back(fmt::format("len={:#x}", arg2));
+        capture_string(trace_info, "haystack", arg0);
+        capture_string(trace_info, "needle", arg1);
+        capture_value(trace_info, "len", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kString;
     });
     //strtok
@@ -245,9 +243,8 @@ DispatchLibc::DispatchLibc() {
         //char *strtok(char *__s, const char *__delim)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("s={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(
-                fmt::format("delim={}", read_string_from_address(arg1)));
+        capture_string(trace_info, "s", arg0);
+        capture_string(trace_info, "delim", arg1);
         trace_info->fun_call->ret_type = kString;
     });
     //strtok_r
@@ -256,17 +253,16 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("s={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(
-                fmt::format("delim={}", read_string_from_address(arg1)));
-        trace_info->fun_call->args.push_back(fmt::format("lasts={:#x}", arg2));
+        capture_string(trace_info, "s", arg0);
+        capture_string(trace_info, "delim", arg1);
+        capture_value(trace_info, "lasts", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kString;
     });
     //strerror
     REGISTER_HANDLER(libc_handlers, strerror, {
         //char *strerror(int __errnum)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("errnum={:#x}", arg0));
+        capture_value(trace_info, "errnum", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kString;
     });
     //strerror_r
@@ -275,9 +271,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("errnum={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("buflen={:#x}", arg2));
+        capture_value(trace_info, "errnum", kCallArgHex, arg0);
+        capture_value(trace_info, "buf", kCallArgHex, arg1);
+        capture_value(trace_info, "buflen", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
     //strnlen
@@ -285,8 +281,8 @@ DispatchLibc::DispatchLibc() {
         //size_t strnlen(const char *__s, size_t __maxlen)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("s={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("maxlen={:#x}", arg1));
+        capture_string(trace_info, "s", arg0);
+        capture_value(trace_info, "maxlen", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
     //strncat
@@ -295,10 +291,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(
-                fmt::format("dest={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("src={}", read_string_from_address(arg1)));
-        trace_info->fun_call->args.push_back(fmt::format("maxlen={:#x}", arg2));
+        capture_string(trace_info, "dest", arg0);
+        capture_string(trace_info, "src", arg1);
+        capture_value(trace_info, "maxlen", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kString;
     });
     //strndup
@@ -306,8 +301,8 @@ DispatchLibc::DispatchLibc() {
         //char *strndup(const char *__s, size_t __n)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("s={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("n={:#x}", arg1));
+        capture_string(trace_info, "s", arg0);
+        capture_value(trace_info, "n", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kString;
     });
     //strncmp
@@ -316,9 +311,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("s1={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("s2={}", read_string_from_address(arg1)));
-        trace_info->fun_call->args.push_back(fmt::format("n={:#x}", arg2));
+        capture_string(trace_info, "s1", arg0);
+        capture_string(trace_info, "s2", arg1);
+        capture_value(trace_info, "n", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
     //stpncpy
@@ -327,10 +322,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(
-                fmt::format("dest={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("src={}", read_string_from_address(arg1)));
-        trace_info->fun_call->args.push_back(fmt::format("n={:#x}", arg2));
+        capture_value(trace_info, "dest", kCallArgHex, arg0);
+        capture_string(trace_info, "src", arg1);
+        capture_value(trace_info, "n", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kString;
     });
     //strncpy
@@ -339,10 +333,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(
-                fmt::format("dest={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("src={}", read_string_from_address(arg1)));
-        trace_info->fun_call->args.push_back(fmt::format("n={:#x}", arg2));
+        capture_value(trace_info, "dest", kCallArgHex, arg0);
+        capture_string(trace_info, "src", arg1);
+        capture_value(trace_info, "n", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kString;
     });
     //strlcat
@@ -351,10 +344,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(
-                fmt::format("dest={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("src={}", read_string_from_address(arg1)));
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg2));
+        capture_string(trace_info, "dest", arg0);
+        capture_string(trace_info, "src", arg1);
+        capture_value(trace_info, "size", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
     //strlcpy
@@ -363,10 +355,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(
-                fmt::format("dest={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("src={}", read_string_from_address(arg1)));
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg2));
+        capture_value(trace_info, "dest", kCallArgHex, arg0);
+        capture_string(trace_info, "src", arg1);
+        capture_value(trace_info, "size", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
     //strcspn
@@ -374,9 +365,8 @@ DispatchLibc::DispatchLibc() {
         //size_t strcspn(const char *__s, const char *__reject)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("s={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(
-                fmt::format("reject={}", read_string_from_address(arg1)));
+        capture_string(trace_info, "s", arg0);
+        capture_string(trace_info, "reject", arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
     //strpbrk
@@ -384,9 +374,8 @@ DispatchLibc::DispatchLibc() {
         //char *strpbrk(const char *__s, const char *__accept)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("s={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(
-                fmt::format("accept={}", read_string_from_address(arg1)));
+        capture_string(trace_info, "s", arg0);
+        capture_string(trace_info, "accept", arg1);
         trace_info->fun_call->ret_type = kString;
     });
     //strsep
@@ -394,10 +383,8 @@ DispatchLibc::DispatchLibc() {
         //char *strsep(char **__stringp, const char *__delim)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("stringp={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(
-                fmt::format("delim={}", read_string_from_address(arg1)));
+        capture_string(trace_info, "stringp", arg0);
+        capture_string(trace_info, "delim", arg1);
         trace_info->fun_call->ret_type = kString;
     });
     //strspn
@@ -405,16 +392,15 @@ DispatchLibc::DispatchLibc() {
         //size_t strspn(const char *__s, const char *__accept)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("s={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(
-                fmt::format("accept={}", read_string_from_address(arg1)));
+        capture_string(trace_info, "s", arg0);
+        capture_string(trace_info, "accept", arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
     //strsignal
     REGISTER_HANDLER(libc_handlers, strsignal, {
         //const char *strsignal(int __sig)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("sig={:#x}", arg0));
+        capture_value(trace_info, "sig", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kString;
     });
     //strcoll
@@ -422,8 +408,8 @@ DispatchLibc::DispatchLibc() {
         //int strcoll(const char *__s1, const char *__s2)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("s1={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("s2={}", read_string_from_address(arg1)));
+        capture_string(trace_info, "s1", arg0);
+        capture_string(trace_info, "s2", arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
     //strxfrm
@@ -432,10 +418,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(
-                fmt::format("dest={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("src={}", read_string_from_address(arg1)));
-        trace_info->fun_call->args.push_back(fmt::format("n={:#x}", arg2));
+        capture_string(trace_info, "dest", arg0);
+        capture_string(trace_info, "src", arg1);
+        capture_value(trace_info, "n", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
     //strcoll_l
@@ -444,9 +429,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("s1={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("s2={}", read_string_from_address(arg1)));
-        trace_info->fun_call->args.push_back(fmt::format("l={:#x}", arg2));
+        capture_string(trace_info, "s1", arg0);
+        capture_string(trace_info, "s2", arg1);
+        capture_value(trace_info, "l", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
     //strcasecmp
@@ -454,8 +439,8 @@ DispatchLibc::DispatchLibc() {
         //int strcasecmp(const char *__s1, const char *__s2)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("s1={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("s2={}", read_string_from_address(arg1)));
+        capture_string(trace_info, "s1", arg0);
+        capture_string(trace_info, "s2", arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
     //strncasecmp
@@ -464,47 +449,47 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("s1={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("s2={}", read_string_from_address(arg1)));
-        trace_info->fun_call->args.push_back(fmt::format("n={:#x}", arg2));
+        capture_string(trace_info, "s1", arg0);
+        capture_string(trace_info, "s2", arg1);
+        capture_value(trace_info, "n", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
     //memory function handler
     REGISTER_HANDLER(libc_handlers, malloc, {
         //void *malloc(size_t __size)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg0));
+        capture_value(trace_info, "size", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kPointer;
     });
     REGISTER_HANDLER(libc_handlers, calloc, {
         //void *calloc(size_t __nmemb, size_t __size)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("nmemb={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg1));
+        capture_value(trace_info, "nmemb", kCallArgHex, arg0);
+        capture_value(trace_info, "size", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
     REGISTER_HANDLER(libc_handlers, realloc, {
         //void *realloc(void *__ptr, size_t __size)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("ptr={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg1));
+        capture_value(trace_info, "ptr", kCallArgHex, arg0);
+        capture_value(trace_info, "size", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kPointer;
     });
     //free
     REGISTER_HANDLER(libc_handlers, free, {
         //void free(void *__ptr)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("ptr={:#x}", arg0));
+        capture_value(trace_info, "ptr", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kVoid;
     });
     REGISTER_HANDLER(libc_handlers, memalign, {
         //void *memalign(size_t __alignment, size_t __size)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("alignment={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg1));
+        capture_value(trace_info, "alignment", kCallArgHex, arg0);
+        capture_value(trace_info, "size", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kPointer;
     });
     //stdlib.h fun  handler
@@ -516,41 +501,40 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, exit, {
         //void exit(int __status)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("status={:#x}", arg0));
+        capture_value(trace_info, "status", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kVoid;
     });
     REGISTER_HANDLER(libc_handlers, _Exit, {
         //void _Exit(int __status)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("status={:#x}", arg0));
+        capture_value(trace_info, "status", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kVoid;
     });
     //atexit
     REGISTER_HANDLER(libc_handlers, atexit, {
         //int atexit(void (*__func)(void))
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("func={:#x}", arg0));
+        capture_value(trace_info, "func", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     REGISTER_HANDLER(libc_handlers, at_quick_exit, {
         //int at_quick_exit(void (*__func)(void))
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("func={:#x}", arg0));
+        capture_value(trace_info, "func", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     //quick_exit
     REGISTER_HANDLER(libc_handlers, quick_exit, {
         //void quick_exit(int __status)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("status={:#x}", arg0));
+        capture_value(trace_info, "status", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kVoid;
     });
     //getenv
     REGISTER_HANDLER(libc_handlers, getenv, {
         //char *getenv(const char *__name)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("name={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "name", arg0);
         trace_info->fun_call->ret_type = kString;
     });
     REGISTER_HANDLER(libc_handlers, setenv, {
@@ -558,27 +542,23 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(
-                fmt::format("name={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(
-                fmt::format("value={}", read_string_from_address(arg1)));
-        trace_info->fun_call->args.push_back(fmt::format("replace={:#x}", arg2));
+        capture_string(trace_info, "name", arg0);
+        capture_string(trace_info, "value", arg1);
+        capture_value(trace_info, "replace", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
     //putenv
     REGISTER_HANDLER(libc_handlers, putenv, {
         //int putenv(char *__string)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("string={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "string", arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     //unsetenv
     REGISTER_HANDLER(libc_handlers, unsetenv, {
         //int unsetenv(const char *__name)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("name={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "name", arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     //clearenv
@@ -590,31 +570,27 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, mkdtemp, {
         //char *mkdtemp(char *__template)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("template={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "template", arg0);
         trace_info->fun_call->ret_type = kString;
     });
     //mktemp
     REGISTER_HANDLER(libc_handlers, mktemp, {
         //char *mktemp(char *__template)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("template={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "template", arg0);
         trace_info->fun_call->ret_type = kString;
     });
     //mkstemp64
     REGISTER_HANDLER(libc_handlers, mkstemp64, {
         //int mkstemp64(char *__template)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("template={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "template", arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     REGISTER_HANDLER(libc_handlers, mkstemp, {
         //int mkstemp(char *__template)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("template={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "template", arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     //mkstemps
@@ -622,9 +598,8 @@ DispatchLibc::DispatchLibc() {
         //int mkstemps(char *__template, int __suffixlen)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("template={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("suffixlen={:#x}", arg1));
+        capture_string(trace_info, "template", arg0);
+        capture_value(trace_info, "suffixlen", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
     //strtol
@@ -633,10 +608,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(
-                fmt::format("nptr={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("endptr={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("base={:#x}", arg2));
+        capture_string(trace_info, "nptr", arg0);
+        capture_value(trace_info, "endptr", kCallArgHex, arg1);
+        capture_value(trace_info, "base", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
     //strtoll
@@ -645,9 +619,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("s={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("end_ptr={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("base={:#x}", arg2));
+        capture_string(trace_info, "s", arg0);
+        capture_value(trace_info, "end_ptr", kCallArgHex, arg1);
+        capture_value(trace_info, "base", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
     //strtoul
@@ -656,10 +630,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(
-                fmt::format("nptr={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("endptr={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("base={:#x}", arg2));
+        capture_string(trace_info, "nptr", arg0);
+        capture_value(trace_info, "endptr", kCallArgHex, arg1);
+        capture_value(trace_info, "base", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
     REGISTER_HANDLER(libc_handlers, strtoull, {
@@ -667,10 +640,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(
-                fmt::format("nptr={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("endptr={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("base={:#x}", arg2));
+        capture_string(trace_info, "nptr", arg0);
+        capture_value(trace_info, "endptr", kCallArgHex, arg1);
+        capture_value(trace_info, "base", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
     //posix_memalign
@@ -679,9 +651,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("memptr={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("alignment={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg2));
+        capture_value(trace_info, "memptr", kCallArgHex, arg0);
+        capture_value(trace_info, "alignment", kCallArgHex, arg1);
+        capture_value(trace_info, "size", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
     //strtod
@@ -689,50 +661,44 @@ DispatchLibc::DispatchLibc() {
         //double strtod(const char *__restrict __nptr, char **__restrict __endptr)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("nptr={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("endptr={:#x}", arg1));
+        capture_string(trace_info, "nptr", arg0);
+        capture_value(trace_info, "endptr", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
     REGISTER_HANDLER(libc_handlers, strtof, {
         //float strtof(const char *__restrict __nptr, char **__restrict __endptr)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("nptr={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("endptr={:#x}", arg1));
+        capture_string(trace_info, "nptr", arg0);
+        capture_value(trace_info, "endptr", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
     REGISTER_HANDLER(libc_handlers, strtold, {
         //long double strtold(const char *__restrict __nptr, char **__restrict __endptr)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("nptr={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("endptr={:#x}", arg1));
+        capture_string(trace_info, "nptr", arg0);
+        capture_value(trace_info, "endptr", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
     //atoi
     REGISTER_HANDLER(libc_handlers, atoi, {
         //int atoi(const char *__nptr)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("nptr={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "nptr", arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     //atol
     REGISTER_HANDLER(libc_handlers, atol, {
         //long int atol(const char *__nptr)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("nptr={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "nptr", arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     REGISTER_HANDLER(libc_handlers, atoll, {
         //long long int atoll(const char *__nptr)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("nptr={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "nptr", arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     //realpath
@@ -740,9 +706,8 @@ DispatchLibc::DispatchLibc() {
         //char *realpath(const char *__restrict __name, char *__restrict __resolved)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("name={}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("resolved={:#x}", arg1));
+        capture_string(trace_info, "name", arg0);
+        capture_value(trace_info, "resolved", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kString;
     });
     //bsearch
@@ -754,11 +719,11 @@ DispatchLibc::DispatchLibc() {
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
         auto arg4 = get_arg_register_value(&trace_info->pre_status, 4);
 
-        trace_info->fun_call->args.push_back(fmt::format("key={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("base={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("nmemb={:#x}", arg2));
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg3));
-        trace_info->fun_call->args.push_back(fmt::format("compar={:#x}", arg4));
+        capture_value(trace_info, "key", kCallArgHex, arg0);
+        capture_value(trace_info, "base", kCallArgHex, arg1);
+        capture_value(trace_info, "nmemb", kCallArgHex, arg2);
+        capture_value(trace_info, "size", kCallArgHex, arg3);
+        capture_value(trace_info, "compar", kCallArgHex, arg4);
         trace_info->fun_call->ret_type = kPointer;
     });
     REGISTER_HANDLER(libc_handlers, qsort, {
@@ -768,10 +733,10 @@ DispatchLibc::DispatchLibc() {
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
 
-        trace_info->fun_call->args.push_back(fmt::format("base={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("nmemb={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg2));
-        trace_info->fun_call->args.push_back(fmt::format("compar={:#x}", arg3));
+        capture_value(trace_info, "base", kCallArgHex, arg0);
+        capture_value(trace_info, "nmemb", kCallArgHex, arg1);
+        capture_value(trace_info, "size", kCallArgHex, arg2);
+        capture_value(trace_info, "compar", kCallArgHex, arg3);
         trace_info->fun_call->ret_type = kVoid;
     });
     //arc4random
@@ -783,7 +748,7 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, arc4random_uniform, {
         //unsigned int arc4random_uniform(unsigned int __upper_bound)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("upper_bound={:#x}", arg0));
+        capture_value(trace_info, "upper_bound", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     //arc4random_buf
@@ -791,15 +756,15 @@ DispatchLibc::DispatchLibc() {
         //void arc4random_buf(void *__buf, size_t __nbytes)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("nbytes={:#x}", arg1));
+        capture_value(trace_info, "buf", kCallArgHex, arg0);
+        capture_value(trace_info, "nbytes", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kVoid;
     });
     //rand_r
     REGISTER_HANDLER(libc_handlers, rand_r, {
         //int rand_r(unsigned int *__seed)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("seed={:#x}", arg0));
+        capture_value(trace_info, "seed", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     //drand48
@@ -811,21 +776,21 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, erand48, {
         //double erand48(unsigned short int __xsubi[3])
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("xsubi={:#x}", arg0));
+        capture_value(trace_info, "xsubi", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     //jrand48
     REGISTER_HANDLER(libc_handlers, jrand48, {
         //long int jrand48(unsigned short int __xsubi[3])
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("xsubi={:#x}", arg0));
+        capture_value(trace_info, "xsubi", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     //lcong48
     REGISTER_HANDLER(libc_handlers, lcong48, {
         //void lcong48(unsigned short int __param[7])
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("param={:#x}", arg0));
+        capture_value(trace_info, "param", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kVoid;
     });
     //lrand48
@@ -842,14 +807,14 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, nrand48, {
         //long int nrand48(unsigned short int __xsubi[3])
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("xsubi={:#x}", arg0));
+        capture_value(trace_info, "xsubi", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     //srand48
     REGISTER_HANDLER(libc_handlers, srand48, {
         //void srand48(long int __seedval)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("seedval={:#x}", arg0));
+        capture_value(trace_info, "seedval", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kVoid;
     });
     //getprogname
@@ -860,7 +825,7 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, setprogname, {
         //void setprogname(const char *__name)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("name={:#x}", arg0));
+        capture_value(trace_info, "name", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kVoid;
     });
     //rand
@@ -872,7 +837,7 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, srand, {
         //void srand(unsigned int __seed)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("seed={:#x}", arg0));
+        capture_value(trace_info, "seed", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kVoid;
     });
     //random
@@ -884,7 +849,7 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, srandom, {
         //void srandom(unsigned int __seed)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("seed={:#x}", arg0));
+        capture_value(trace_info, "seed", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kVoid;
     });
     //io func
@@ -893,9 +858,8 @@ DispatchLibc::DispatchLibc() {
         //int creat(const char *__path, mode_t __mode)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={:}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("mode={:#x}", arg1));
+        capture_string(trace_info, "path", arg0);
+        capture_value(trace_info, "mode", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
     //creat64
@@ -903,9 +867,8 @@ DispatchLibc::DispatchLibc() {
         //int creat64(const char *__path, mode_t __mode)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={:}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("mode={:#x}", arg1));
+        capture_string(trace_info, "path", arg0);
+        capture_value(trace_info, "mode", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
     //openat
@@ -915,11 +878,10 @@ DispatchLibc::DispatchLibc() {
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={:}", read_string_from_address(arg1)));
-        trace_info->fun_call->args.push_back(fmt::format("oflag={:#x}", arg2));
-        trace_info->fun_call->args.push_back(fmt::format("mode={:#x}", arg3));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
+        capture_string(trace_info, "path", arg1);
+        capture_value(trace_info, "oflag", kCallArgHex, arg2);
+        capture_value(trace_info, "mode", kCallArgHex, arg3);
         trace_info->fun_call->ret_type = kNumber;
     });
     //openat64
@@ -929,11 +891,10 @@ DispatchLibc::DispatchLibc() {
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={:}", read_string_from_address(arg1)));
-        trace_info->fun_call->args.push_back(fmt::format("oflag={:#x}", arg2));
-        trace_info->fun_call->args.push_back(fmt::format("mode={:#x}", arg3));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
+        capture_string(trace_info, "path", arg1);
+        capture_value(trace_info, "oflag", kCallArgHex, arg2);
+        capture_value(trace_info, "mode", kCallArgHex, arg3);
         trace_info->fun_call->ret_type = kNumber;
     });
     //open
@@ -942,10 +903,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={:}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("oflag={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("mode={:#x}", arg2));
+        capture_string(trace_info, "path", arg0);
+        capture_value(trace_info, "oflag", kCallArgHex, arg1);
+        capture_value(trace_info, "mode", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
     //open64
@@ -954,10 +914,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={:}", read_string_from_address(arg0)));
-        trace_info->fun_call->args.push_back(fmt::format("oflag={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("mode={:#x}", arg2));
+        capture_string(trace_info, "path", arg0);
+        capture_value(trace_info, "oflag", kCallArgHex, arg1);
+        capture_value(trace_info, "mode", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
     //fallocate
@@ -967,10 +926,10 @@ DispatchLibc::DispatchLibc() {
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("mode={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("offset={:#x}", arg2));
-        trace_info->fun_call->args.push_back(fmt::format("len={:#x}", arg3));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
+        capture_value(trace_info, "mode", kCallArgHex, arg1);
+        capture_value(trace_info, "offset", kCallArgHex, arg2);
+        capture_value(trace_info, "len", kCallArgHex, arg3);
         trace_info->fun_call->ret_type = kNumber;
     });
     //fallocate64
@@ -980,10 +939,10 @@ DispatchLibc::DispatchLibc() {
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("mode={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("offset={:#x}", arg2));
-        trace_info->fun_call->args.push_back(fmt::format("len={:#x}", arg3));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
+        capture_value(trace_info, "mode", kCallArgHex, arg1);
+        capture_value(trace_info, "offset", kCallArgHex, arg2);
+        capture_value(trace_info, "len", kCallArgHex, arg3);
         trace_info->fun_call->ret_type = kNumber;
     });
     //posix_fadvise
@@ -993,10 +952,10 @@ DispatchLibc::DispatchLibc() {
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("offset={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("len={:#x}", arg2));
-        trace_info->fun_call->args.push_back(fmt::format("advise={:#x}", arg3));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
+        capture_value(trace_info, "offset", kCallArgHex, arg1);
+        capture_value(trace_info, "len", kCallArgHex, arg2);
+        capture_value(trace_info, "advise", kCallArgHex, arg3);
         trace_info->fun_call->ret_type = kNumber;
     });
     //posix_fadvise64
@@ -1005,10 +964,10 @@ DispatchLibc::DispatchLibc() {
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("offset={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("len={:#x}", arg2));
-        trace_info->fun_call->args.push_back(fmt::format("advise={:#x}", arg3));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
+        capture_value(trace_info, "offset", kCallArgHex, arg1);
+        capture_value(trace_info, "len", kCallArgHex, arg2);
+        capture_value(trace_info, "advise", kCallArgHex, arg3);
         trace_info->fun_call->ret_type = kNumber;
     });
     //posix_fallocate
@@ -1017,9 +976,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("offset={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("len={:#x}", arg2));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
+        capture_value(trace_info, "offset", kCallArgHex, arg1);
+        capture_value(trace_info, "len", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
 
@@ -1028,9 +987,9 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("offset={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("len={:#x}", arg2));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
+        capture_value(trace_info, "offset", kCallArgHex, arg1);
+        capture_value(trace_info, "len", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
     //readahead
@@ -1039,16 +998,16 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("offset={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("count={:#x}", arg2));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
+        capture_value(trace_info, "offset", kCallArgHex, arg1);
+        capture_value(trace_info, "count", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
     //unistd.h
     REGISTER_HANDLER(libc_handlers, _exit, {
         //_exit(int __status)
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("status={:#x}", arg0));
+        capture_value(trace_info, "status", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     //fork
@@ -1089,7 +1048,7 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, getpgid, {
         // pid_t  getpgid(pid_t __pid);
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("pid={:#x}", arg0));
+        capture_value(trace_info, "pid", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     //setpgid
@@ -1097,234 +1056,215 @@ DispatchLibc::DispatchLibc() {
         //int setpgid(pid_t __pid, pid_t __pgid);
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("pid={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("pgid={:#x}", arg1));
+        capture_value(trace_info, "pid", kCallArgHex, arg0);
+        capture_value(trace_info, "pgid", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
     /*
         int access(const char* __path, int __mode);*/
     REGISTER_HANDLER(libc_handlers, access, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("path={}", arg0));
-        trace_info->fun_call->args.push_back(
-                fmt::format("mode={:#x}", get_arg_register_value(&trace_info->pre_status, 1)));
+        capture_value(trace_info, "path", kCallArgUnsigned, arg0);
+        capture_value(trace_info, "mode", kCallArgHex,
+                      get_arg_register_value(&trace_info->pre_status, 1));
         trace_info->fun_call->ret_type = kNumber;
     });
     //int faccessat(int __dirfd, const char* __path, int __mode, int __flags)
     REGISTER_HANDLER(libc_handlers, faccessat, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("dirfd={:#x}", arg0));
+        capture_value(trace_info, "dirfd", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={}", read_string_from_address(arg1)));
+        capture_string(trace_info, "path", arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("mode={:#x}", arg2));
+        capture_value(trace_info, "mode", kCallArgHex, arg2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(fmt::format("flags={:#x}", arg3));
+        capture_value(trace_info, "flags", kCallArgHex, arg3);
         trace_info->fun_call->ret_type = kNumber;
     });
     // int link(const char* __old_path, const char* __new_path)
     REGISTER_HANDLER(libc_handlers, link, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("old_path={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "old_path", arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("new_path={}", read_string_from_address(arg1)));
+        capture_string(trace_info, "new_path", arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int linkat(int __old_dir_fd, const char* __old_path, int __new_dir_fd, const char* __new_path, int __flags)
     REGISTER_HANDLER(libc_handlers, linkat, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("old_dir_fd={:#x}", arg0));
+        capture_value(trace_info, "old_dir_fd", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("old_path={}", read_string_from_address(arg1)));
+        capture_string(trace_info, "old_path", arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("new_dir_fd={:#x}", arg2));
+        capture_value(trace_info, "new_dir_fd", kCallArgHex, arg2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(
-                fmt::format("new_path={}", read_string_from_address(arg3)));
+        capture_string(trace_info, "new_path", arg3);
         auto arg4 = get_arg_register_value(&trace_info->pre_status, 4);
-        trace_info->fun_call->args.push_back(fmt::format("flags={:#x}", arg4));
+        capture_value(trace_info, "flags", kCallArgHex, arg4);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int unlink(const char* __path)
     REGISTER_HANDLER(libc_handlers, unlink, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "path", arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int unlinkat(int __dirfd, const char* __path, int __flags)
     REGISTER_HANDLER(libc_handlers, unlinkat, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("dirfd={:#x}", arg0));
+        capture_value(trace_info, "dirfd", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={}", read_string_from_address(arg1)));
+        capture_string(trace_info, "path", arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("flags={:#x}", arg2));
+        capture_value(trace_info, "flags", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int chdir(const char* __path)
     REGISTER_HANDLER(libc_handlers, chdir, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "path", arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int fchdir(int __fd)
     REGISTER_HANDLER(libc_handlers, fchdir, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int rmdir(const char* __path)
     REGISTER_HANDLER(libc_handlers, rmdir, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "path", arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pipe(int __fds[2])
     REGISTER_HANDLER(libc_handlers, pipe, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fds={:#x}", arg0));
+        capture_value(trace_info, "fds", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pipe2(int __fds[2], int __flags)
     REGISTER_HANDLER(libc_handlers, pipe2, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fds={:#x}", arg0));
+        capture_value(trace_info, "fds", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("flags={:#x}", arg1));
+        capture_value(trace_info, "flags", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int chroot(const char* __path)
     REGISTER_HANDLER(libc_handlers, chroot, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "path", arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int symlink(const char* __old_path, const char* __new_path)
     REGISTER_HANDLER(libc_handlers, symlink, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("old_path={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "old_path", arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("new_path={}", read_string_from_address(arg1)));
+        capture_string(trace_info, "new_path", arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int symlinkat(const char* __old_path, int __new_dir_fd, const char* __new_path)
     REGISTER_HANDLER(libc_handlers, symlinkat, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("old_path={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "old_path", arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("new_dir_fd={:#x}", arg1));
+        capture_value(trace_info, "new_dir_fd", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(
-                fmt::format("new_path={}", read_string_from_address(arg2)));
+        capture_string(trace_info, "new_path", arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // ssize_t readlink(const char* __path, char* __buf, size_t __buf_size)
     REGISTER_HANDLER(libc_handlers, readlink, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "path", arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg1));
+        capture_value(trace_info, "buf", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("buf_size={:#x}", arg2));
+        capture_value(trace_info, "buf_size", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // ssize_t readlinkat(int __dir_fd, const char* __path, char* __buf, size_t __buf_size)
     REGISTER_HANDLER(libc_handlers, readlinkat, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("dir_fd={:#x}", arg0));
+        capture_value(trace_info, "dir_fd", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={}", read_string_from_address(arg1)));
+        capture_string(trace_info, "path", arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg2));
+        capture_value(trace_info, "buf", kCallArgHex, arg2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(fmt::format("buf_size={:#x}", arg3));
+        capture_value(trace_info, "buf_size", kCallArgHex, arg3);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int chown(const char* __path, uid_t __owner, gid_t __group)
     REGISTER_HANDLER(libc_handlers, chown, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "path", arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("owner={:#x}", arg1));
+        capture_value(trace_info, "owner", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("group={:#x}", arg2));
+        capture_value(trace_info, "group", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int fchown(int __fd, uid_t __owner, gid_t __group)
     REGISTER_HANDLER(libc_handlers, fchown, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("owner={:#x}", arg1));
+        capture_value(trace_info, "owner", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("group={:#x}", arg2));
+        capture_value(trace_info, "group", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int fchownat(int __dir_fd, const char* __path, uid_t __owner, gid_t __group, int __flags)
     REGISTER_HANDLER(libc_handlers, fchownat, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("dir_fd={:#x}", arg0));
+        capture_value(trace_info, "dir_fd", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={}", read_string_from_address(arg1)));
+        capture_string(trace_info, "path", arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("owner={:#x}", arg2));
+        capture_value(trace_info, "owner", kCallArgHex, arg2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(fmt::format("group={:#x}", arg3));
+        capture_value(trace_info, "group", kCallArgHex, arg3);
         auto arg4 = get_arg_register_value(&trace_info->pre_status, 4);
-        trace_info->fun_call->args.push_back(fmt::format("flags={:#x}", arg4));
+        capture_value(trace_info, "flags", kCallArgHex, arg4);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int lchown(const char* __path, uid_t __owner, gid_t __group)
     REGISTER_HANDLER(libc_handlers, lchown, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "path", arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("owner={:#x}", arg1));
+        capture_value(trace_info, "owner", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("group={:#x}", arg2));
+        capture_value(trace_info, "group", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // char* getcwd(char* __buf, size_t __size)
     REGISTER_HANDLER(libc_handlers, getcwd, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg0));
+        capture_value(trace_info, "buf", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg1));
+        capture_value(trace_info, "size", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kString;
     });
 
@@ -1336,189 +1276,187 @@ DispatchLibc::DispatchLibc() {
     // int syncfs(int __fd)
     REGISTER_HANDLER(libc_handlers, syncfs, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int close(int __fd)
     REGISTER_HANDLER(libc_handlers, close, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // ssize_t read(int __fd, void* __buf, size_t __count)
     REGISTER_HANDLER(libc_handlers, read, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg1));
+        capture_value(trace_info, "buf", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("count={:#x}", arg2));
+        capture_value(trace_info, "count", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // ssize_t write(int __fd, const void* __buf, size_t __count)
     REGISTER_HANDLER(libc_handlers, write, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg1));
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("count={:#x}", arg2));
+        capture_buffer(trace_info, "buf", arg1, arg2);
+        capture_value(trace_info, "count", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int dup(int __old_fd)
     REGISTER_HANDLER(libc_handlers, dup, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("old_fd={:#x}", arg0));
+        capture_value(trace_info, "old_fd", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int dup2(int __old_fd, int __new_fd)
     REGISTER_HANDLER(libc_handlers, dup2, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("old_fd={:#x}", arg0));
+        capture_value(trace_info, "old_fd", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("new_fd={:#x}", arg1));
+        capture_value(trace_info, "new_fd", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int dup3(int __old_fd, int __new_fd, int __flags)
     REGISTER_HANDLER(libc_handlers, dup3, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("old_fd={:#x}", arg0));
+        capture_value(trace_info, "old_fd", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("new_fd={:#x}", arg1));
+        capture_value(trace_info, "new_fd", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("flags={:#x}", arg2));
+        capture_value(trace_info, "flags", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int fsync(int __fd)
     REGISTER_HANDLER(libc_handlers, fsync, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int fdatasync(int __fd)
     REGISTER_HANDLER(libc_handlers, fdatasync, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // off_t lseek(int __fd, off_t __offset, int __whence)
     REGISTER_HANDLER(libc_handlers, lseek, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("offset={:#x}", arg1));
+        capture_value(trace_info, "offset", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("whence={:#x}", arg2));
+        capture_value(trace_info, "whence", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // off64_t lseek64(int __fd, off64_t __offset, int __whence)
     REGISTER_HANDLER(libc_handlers, lseek64, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("offset={:#x}", arg1));
+        capture_value(trace_info, "offset", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("whence={:#x}", arg2));
+        capture_value(trace_info, "whence", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int truncate(const char* __path, off_t __length)
     REGISTER_HANDLER(libc_handlers, truncate, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "path", arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("length={:#x}", arg1));
+        capture_value(trace_info, "length", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int truncate64(const char* __path, off64_t __length)
     REGISTER_HANDLER(libc_handlers, truncate64, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "path", arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("length={:#x}", arg1));
+        capture_value(trace_info, "length", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // ssize_t pread(int __fd, void* __buf, size_t __count, off_t __offset)
     REGISTER_HANDLER(libc_handlers, pread, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg1));
+        capture_value(trace_info, "buf", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("count={:#x}", arg2));
+        capture_value(trace_info, "count", kCallArgHex, arg2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(fmt::format("offset={:#x}", arg3));
+        capture_value(trace_info, "offset", kCallArgHex, arg3);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // ssize_t pread64(int __fd, void* __buf, size_t __count, off64_t __offset)
     REGISTER_HANDLER(libc_handlers, pread64, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg1));
+        capture_value(trace_info, "buf", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("count={:#x}", arg2));
+        capture_value(trace_info, "count", kCallArgHex, arg2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(fmt::format("offset={:#x}", arg3));
+        capture_value(trace_info, "offset", kCallArgHex, arg3);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // ssize_t pwrite(int __fd, const void* __buf, size_t __count, off_t __offset)
     REGISTER_HANDLER(libc_handlers, pwrite, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg1));
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("count={:#x}", arg2));
+        capture_buffer(trace_info, "buf", arg1, arg2);
+        capture_value(trace_info, "count", kCallArgHex, arg2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(fmt::format("offset={:#x}", arg3));
+        capture_value(trace_info, "offset", kCallArgHex, arg3);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // ssize_t pwrite64(int __fd, const void* __buf, size_t __count, off64_t __offset)
     REGISTER_HANDLER(libc_handlers, pwrite64, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg1));
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("count={:#x}", arg2));
+        capture_buffer(trace_info, "buf", arg1, arg2);
+        capture_value(trace_info, "count", kCallArgHex, arg2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(fmt::format("offset={:#x}", arg3));
+        capture_value(trace_info, "offset", kCallArgHex, arg3);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int ftruncate(int __fd, off_t __length)
     REGISTER_HANDLER(libc_handlers, ftruncate, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("length={:#x}", arg1));
+        capture_value(trace_info, "length", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int ftruncate64(int __fd, off64_t __length)
     REGISTER_HANDLER(libc_handlers, ftruncate64, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("length={:#x}", arg1));
+        capture_value(trace_info, "length", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
@@ -1530,87 +1468,85 @@ DispatchLibc::DispatchLibc() {
     // unsigned int alarm(unsigned int __seconds)
     REGISTER_HANDLER(libc_handlers, alarm, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("seconds={:#x}", arg0));
+        capture_value(trace_info, "seconds", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // unsigned int sleep(unsigned int __seconds)
     REGISTER_HANDLER(libc_handlers, sleep, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("seconds={:#x}", arg0));
+        capture_value(trace_info, "seconds", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int usleep(useconds_t __microseconds)
     REGISTER_HANDLER(libc_handlers, usleep, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("microseconds={:#x}", arg0));
+        capture_value(trace_info, "microseconds", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int gethostname(char* __buf, size_t __buf_size)
     REGISTER_HANDLER(libc_handlers, gethostname, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg0));
+        capture_value(trace_info, "buf", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("buf_size={:#x}", arg1));
+        capture_value(trace_info, "buf_size", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int sethostname(const char* __name, size_t __n)
     REGISTER_HANDLER(libc_handlers, sethostname, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("name={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "name", arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("n={:#x}", arg1));
+        capture_value(trace_info, "n", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int brk(void* __addr)
     REGISTER_HANDLER(libc_handlers, brk, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("addr={:#x}", arg0));
+        capture_value(trace_info, "addr", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // void* sbrk(ptrdiff_t __increment)
     REGISTER_HANDLER(libc_handlers, sbrk, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("increment={:#x}", arg0));
+        capture_value(trace_info, "increment", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kPointer;
     });
 
     // int isatty(int __fd)
     REGISTER_HANDLER(libc_handlers, isatty, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // char* ttyname(int __fd)
     REGISTER_HANDLER(libc_handlers, ttyname, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kString;
     });
 
     // int ttyname_r(int __fd, char* __buf, size_t __buf_size)
     REGISTER_HANDLER(libc_handlers, ttyname_r, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg0));
+        capture_value(trace_info, "fd", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg1));
+        capture_value(trace_info, "buf", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("buf_size={:#x}", arg2));
+        capture_value(trace_info, "buf_size", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int acct(const char* __path)
     REGISTER_HANDLER(libc_handlers, acct, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "path", arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
@@ -1622,151 +1558,151 @@ DispatchLibc::DispatchLibc() {
     // long syscall(long __number, ...)
     REGISTER_HANDLER(libc_handlers, syscall, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("number={:#x}", arg0));
+        capture_value(trace_info, "number", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int daemon(int __no_chdir, int __no_close)
     REGISTER_HANDLER(libc_handlers, daemon, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("no_chdir={:#x}", arg0));
+        capture_value(trace_info, "no_chdir", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("no_close={:#x}", arg1));
+        capture_value(trace_info, "no_close", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // time_t time(time_t* __t)
     REGISTER_HANDLER(libc_handlers, time, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("t={:#x}", arg0));
+        capture_value(trace_info, "t", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int nanosleep(const struct timespec* __request, struct timespec* __remainder)
     REGISTER_HANDLER(libc_handlers, nanosleep, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("request={:#x}", arg0));
+        capture_value(trace_info, "request", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("remainder={:#x}", arg1));
+        capture_value(trace_info, "remainder", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // char* asctime(const struct tm* __tm)
     REGISTER_HANDLER(libc_handlers, asctime, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("tm={:#x}", arg0));
+        capture_value(trace_info, "tm", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kString;
     });
 
     // char* asctime_r(const struct tm* __tm, char* __buf)
     REGISTER_HANDLER(libc_handlers, asctime_r, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("tm={:#x}", arg0));
+        capture_value(trace_info, "tm", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg1));
+        capture_value(trace_info, "buf", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kString;
     });
 
     // double difftime(time_t __lhs, time_t __rhs)
     REGISTER_HANDLER(libc_handlers, difftime, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("lhs={:#x}", arg0));
+        capture_value(trace_info, "lhs", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("rhs={:#x}", arg1));
+        capture_value(trace_info, "rhs", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // time_t mktime(struct tm* __tm)
     REGISTER_HANDLER(libc_handlers, mktime, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("tm={:#x}", arg0));
+        capture_value(trace_info, "tm", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // struct tm* localtime(const time_t* __t)
     REGISTER_HANDLER(libc_handlers, localtime, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("t={:#x}", arg0));
+        capture_value(trace_info, "t", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kPointer;
     });
 
     // struct tm* localtime_r(const time_t* __t, struct tm* __tm)
     REGISTER_HANDLER(libc_handlers, localtime_r, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("t={:#x}", arg0));
+        capture_value(trace_info, "t", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("tm={:#x}", arg1));
+        capture_value(trace_info, "tm", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kPointer;
     });
 
     // struct tm* gmtime(const time_t* __t)
     REGISTER_HANDLER(libc_handlers, gmtime, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("t={:#x}", arg0));
+        capture_value(trace_info, "t", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kPointer;
     });
 
     // struct tm* gmtime_r(const time_t* __t, struct tm* __tm)
     REGISTER_HANDLER(libc_handlers, gmtime_r, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("t={:#x}", arg0));
+        capture_value(trace_info, "t", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("tm={:#x}", arg1));
+        capture_value(trace_info, "tm", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kPointer;
     });
 
     // char* strptime(const char* __s, const char* __fmt, struct tm* __tm)
     REGISTER_HANDLER(libc_handlers, strptime, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("s={}", read_string_from_address(arg0)));
+        capture_string(trace_info, "s", arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("fmt={}", read_string_from_address(arg1)));
+        capture_string(trace_info, "fmt", arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("tm={:#x}", arg2));
+        capture_value(trace_info, "tm", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kString;
     });
 
     // size_t strftime(char* __buf, size_t __n, const char* __fmt, const struct tm* __tm)
     REGISTER_HANDLER(libc_handlers, strftime, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg0));
+        capture_value(trace_info, "buf", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("n={:#x}", arg1));
+        capture_value(trace_info, "n", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("fmt={}", read_string_from_address(arg2)));
+        capture_string(trace_info, "fmt", arg2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(fmt::format("tm={:#x}", arg3));
+        capture_value(trace_info, "tm", kCallArgHex, arg3);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // size_t strftime_l(char* __buf, size_t __n, const char* __fmt, const struct tm* __tm, locale_t __l)
     REGISTER_HANDLER(libc_handlers, strftime_l, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg0));
+        capture_value(trace_info, "buf", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("n={:#x}", arg1));
+        capture_value(trace_info, "n", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("fmt={}", read_string_from_address(arg2)));
+        capture_string(trace_info, "fmt", arg2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(fmt::format("tm={:#x}", arg3));
+        capture_value(trace_info, "tm", kCallArgHex, arg3);
         auto arg4 = get_arg_register_value(&trace_info->pre_status, 4);
-        trace_info->fun_call->args.push_back(fmt::format("l={:#x}", arg4));
+        capture_value(trace_info, "l", kCallArgHex, arg4);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // char* ctime(const time_t* __t)
     REGISTER_HANDLER(libc_handlers, ctime, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("t={:#x}", arg0));
+        capture_value(trace_info, "t", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kString;
     });
 
     // char* ctime_r(const time_t* __t, char* __buf)
     REGISTER_HANDLER(libc_handlers, ctime_r, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("t={:#x}", arg0));
+        capture_value(trace_info, "t", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg1));
+        capture_value(trace_info, "buf", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kString;
     });
 
@@ -1783,121 +1719,121 @@ DispatchLibc::DispatchLibc() {
     // int clock_getcpuclockid(pid_t __pid, clockid_t* __clock)
     REGISTER_HANDLER(libc_handlers, clock_getcpuclockid, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("pid={:#x}", arg0));
+        capture_value(trace_info, "pid", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("clock={:#x}", arg1));
+        capture_value(trace_info, "clock", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int clock_getres(clockid_t __clock, struct timespec* __resolution)
     REGISTER_HANDLER(libc_handlers, clock_getres, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("clock={:#x}", arg0));
+        capture_value(trace_info, "clock", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("resolution={:#x}", arg1));
+        capture_value(trace_info, "resolution", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int clock_gettime(clockid_t __clock, struct timespec* __ts)
     REGISTER_HANDLER(libc_handlers, clock_gettime, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("clock={:#x}", arg0));
+        capture_value(trace_info, "clock", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("ts={:#x}", arg1));
+        capture_value(trace_info, "ts", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int clock_nanosleep(clockid_t __clock, int __flags, const struct timespec* __request, struct timespec* __remainder)
     REGISTER_HANDLER(libc_handlers, clock_nanosleep, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("clock={:#x}", arg0));
+        capture_value(trace_info, "clock", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("flags={:#x}", arg1));
+        capture_value(trace_info, "flags", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("request={:#x}", arg2));
+        capture_value(trace_info, "request", kCallArgHex, arg2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(fmt::format("remainder={:#x}", arg3));
+        capture_value(trace_info, "remainder", kCallArgHex, arg3);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int clock_settime(clockid_t __clock, const struct timespec* __ts)
     REGISTER_HANDLER(libc_handlers, clock_settime, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("clock={:#x}", arg0));
+        capture_value(trace_info, "clock", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("ts={:#x}", arg1));
+        capture_value(trace_info, "ts", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int timer_create(clockid_t __clock, struct sigevent* __event, timer_t* __timer_ptr)
     REGISTER_HANDLER(libc_handlers, timer_create, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("clock={:#x}", arg0));
+        capture_value(trace_info, "clock", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("event={:#x}", arg1));
+        capture_value(trace_info, "event", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("timer_ptr={:#x}", arg2));
+        capture_value(trace_info, "timer_ptr", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int timer_delete(timer_t __timer)
     REGISTER_HANDLER(libc_handlers, timer_delete, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("timer={:#x}", arg0));
+        capture_value(trace_info, "timer", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int timer_settime(timer_t __timer, int __flags, const struct itimerspec* __new_value, struct itimerspec* __old_value)
     REGISTER_HANDLER(libc_handlers, timer_settime, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("timer={:#x}", arg0));
+        capture_value(trace_info, "timer", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("flags={:#x}", arg1));
+        capture_value(trace_info, "flags", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("new_value={:#x}", arg2));
+        capture_value(trace_info, "new_value", kCallArgHex, arg2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(fmt::format("old_value={:#x}", arg3));
+        capture_value(trace_info, "old_value", kCallArgHex, arg3);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int timer_gettime(timer_t __timer, struct itimerspec* __ts)
     REGISTER_HANDLER(libc_handlers, timer_gettime, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("timer={:#x}", arg0));
+        capture_value(trace_info, "timer", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("ts={:#x}", arg1));
+        capture_value(trace_info, "ts", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int timer_getoverrun(timer_t __timer)
     REGISTER_HANDLER(libc_handlers, timer_getoverrun, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("timer={:#x}", arg0));
+        capture_value(trace_info, "timer", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // time_t timelocal(struct tm* __tm)
     REGISTER_HANDLER(libc_handlers, timelocal, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("tm={:#x}", arg0));
+        capture_value(trace_info, "tm", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // time_t timegm(struct tm* __tm)
     REGISTER_HANDLER(libc_handlers, timegm, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("tm={:#x}", arg0));
+        capture_value(trace_info, "tm", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     // int pthread_atfork(void (*__prepare)(void), void (*__parent)(void), void (*__child)(void))
 #if __ANDROID_API__ >= 12
     REGISTER_HANDLER(libc_handlers, pthread_atfork, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("prepare={:#x}", arg0));
+        capture_value(trace_info, "prepare", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("parent={:#x}", arg1));
+        capture_value(trace_info, "parent", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("child={:#x}", arg2));
+        capture_value(trace_info, "child", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
 #endif /* __ANDROID_API__ >= 12 */
@@ -1905,151 +1841,151 @@ DispatchLibc::DispatchLibc() {
     // int pthread_attr_destroy(pthread_attr_t* __attr)
     REGISTER_HANDLER(libc_handlers, pthread_attr_destroy, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_attr_getdetachstate(const pthread_attr_t* __attr, int* __state)
     REGISTER_HANDLER(libc_handlers, pthread_attr_getdetachstate, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("state={:#x}", arg1));
+        capture_value(trace_info, "state", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_attr_getguardsize(const pthread_attr_t* __attr, size_t* __size)
     REGISTER_HANDLER(libc_handlers, pthread_attr_getguardsize, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg1));
+        capture_value(trace_info, "size", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_attr_getschedparam(const pthread_attr_t* __attr, struct sched_param* __param)
     REGISTER_HANDLER(libc_handlers, pthread_attr_getschedparam, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("param={:#x}", arg1));
+        capture_value(trace_info, "param", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_attr_getschedpolicy(const pthread_attr_t* __attr, int* __policy)
     REGISTER_HANDLER(libc_handlers, pthread_attr_getschedpolicy, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("policy={:#x}", arg1));
+        capture_value(trace_info, "policy", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_attr_getscope(const pthread_attr_t* __attr, int* __scope)
     REGISTER_HANDLER(libc_handlers, pthread_attr_getscope, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("scope={:#x}", arg1));
+        capture_value(trace_info, "scope", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_attr_getstack(const pthread_attr_t* __attr, void** __addr, size_t* __size)
     REGISTER_HANDLER(libc_handlers, pthread_attr_getstack, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("addr={:#x}", arg1));
+        capture_value(trace_info, "addr", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg2));
+        capture_value(trace_info, "size", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_attr_getstacksize(const pthread_attr_t* __attr, size_t* __size)
     REGISTER_HANDLER(libc_handlers, pthread_attr_getstacksize, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg1));
+        capture_value(trace_info, "size", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_attr_init(pthread_attr_t* __attr)
     REGISTER_HANDLER(libc_handlers, pthread_attr_init, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_attr_setdetachstate(pthread_attr_t* __attr, int __state)
     REGISTER_HANDLER(libc_handlers, pthread_attr_setdetachstate, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("state={:#x}", arg1));
+        capture_value(trace_info, "state", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_attr_setguardsize(pthread_attr_t* __attr, size_t __size)
     REGISTER_HANDLER(libc_handlers, pthread_attr_setguardsize, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg1));
+        capture_value(trace_info, "size", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_attr_setschedparam(pthread_attr_t* __attr, const struct sched_param* __param)
     REGISTER_HANDLER(libc_handlers, pthread_attr_setschedparam, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("param={:#x}", arg1));
+        capture_value(trace_info, "param", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_attr_setschedpolicy(pthread_attr_t* __attr, int __policy)
     REGISTER_HANDLER(libc_handlers, pthread_attr_setschedpolicy, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("policy={:#x}", arg1));
+        capture_value(trace_info, "policy", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_attr_setscope(pthread_attr_t* __attr, int __scope)
     REGISTER_HANDLER(libc_handlers, pthread_attr_setscope, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("scope={:#x}", arg1));
+        capture_value(trace_info, "scope", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_attr_setstack(pthread_attr_t* __attr, void* __addr, size_t __size)
     REGISTER_HANDLER(libc_handlers, pthread_attr_setstack, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("addr={:#x}", arg1));
+        capture_value(trace_info, "addr", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg2));
+        capture_value(trace_info, "size", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_attr_setstacksize(pthread_attr_t* __attr, size_t __size)
     REGISTER_HANDLER(libc_handlers, pthread_attr_setstacksize, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg1));
+        capture_value(trace_info, "size", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_condattr_destroy(pthread_condattr_t* __attr)
     REGISTER_HANDLER(libc_handlers, pthread_condattr_destroy, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
@@ -2057,9 +1993,9 @@ DispatchLibc::DispatchLibc() {
 #if __ANDROID_API__ >= 21
     REGISTER_HANDLER(libc_handlers, pthread_condattr_getclock, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("clock={:#x}", arg1));
+        capture_value(trace_info, "clock", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 #endif /* __ANDROID_API__ >= 21 */
@@ -2067,16 +2003,16 @@ DispatchLibc::DispatchLibc() {
     // int pthread_condattr_getpshared(const pthread_condattr_t* __attr, int* __shared)
     REGISTER_HANDLER(libc_handlers, pthread_condattr_getpshared, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("shared={:#x}", arg1));
+        capture_value(trace_info, "shared", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_condattr_init(pthread_condattr_t* __attr)
     REGISTER_HANDLER(libc_handlers, pthread_condattr_init, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
@@ -2084,9 +2020,9 @@ DispatchLibc::DispatchLibc() {
 #if __ANDROID_API__ >= 21
     REGISTER_HANDLER(libc_handlers, pthread_condattr_setclock, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("clock={:#x}", arg1));
+        capture_value(trace_info, "clock", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 #endif /* __ANDROID_API__ >= 21 */
@@ -2094,72 +2030,72 @@ DispatchLibc::DispatchLibc() {
     // int pthread_condattr_setpshared(pthread_condattr_t* __attr, int __shared)
     REGISTER_HANDLER(libc_handlers, pthread_condattr_setpshared, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg0));
+        capture_value(trace_info, "attr", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("shared={:#x}", arg1));
+        capture_value(trace_info, "shared", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_cond_broadcast(pthread_cond_t* __cond)
     REGISTER_HANDLER(libc_handlers, pthread_cond_broadcast, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("cond={:#x}", arg0));
+        capture_value(trace_info, "cond", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_cond_destroy(pthread_cond_t* __cond)
     REGISTER_HANDLER(libc_handlers, pthread_cond_destroy, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("cond={:#x}", arg0));
+        capture_value(trace_info, "cond", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_cond_init(pthread_cond_t* __cond, const pthread_condattr_t* __attr)
     REGISTER_HANDLER(libc_handlers, pthread_cond_init, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("cond={:#x}", arg0));
+        capture_value(trace_info, "cond", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg1));
+        capture_value(trace_info, "attr", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_cond_signal(pthread_cond_t* __cond)
     REGISTER_HANDLER(libc_handlers, pthread_cond_signal, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("cond={:#x}", arg0));
+        capture_value(trace_info, "cond", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_cond_timedwait(pthread_cond_t* __cond, pthread_mutex_t* __mutex, const struct timespec* __timeout)
     REGISTER_HANDLER(libc_handlers, pthread_cond_timedwait, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("cond={:#x}", arg0));
+        capture_value(trace_info, "cond", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("mutex={:#x}", arg1));
+        capture_value(trace_info, "mutex", kCallArgHex, arg1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("timeout={:#x}", arg2));
+        capture_value(trace_info, "timeout", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     // int pthread_cond_wait(pthread_cond_t* __cond, pthread_mutex_t* __mutex)
     REGISTER_HANDLER(libc_handlers, pthread_cond_wait, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("cond={:#x}", arg0));
+        capture_value(trace_info, "cond", kCallArgHex, arg0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("mutex={:#x}", arg1));
+        capture_value(trace_info, "mutex", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
     REGISTER_HANDLER(libc_handlers, pthread_create, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("thread_ptr={:#x}", arg0));
+            capture_value(trace_info, "thread_ptr", kCallArgHex, arg0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("attr={:#x}", arg1));
+            capture_value(trace_info, "attr", kCallArgHex, arg1);
             auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-            trace_info->fun_call->args.push_back(fmt::format("start_routine={:#x}", arg2));
+            capture_value(trace_info, "start_routine", kCallArgHex, arg2);
             auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-            trace_info->fun_call->args.push_back(fmt::format("arg={:#x}", arg3));
+            capture_value(trace_info, "arg", kCallArgHex, arg3);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2167,7 +2103,7 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, pthread_mutex_lock, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("mutex={:#x}", arg0));
+            capture_value(trace_info, "mutex", kCallArgHex, arg0);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2175,7 +2111,7 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, pthread_mutex_trylock, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("mutex={:#x}", arg0));
+            capture_value(trace_info, "mutex", kCallArgHex, arg0);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2183,9 +2119,9 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, pthread_key_create, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("key_ptr={:#x}", arg0));
+            capture_value(trace_info, "key_ptr", kCallArgHex, arg0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("destructor={:#x}", arg1));
+            capture_value(trace_info, "destructor", kCallArgHex, arg1);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2193,9 +2129,9 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, pthread_mutex_timedlock, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("mutex={:#x}", arg0));
+            capture_value(trace_info, "mutex", kCallArgHex, arg0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("timeout={:#x}", arg1));
+            capture_value(trace_info, "timeout", kCallArgHex, arg1);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2203,9 +2139,9 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, pthread_getattr_np, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("thread={:#x}", arg0));
+            capture_value(trace_info, "thread", kCallArgHex, arg0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("attr_ptr={:#x}", arg1));
+            capture_value(trace_info, "attr_ptr", kCallArgHex, arg1);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2213,20 +2149,20 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, pthread_cond_timedwait_relative_np, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("cond={:#x}", arg0));
+            capture_value(trace_info, "cond", kCallArgHex, arg0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("mutex={:#x}", arg1));
+            capture_value(trace_info, "mutex", kCallArgHex, arg1);
             auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-            trace_info->fun_call->args.push_back(fmt::format("rel_time={:#x}", arg2));
+            capture_value(trace_info, "rel_time", kCallArgHex, arg2);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
     REGISTER_HANDLER(libc_handlers, gettimeofday, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("tv={:#x}", arg0));
+            capture_value(trace_info, "tv", kCallArgHex, arg0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("tz={:#x}", arg1));
+            capture_value(trace_info, "tz", kCallArgHex, arg1);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2234,9 +2170,9 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, settimeofday, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("tv={:#x}", arg0));
+            capture_value(trace_info, "tv", kCallArgHex, arg0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("tz={:#x}", arg1));
+            capture_value(trace_info, "tz", kCallArgHex, arg1);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2244,9 +2180,9 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, getitimer, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("which={}", arg0));
+            capture_value(trace_info, "which", kCallArgUnsigned, arg0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("current_value={:#x}", arg1));
+            capture_value(trace_info, "current_value", kCallArgHex, arg1);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2254,11 +2190,11 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, setitimer, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("which={}", arg0));
+            capture_value(trace_info, "which", kCallArgUnsigned, arg0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("new_value={:#x}", arg1));
+            capture_value(trace_info, "new_value", kCallArgHex, arg1);
             auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-            trace_info->fun_call->args.push_back(fmt::format("old_value={:#x}", arg2));
+            capture_value(trace_info, "old_value", kCallArgHex, arg2);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2266,10 +2202,9 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, utimes, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(
-                    fmt::format("path=\"{}\"", reinterpret_cast<const char *>(arg0)));
+            capture_string(trace_info, "path", arg0, true);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("times={:#x}", arg1));
+            capture_value(trace_info, "times", kCallArgHex, arg1);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2277,10 +2212,9 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, statfs, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(
-                    fmt::format("path=\"{}\"", reinterpret_cast<const char *>(arg0)));
+            capture_string(trace_info, "path", arg0, true);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg1));
+            capture_value(trace_info, "buf", kCallArgHex, arg1);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2289,10 +2223,9 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, statfs64, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(
-                    fmt::format("path=\"{}\"", reinterpret_cast<const char *>(arg0)));
+            capture_string(trace_info, "path", arg0, true);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg1));
+            capture_value(trace_info, "buf", kCallArgHex, arg1);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2301,9 +2234,9 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, fstatfs, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("fd={}", arg0));
+            capture_value(trace_info, "fd", kCallArgUnsigned, arg0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg1));
+            capture_value(trace_info, "buf", kCallArgHex, arg1);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2312,9 +2245,9 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, fstatfs64, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("fd={}", arg0));
+            capture_value(trace_info, "fd", kCallArgUnsigned, arg0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg1));
+            capture_value(trace_info, "buf", kCallArgHex, arg1);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2323,7 +2256,7 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, wait, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("status={:#x}", arg0));
+            capture_value(trace_info, "status", kCallArgHex, arg0);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2331,11 +2264,11 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, waitpid, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("pid={}", arg0));
+            capture_value(trace_info, "pid", kCallArgUnsigned, arg0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("status={:#x}", arg1));
+            capture_value(trace_info, "status", kCallArgHex, arg1);
             auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-            trace_info->fun_call->args.push_back(fmt::format("options={}", arg2));
+            capture_value(trace_info, "options", kCallArgUnsigned, arg2);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2344,13 +2277,13 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, wait4, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("pid={}", arg0));
+            capture_value(trace_info, "pid", kCallArgUnsigned, arg0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("status={:#x}", arg1));
+            capture_value(trace_info, "status", kCallArgHex, arg1);
             auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-            trace_info->fun_call->args.push_back(fmt::format("options={}", arg2));
+            capture_value(trace_info, "options", kCallArgUnsigned, arg2);
             auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-            trace_info->fun_call->args.push_back(fmt::format("rusage={:#x}", arg3));
+            capture_value(trace_info, "rusage", kCallArgHex, arg3);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2359,20 +2292,20 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, waitid, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("type={}", arg0));
+            capture_value(trace_info, "type", kCallArgUnsigned, arg0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("id={}", arg1));
+            capture_value(trace_info, "id", kCallArgUnsigned, arg1);
             auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-            trace_info->fun_call->args.push_back(fmt::format("info={:#x}", arg2));
+            capture_value(trace_info, "info", kCallArgHex, arg2);
             auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-            trace_info->fun_call->args.push_back(fmt::format("options={}", arg3));
+            capture_value(trace_info, "options", kCallArgUnsigned, arg3);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
     REGISTER_HANDLER(libc_handlers, clearerr, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("fp={:#x}", arg0));
+            capture_value(trace_info, "fp", kCallArgHex, arg0);
             trace_info->fun_call->ret_type = kVoid;
         }
     });
@@ -2380,7 +2313,7 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, fclose, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("fp={:#x}", arg0));
+            capture_value(trace_info, "fp", kCallArgHex, arg0);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2388,7 +2321,7 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, feof, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("fp={:#x}", arg0));
+            capture_value(trace_info, "fp", kCallArgHex, arg0);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2396,7 +2329,7 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, ferror, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("fp={:#x}", arg0));
+            capture_value(trace_info, "fp", kCallArgHex, arg0);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2404,7 +2337,7 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, fflush, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("fp={:#x}", arg0));
+            capture_value(trace_info, "fp", kCallArgHex, arg0);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2412,7 +2345,7 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, fgetc, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("fp={:#x}", arg0));
+            capture_value(trace_info, "fp", kCallArgHex, arg0);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2420,11 +2353,11 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, fgets, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg0));
+            capture_value(trace_info, "buf", kCallArgHex, arg0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("size={}", arg1));
+            capture_value(trace_info, "size", kCallArgUnsigned, arg1);
             auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-            trace_info->fun_call->args.push_back(fmt::format("fp={:#x}", arg2));
+            capture_value(trace_info, "fp", kCallArgHex, arg2);
             trace_info->fun_call->ret_type = kPointer;
         }
     });
@@ -2432,10 +2365,9 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, fprintf, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("fp={:#x}", arg0));
+            capture_value(trace_info, "fp", kCallArgHex, arg0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(
-                    fmt::format("fmt=\"{}\"", reinterpret_cast<const char *>(arg1)));
+            capture_string(trace_info, "fmt", arg1, true);
             // Variadic arguments are not captured here.
             trace_info->fun_call->ret_type = kNumber;
         }
@@ -2444,9 +2376,9 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, fputc, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("ch={}", arg0));
+            capture_value(trace_info, "ch", kCallArgUnsigned, arg0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("fp={:#x}", arg1));
+            capture_value(trace_info, "fp", kCallArgHex, arg1);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2454,10 +2386,9 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, fputs, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(
-                    fmt::format("s=\"{}\"", reinterpret_cast<const char *>(arg0)));
+            capture_string(trace_info, "s", arg0, true);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("fp={:#x}", arg1));
+            capture_value(trace_info, "fp", kCallArgHex, arg1);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2465,13 +2396,13 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, fread, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg0));
+            capture_value(trace_info, "buf", kCallArgHex, arg0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("size={}", arg1));
+            capture_value(trace_info, "size", kCallArgUnsigned, arg1);
             auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-            trace_info->fun_call->args.push_back(fmt::format("count={}", arg2));
+            capture_value(trace_info, "count", kCallArgUnsigned, arg2);
             auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-            trace_info->fun_call->args.push_back(fmt::format("fp={:#x}", arg3));
+            capture_value(trace_info, "fp", kCallArgHex, arg3);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2479,10 +2410,9 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, fscanf, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("fp={:#x}", arg0));
+            capture_value(trace_info, "fp", kCallArgHex, arg0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(
-                    fmt::format("fmt=\"{}\"", reinterpret_cast<const char *>(arg1)));
+            capture_string(trace_info, "fmt", arg1, true);
             // Variadic arguments are not captured here.
             trace_info->fun_call->ret_type = kNumber;
         }
@@ -2491,13 +2421,13 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, fwrite, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("buf={:#x}", arg0));
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-            trace_info->fun_call->args.push_back(fmt::format("size={}", arg1));
             auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-            trace_info->fun_call->args.push_back(fmt::format("count={}", arg2));
+            capture_buffer(trace_info, "buf", arg0, arg1 * arg2);
+            capture_value(trace_info, "size", kCallArgUnsigned, arg1);
+            capture_value(trace_info, "count", kCallArgUnsigned, arg2);
             auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-            trace_info->fun_call->args.push_back(fmt::format("fp={:#x}", arg3));
+            capture_value(trace_info, "fp", kCallArgHex, arg3);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2505,7 +2435,7 @@ DispatchLibc::DispatchLibc() {
     REGISTER_HANDLER(libc_handlers, getc, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("fp={:#x}", arg0));
+            capture_value(trace_info, "fp", kCallArgHex, arg0);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2525,10 +2455,10 @@ DispatchLibc::DispatchLibc() {
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
             auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
             auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-            trace_info->fun_call->args.push_back(fmt::format("lineptr={:#x}", arg0));
-            trace_info->fun_call->args.push_back(fmt::format("line_length_ptr={:#x}", arg1));
-            trace_info->fun_call->args.push_back(fmt::format("delimiter={:#x}", arg2));
-            trace_info->fun_call->args.push_back(fmt::format("fp={:#x}", arg3));
+            capture_value(trace_info, "lineptr", kCallArgHex, arg0);
+            capture_value(trace_info, "line_length_ptr", kCallArgHex, arg1);
+            capture_value(trace_info, "delimiter", kCallArgHex, arg2);
+            capture_value(trace_info, "fp", kCallArgHex, arg3);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2537,9 +2467,9 @@ DispatchLibc::DispatchLibc() {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
             auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-            trace_info->fun_call->args.push_back(fmt::format("lineptr={:#x}", arg0));
-            trace_info->fun_call->args.push_back(fmt::format("line_length_ptr={:#x}", arg1));
-            trace_info->fun_call->args.push_back(fmt::format("fp={:#x}", arg2));
+            capture_value(trace_info, "lineptr", kCallArgHex, arg0);
+            capture_value(trace_info, "line_length_ptr", kCallArgHex, arg1);
+            capture_value(trace_info, "fp", kCallArgHex, arg2);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2549,19 +2479,17 @@ DispatchLibc::DispatchLibc() {
         int scanf(const char* __fmt, ...) __scanflike(1, 2);*/
     REGISTER_HANDLER(libc_handlers, remove, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("path={}", reinterpret_cast<const char *>(arg0)));
+        capture_string(trace_info, "path", arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     REGISTER_HANDLER(libc_handlers, rewind, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("fp={:#x}", arg0));
+        capture_value(trace_info, "fp", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kVoid;
     });
     REGISTER_HANDLER(libc_handlers, scanf, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(
-                fmt::format("fmt={}", reinterpret_cast<const char *>(arg0)));
+        capture_string(trace_info, "fmt", arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     /*
@@ -2573,16 +2501,16 @@ DispatchLibc::DispatchLibc() {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
             auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
             auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-            trace_info->fun_call->args.push_back(fmt::format("fp={:#x}", arg0));
-            trace_info->fun_call->args.push_back(fmt::format("offset={:#x}", arg1));
-            trace_info->fun_call->args.push_back(fmt::format("whence={:#x}", arg2));
+            capture_value(trace_info, "fp", kCallArgHex, arg0);
+            capture_value(trace_info, "offset", kCallArgHex, arg1);
+            capture_value(trace_info, "whence", kCallArgHex, arg2);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
     REGISTER_HANDLER(libc_handlers, ftell, {
         {
             auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-            trace_info->fun_call->args.push_back(fmt::format("fp={:#x}", arg0));
+            capture_value(trace_info, "fp", kCallArgHex, arg0);
             trace_info->fun_call->ret_type = kNumber;
         }
     });
@@ -2596,12 +2524,12 @@ DispatchLibc::DispatchLibc() {
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
         auto arg4 = get_arg_register_value(&trace_info->pre_status, 4);
         auto arg5 = get_arg_register_value(&trace_info->pre_status, 5);
-        trace_info->fun_call->args.push_back(fmt::format("addr={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("prot={:#x}", arg2));
-        trace_info->fun_call->args.push_back(fmt::format("flags={:#x}", arg3));
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg3));
-        trace_info->fun_call->args.push_back(fmt::format("offset={:#x}", arg4));
+        capture_value(trace_info, "addr", kCallArgHex, arg0);
+        capture_value(trace_info, "size", kCallArgHex, arg1);
+        capture_value(trace_info, "prot", kCallArgHex, arg2);
+        capture_value(trace_info, "flags", kCallArgHex, arg3);
+        capture_value(trace_info, "fd", kCallArgHex, arg3);
+        capture_value(trace_info, "offset", kCallArgHex, arg4);
         trace_info->fun_call->ret_type = kPointer;
     });
     REGISTER_HANDLER(libc_handlers, mmap64, {
@@ -2611,20 +2539,20 @@ DispatchLibc::DispatchLibc() {
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
         auto arg4 = get_arg_register_value(&trace_info->pre_status, 4);
         auto arg5 = get_arg_register_value(&trace_info->pre_status, 5);
-        trace_info->fun_call->args.push_back(fmt::format("addr={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("prot={:#x}", arg2));
-        trace_info->fun_call->args.push_back(fmt::format("flags={:#x}", arg3));
-        trace_info->fun_call->args.push_back(fmt::format("fd={:#x}", arg3));
-        trace_info->fun_call->args.push_back(fmt::format("offset={:#x}", arg4));
+        capture_value(trace_info, "addr", kCallArgHex, arg0);
+        capture_value(trace_info, "size", kCallArgHex, arg1);
+        capture_value(trace_info, "prot", kCallArgHex, arg2);
+        capture_value(trace_info, "flags", kCallArgHex, arg3);
+        capture_value(trace_info, "fd", kCallArgHex, arg3);
+        capture_value(trace_info, "offset", kCallArgHex, arg4);
         trace_info->fun_call->ret_type = kPointer;
     });
     //    int munmap(void* __addr, size_t __size);
     REGISTER_HANDLER(libc_handlers, munmap, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("addr={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg1));
+        capture_value(trace_info, "addr", kCallArgHex, arg0);
+        capture_value(trace_info, "size", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
 
@@ -2633,192 +2561,245 @@ DispatchLibc::DispatchLibc() {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-        trace_info->fun_call->args.push_back(fmt::format("addr={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("size={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("prot={:#x}", arg2));
+        capture_value(trace_info, "addr", kCallArgHex, arg0);
+        capture_value(trace_info, "size", kCallArgHex, arg1);
+        capture_value(trace_info, "prot", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
+    register_ret_handlers(module.get());
     module->enumerate_exports(dispatch_export_func, this);
+}
+
+void DispatchLibc::register_ret_handlers(stl::Library *module) {
+    REGISTER_RET_HANDLER(libc_format_handlers, sprintf, {
+        auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
+        auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
+        if (arg0 == 0) {
+            return;
+        }
+        clear_args(trace_info);
+        capture_string(trace_info, "fmt", arg1);
+        trace_info->fun_call->ret_value = fmt::format("{}", read_string_from_address(arg0));
+    });
+    REGISTER_RET_HANDLER(libc_format_handlers, vsprintf, {
+        auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
+        auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
+        if (arg0 == 0) {
+            return;
+        }
+        clear_args(trace_info);
+        capture_string(trace_info, "fmt", arg1);
+        trace_info->fun_call->ret_value = fmt::format("{}", read_string_from_address(arg0));
+    });
+    REGISTER_RET_HANDLER(libc_format_handlers, snprintf, {
+        //int snprintf(char* __buf, size_t __size, const char* __fmt, ...)
+        auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
+        auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
+        auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
+        if (arg0 == 0) {
+            return;
+        }
+        clear_args(trace_info);
+        capture_value(trace_info, "size", kCallArgHex, arg1);
+        capture_string(trace_info, "fmt", arg2);
+        trace_info->fun_call->ret_value = fmt::format("{}", read_string_from_address(arg0));
+    });
+    REGISTER_RET_HANDLER(libc_format_handlers, sscanf, {
+        //int sscanf(const char* __s, const char* __fmt, ...)
+        auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
+        auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
+        if (arg0 == 0) {
+            return;
+        }
+        clear_args(trace_info);
+        capture_string(trace_info, "fmt", arg1);
+        trace_info->fun_call->ret_value = fmt::format("{}", read_string_from_address(arg0));
+    });
 
+    // ssize_t read(int __fd, void* __buf, size_t __count) and the pread family
+    REGISTER_RET_HANDLER(libc_output_handlers, read, {
+        auto ret_value = static_cast<intptr_t>(get_ret_register_value(ret_status, 0));
+        if (ret_value > 0) {
+            capture_output(trace_info, 1, ret_value);
+        }
+    });
+    REGISTER_RET_HANDLER(libc_output_handlers, pread, {
+        auto ret_value = static_cast<intptr_t>(get_ret_register_value(ret_status, 0));
+        if (ret_value > 0) {
+            capture_output(trace_info, 1, ret_value);
+        }
+    });
+    REGISTER_RET_HANDLER(libc_output_handlers, pread64, {
+        auto ret_value = static_cast<intptr_t>(get_ret_register_value(ret_status, 0));
+        if (ret_value > 0) {
+            capture_output(trace_info, 1, ret_value);
+        }
+    });
+    // size_t fread(void* __buf, size_t __size, size_t __count, FILE* __fp)
+    REGISTER_RET_HANDLER(libc_output_handlers, fread, {
+        auto ret_value = get_ret_register_value(ret_status, 0);
+        auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
+        if (ret_value != 0) {
+            capture_output(trace_info, 0, ret_value * arg1);
+        }
+    });
+
+    REGISTER_RET_HANDLER(libc_memory_handlers, malloc, {
+        auto ret_value = get_ret_register_value(ret_status, 0);
+        auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
+        if (arg0 == 0 || ret_value == 0) {
+            return;
+        }
+        trace_info->fun_call->memory_alloc_address = ret_value;
+        trace_info->fun_call->memory_alloc_size = arg0;
+    });
+    REGISTER_RET_HANDLER(libc_memory_handlers, strdup, {
+        auto ret_value = get_ret_register_value(ret_status, 0);
+        auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
+        if (arg0 == 0 || ret_value == 0) {
+            return;
+        }
+        trace_info->fun_call->memory_alloc_address = ret_value;
+        trace_info->fun_call->memory_alloc_size = strlen((char *) arg0);
+    });
+    REGISTER_RET_HANDLER(libc_memory_handlers, free, {
+        auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
+        if (arg0 == 0) {
+            return;
+        }
+        trace_info->fun_call->memory_free_address = arg0;
+    });
+    REGISTER_RET_HANDLER(libc_memory_handlers, calloc, {
+        auto ret_value = get_ret_register_value(ret_status, 0);
+        auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
+        auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
+        if (arg0 == 0 || ret_value == 0 || arg1 == 0) {
+            return;
+        }
+        trace_info->fun_call->memory_alloc_address = ret_value;
+        trace_info->fun_call->memory_alloc_size = arg0 * arg1;
+    });
+    REGISTER_RET_HANDLER(libc_memory_handlers, realloc, {
+        //void* realloc(void* __ptr, size_t __byte_count)
+        auto ret_value = get_ret_register_value(ret_status, 0);
+        auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
+        auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
+        if (arg1 == 0) {
+            trace_info->fun_call->memory_free_address = arg0;
+            return;
+        }
+        if (ret_value != 0 || arg0 != 0) {
+            trace_info->fun_call->memory_free_address = arg0;
+        }
+        if (ret_value != 0) {
+            trace_info->fun_call->memory_alloc_address = ret_value;
+            trace_info->fun_call->memory_alloc_size = arg1;
+        }
+    });
+    REGISTER_RET_HANDLER(libc_memory_handlers, mmap, {
+        //void* mmap(void* __addr, size_t __byte_count, int __prot, int __flags, int __fd, off_t __offset)
+        auto ret_value = get_ret_register_value(ret_status, 0);
+        auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
+        if (arg1 == 0 || ret_value == 0) {
+            return;
+        }
+        trace_info->fun_call->memory_alloc_address = ret_value;
+        trace_info->fun_call->memory_alloc_size = arg1;
+        trace_info->fun_call->memory_map_changed = true;
+    });
+    // an alias of mmap on 64 bit, the insert is a no-op there
+    REGISTER_RET_HANDLER(libc_memory_handlers, mmap64, {
+        auto ret_value = get_ret_register_value(ret_status, 0);
+        auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
+        if (arg1 == 0 || ret_value == 0) {
+            return;
+        }
+        trace_info->fun_call->memory_alloc_address = ret_value;
+        trace_info->fun_call->memory_alloc_size = arg1;
+        trace_info->fun_call->memory_map_changed = true;
+    });
+    REGISTER_RET_HANDLER(libc_memory_handlers, munmap, {
+        //int munmap(void* __addr, size_t __byte_count)
+        auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
+        if (arg0 == 0) {
+            return;
+        }
+        trace_info->fun_call->memory_free_address = arg0;
+        trace_info->fun_call->memory_map_changed = true;
+    });
+    REGISTER_RET_HANDLER(libc_memory_handlers, mprotect, {
+        trace_info->fun_call->memory_map_changed = get_ret_register_value(ret_status, 0) == 0;
+    });
+    REGISTER_RET_HANDLER(libc_memory_handlers, mremap, {
+        trace_info->fun_call->memory_map_changed = true;
+    });
+    REGISTER_RET_HANDLER(libc_memory_handlers, brk, {
+        trace_info->fun_call->memory_map_changed = true;
+    });
+    REGISTER_RET_HANDLER(libc_memory_handlers, sbrk, {
+        trace_info->fun_call->memory_map_changed = true;
+    });
 }
 
-bool DispatchLibc::dispatch_args(inst_trace_info_t *info) {
-    if (!is_module_address(info->fun_call->fun_address)) {
-        return false;
+void DispatchLibc::resolve(uintptr_t address, dispatch_target_t *target) {
+    auto handler = libc_handlers.find(address);
+    if (handler != libc_handlers.end()) {
+        target->fun_name = handler->second.first;
+        target->args_handler = &handler->second.second;
+    } else {
+        DispatchBase::resolve(address, target);
+    }
+    auto memory_handler = libc_memory_handlers.find(address);
+    if (memory_handler != libc_memory_handlers.end()) {
+        target->ret_handler = memory_handler->second;
+    }
+    auto format_handler = libc_format_handlers.find(address);
+    if (format_handler != libc_format_handlers.end()) {
+        target->format_handler = format_handler->second;
     }
+    auto output_handler = libc_output_handlers.find(address);
+    if (output_handler != libc_output_handlers.end()) {
+        target->output_handler = output_handler->second;
+    }
+}
+
+bool DispatchLibc::dispatch_args(inst_trace_info_t *info, const dispatch_target_t &target) {
     info->fun_call->call_module_name = "libc.so";
-    auto handler = libc_handlers.find(info->fun_call->fun_address);
-    if (handler != libc_handlers.end()) {
-        auto pair = handler->second;
-        info->fun_call->fun_name = pair.first;
-        pair.second(info);
+    if (target.fun_name == nullptr) {
+        LOGE("fun_name is empty %p", (void *) info->fun_call->fun_address);
         return true;
     }
-    auto fun_name = get_address_symbol(info->fun_call->fun_address);
-    if (fun_name.empty()) {
-        LOGE("fun_name is empty %p", (void *) info->fun_call->fun_address);
+    info->fun_call->fun_name = target.fun_name;
+    if (target.args_handler != nullptr) {
+        (*target.args_handler)(info);
         return true;
     }
-    info->fun_call->fun_name = fun_name;
     add_common_reg_values(info);
 
     return true;
 }
 
-bool
-DispatchLibc::get_format_result(inst_trace_info_t *trace_info, const QBDI::GPRState *ret_status) {
-    auto fun_name = trace_info->fun_call->fun_name;
-    if (fun_name.empty()) {
-        return false;
-    }
+bool DispatchLibc::dispatch_ret(inst_trace_info_t *info, const QBDI::GPRState *ret_status,
+                                const dispatch_target_t &target) {
+    auto ret_type = info->fun_call->ret_type;
     auto ret_value = get_ret_register_value(ret_status, 0);
-    auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-    auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-    auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-
-    const std::unordered_map<std::string, std::function<void()>> format_fun_handlers = {
-            {"sprintf",  [&]() {
-                if (arg0 == 0) {
-                    return;
-                }
-                trace_info->fun_call->args.clear();
-                trace_info->fun_call->args.push_back(fmt::format("fmt={}", read_string_from_address(arg1)));
-                trace_info->fun_call->ret_value = fmt::format("{}", read_string_from_address(arg0));
-            }},
-            {"vsprintf", [&]() {
-                if (arg0 == 0) {
-                    return;
-                }
-                trace_info->fun_call->args.clear();
-                trace_info->fun_call->args.push_back(fmt::format("fmt={}", read_string_from_address(arg1)));
-                trace_info->fun_call->ret_value = fmt::format("{}", read_string_from_address(arg0));
-            }},
-            {"snprintf", [&]() {
-                if (arg0 == 0) {
-                    return;
-                }
-                //int snprintf(char* __buf, size_t __size, const char* __fmt, ...)
-                trace_info->fun_call->args.clear();
-                trace_info->fun_call->args.push_back(fmt::format("size={:#x}", (arg1)));
-                trace_info->fun_call->args.push_back(
-                        fmt::format("fmt={}", read_string_from_address(arg2)));
-                trace_info->fun_call->ret_value = fmt::format("{}", read_string_from_address(arg0));
-            }},
-            //int sscanf(const char* __s, const char* __fmt, ...)
-            {"sscanf",   [&]() {
-                if (arg0 == 0) {
-                    return;
-                }
-                trace_info->fun_call->args.clear();
-                trace_info->fun_call->args.push_back(
-                        fmt::format("fmt={}", read_string_from_address(arg1)));
-                trace_info->fun_call->ret_value = fmt::format("{}", read_string_from_address(arg0));
-            }},
-    };
-    if (format_fun_handlers.find(fun_name) != format_fun_handlers.end()) {
-        format_fun_handlers.at(fun_name)();
-        return true;
+    if (target.output_handler != nullptr) {
+        target.output_handler(info, ret_status);
     }
-    return false;
-}
-
-void
-DispatchLibc::record_memory_info(inst_trace_info_t *trace_info, const QBDI::GPRState *ret_status) {
-    auto fun_name = trace_info->fun_call->fun_name;
-    if (fun_name.empty()) {
-        return;
-    }
-    auto ret_value = get_ret_register_value(ret_status, 0);
-    auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-    auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-    auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
-    const std::unordered_map<std::string, std::function<void()>> memory_fun_handlers = {
-            {"malloc",  [&]() {
-                if (arg0 == 0 || ret_value == 0) {
-                    return;
-                }
-                trace_info->fun_call->memory_alloc_address = ret_value;
-                trace_info->fun_call->memory_alloc_size = arg0;
-                return;
-            }},
-            {"strdup",  [&]() {
-                if (arg0 == 0 || ret_value == 0) {
-                    return;
-                }
-                trace_info->fun_call->memory_alloc_address = ret_value;
-                trace_info->fun_call->memory_alloc_size = strlen((char *) arg0);
-            }},
-            {"free",    [&]() {
-                if (arg0 == 0) {
-                    return;
-                }
-                trace_info->fun_call->memory_free_address = arg0;
-            }},
-            {"calloc",  [&]() {
-                if (arg0 == 0 || ret_value == 0 || arg1 == 0) {
-                    return;
-                }
-                auto len = arg0 * arg1;
-                trace_info->fun_call->memory_alloc_address = ret_value;
-                trace_info->fun_call->memory_alloc_size = len;
-                return;
-            }},
-            {"realloc", [&]() {
-                //void* realloc(void* __ptr, size_t __byte_count)
-                if (arg1 == 0) {
-                    trace_info->fun_call->memory_free_address = arg0;
-                    return;
-                }
-                if (ret_value != 0 || arg0 != 0) {
-                    trace_info->fun_call->memory_free_address = arg0;
-                }
-                if (ret_value != 0) {
-                    trace_info->fun_call->memory_alloc_address = ret_value;
-                    trace_info->fun_call->memory_alloc_size = arg1;
-                }
-            }},
-            {"mmap",    [&]() {
-                //void* mmap(void* __addr, size_t __byte_count, int __prot, int __flags, int __fd, off_t __offset)
-                if (arg1 == 0 || ret_value == 0) {
-                    return;
-                }
-                trace_info->fun_call->memory_alloc_address = ret_value;
-                trace_info->fun_call->memory_alloc_size = arg1;
-            }},
-            {"mmap64",  [&]() {
-                //void* mmap(void* __addr, size_t __byte_count, int __prot, int __flags, int __fd, off_t __offset)
-                if (arg1 == 0 || ret_value == 0) {
-                    return;
-                }
-                trace_info->fun_call->memory_alloc_address = ret_value;
-                trace_info->fun_call->memory_alloc_size = arg1;
-            }},
-            {"munmap",  [&]() {
-                //int munmap(void* __addr, size_t __byte_count)
-                if (arg0 == 0) {
-                    return;
-                }
-                trace_info->fun_call->memory_free_address = arg0;
-            }},
-    };
-    if (memory_fun_handlers.find(fun_name) != memory_fun_handlers.end()) {
-        memory_fun_handlers.at(fun_name)();
+    if (target.ret_handler != nullptr) {
+        target.ret_handler(info, ret_status);
     }
-}
-
-bool DispatchLibc::dispatch_ret(inst_trace_info_t *info, const QBDI::GPRState *ret_status) {
-    if (!is_module_address(info->fun_call->fun_address)) {
-        return false;
+    if (info->fun_call->memory_map_changed) {
+        ArgCapture::get_instance()->invalidate();
     }
-    auto ret_type = info->fun_call->ret_type;
-    auto ret_value = get_ret_register_value(ret_status, 0);
-    record_memory_info(info, ret_status);
     switch (ret_type) {
-        case kUnknown:
-            if (get_format_result(info, ret_status)) {
+        case kUnknown: {
+            if (target.format_handler != nullptr) {
+                target.format_handler(info, ret_status);
                 return true;
             }
             break;
+        }
         case kPointer:
         case kNumber:
             info->fun_call->ret_value = fmt::format("ret={:#x}", ret_value);
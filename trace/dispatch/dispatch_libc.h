@@ -5,6 +5,7 @@
 #ifndef ITRACE_NATIVE_DISPATCH_LIBC_H
 #define ITRACE_NATIVE_DISPATCH_LIBC_H
 
+#include <core/library.h>
 #include "dispatch_base.h"
 
 class DispatchLibc final : public DispatchBase {
@@ -13,14 +14,19 @@ public:
 
     ~DispatchLibc() override = default;
 
-    bool dispatch_args(inst_trace_info_t *info) override;
+    void resolve(uintptr_t address, dispatch_target_t *target) override;
 
-    bool dispatch_ret(inst_trace_info_t *info, const QBDI::GPRState *ret_status) override;
+    bool dispatch_args(inst_trace_info_t *info, const dispatch_target_t &target) override;
 
-private:
-    bool get_format_result(inst_trace_info_t *info, const QBDI::GPRState *ret_status);
+    bool dispatch_ret(inst_trace_info_t *info, const QBDI::GPRState *ret_status,
+                      const dispatch_target_t &target) override;
+
+protected:
+    void load() override;
 
-    void record_memory_info(inst_trace_info_t *info, const QBDI::GPRState *ret_status);
+private:
+    // memory bookkeeping and format results, picked up by resolve for the call target
+    static void register_ret_handlers(stl::Library *module);
 
     DispatchLibc();
 };
@@ -43,34 +43,35 @@ DispatchLibz *DispatchLibz::get_instance() {
     return &dispatchLibz;
 }
 
-bool DispatchLibz::dispatch_args(inst_trace_info_t *info) {
-    if (!is_module_address(info->fun_call->fun_address)) {
-        return false;
+void DispatchLibz::resolve(uintptr_t address, dispatch_target_t *target) {
+    auto handler = libz_handlers.find(address);
+    if (handler != libz_handlers.end()) {
+        target->fun_name = handler->second.first;
+        target->args_handler = &handler->second.second;
+        return;
     }
+    DispatchBase::resolve(address, target);
+}
+
+bool DispatchLibz::dispatch_args(inst_trace_info_t *info, const dispatch_target_t &target) {
     info->fun_call->call_module_name = "libz.so";
-    auto handler = libz_handlers.find(info->fun_call->fun_address);
-    if (handler != libz_handlers.end()) {
-        auto pair = handler->second;
-        info->fun_call->fun_name = pair.first;
-        pair.second(info);
+    if (target.fun_name == nullptr) {
+        LOGE("fun_name is empty %p", (void *) info->fun_call->fun_address);
         return true;
     }
-    auto fun_name = get_address_symbol(info->fun_call->fun_address);
-    if (fun_name.empty()) {
-        LOGE("fun_name is empty %p", (void *) info->fun_call->fun_address);
+    info->fun_call->fun_name = target.fun_name;
+    if (target.args_handler != nullptr) {
+        (*target.args_handler)(info);
         return true;
     }
-    info->fun_call->fun_name = fun_name;
     add_common_reg_values(info);
 
 
     return true;
 }
 
-bool DispatchLibz::dispatch_ret(inst_trace_info_t *info, const QBDI::GPRState *ret_status) {
-    if (!is_module_address(info->fun_call->fun_address)) {
-        return false;
-    }
+bool DispatchLibz::dispatch_ret(inst_trace_info_t *info, const QBDI::GPRState *ret_status,
+                                const dispatch_target_t &target) {
     auto ret_type = info->fun_call->ret_type;
     auto ret_value = get_ret_register_value(ret_status, 0);
     switch (ret_type) {
@@ -98,38 +99,42 @@ bool DispatchLibz::dispatch_ret(inst_trace_info_t *info, const QBDI::GPRState *r
 }
 
 DispatchLibz::DispatchLibz() {
-    auto module = stl::Library::find_library("libz.so");
+    module = stl::Library::find_library("libz.so");
+    module_name = "libz.so";
     auto range = module->get_library_range();
     module_range.base = range.start();
     module_range.end = range.end();
+}
+
+void DispatchLibz::load() {
     //ZEXTERN int ZEXPORT deflate OF((z_streamp strm, int flush));
     REGISTER_HANDLER(libz_handlers, deflate, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("strm={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("flush={:#x}", arg1));
+        capture_value(trace_info, "strm", kCallArgHex, arg0);
+        capture_value(trace_info, "flush", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
     REGISTER_HANDLER(libz_handlers, inflate, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
-        trace_info->fun_call->args.push_back(fmt::format("strm={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("flush={:#x}", arg1));
+        capture_value(trace_info, "strm", kCallArgHex, arg0);
+        capture_value(trace_info, "flush", kCallArgHex, arg1);
         trace_info->fun_call->ret_type = kNumber;
     });
     REGISTER_HANDLER(libz_handlers, deflateEnd, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("strm={:#x}", arg0));
+        capture_value(trace_info, "strm", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     REGISTER_HANDLER(libz_handlers, inflateEnd, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("strm={:#x}", arg0));
+        capture_value(trace_info, "strm", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     REGISTER_HANDLER(libz_handlers, deflateReset, {
         auto arg0 = get_arg_register_value(&trace_info->pre_status, 0);
-        trace_info->fun_call->args.push_back(fmt::format("strm={:#x}", arg0));
+        capture_value(trace_info, "strm", kCallArgHex, arg0);
         trace_info->fun_call->ret_type = kNumber;
     });
     /*   ZEXTERN int ZEXPORT deflateInit_ OF((z_streamp strm, int level,
@@ -149,14 +154,14 @@ DispatchLibz::DispatchLibz() {
         auto arg5 = get_arg_register_value(&trace_info->pre_status, 5);
         auto arg6 = get_arg_register_value(&trace_info->pre_status, 6);
         auto arg7 = get_arg_register_value(&trace_info->pre_status, 7);
-        trace_info->fun_call->args.push_back(fmt::format("strm={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("level={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("method={:#x}", arg2));
-        trace_info->fun_call->args.push_back(fmt::format("windowBits={:#x}", arg3));
-        trace_info->fun_call->args.push_back(fmt::format("memLevel={:#x}", arg4));
-        trace_info->fun_call->args.push_back(fmt::format("strategy={:#x}", arg5));
-        trace_info->fun_call->args.push_back(fmt::format("version={:#x}", arg6));
-        trace_info->fun_call->args.push_back(fmt::format("stream_size={:#x}", arg7));
+        capture_value(trace_info, "strm", kCallArgHex, arg0);
+        capture_value(trace_info, "level", kCallArgHex, arg1);
+        capture_value(trace_info, "method", kCallArgHex, arg2);
+        capture_value(trace_info, "windowBits", kCallArgHex, arg3);
+        capture_value(trace_info, "memLevel", kCallArgHex, arg4);
+        capture_value(trace_info, "strategy", kCallArgHex, arg5);
+        capture_value(trace_info, "version", kCallArgHex, arg6);
+        capture_value(trace_info, "stream_size", kCallArgHex, arg7);
         trace_info->fun_call->ret_type = kNumber;
     });
 /*    ZEXTERN int ZEXPORT inflateInit_ OF((z_streamp strm,const char *version, int stream_size));*/
@@ -165,9 +170,9 @@ DispatchLibz::DispatchLibz() {
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
 
-        trace_info->fun_call->args.push_back(fmt::format("strm={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("version={}", read_string_from_address(arg1)));
-        trace_info->fun_call->args.push_back(fmt::format("stream_size={:#x}", arg2));
+        capture_value(trace_info, "strm", kCallArgHex, arg0);
+        capture_string(trace_info, "version", arg1);
+        capture_value(trace_info, "stream_size", kCallArgHex, arg2);
         trace_info->fun_call->ret_type = kNumber;
     });
     //ZEXTERN int ZEXPORT inflateInit2_ OF((z_streamp strm, int  windowBits,const char *version, int stream_size));
@@ -176,10 +181,10 @@ DispatchLibz::DispatchLibz() {
         auto arg1 = get_arg_register_value(&trace_info->pre_status, 1);
         auto arg2 = get_arg_register_value(&trace_info->pre_status, 2);
         auto arg3 = get_arg_register_value(&trace_info->pre_status, 3);
-        trace_info->fun_call->args.push_back(fmt::format("strm={:#x}", arg0));
-        trace_info->fun_call->args.push_back(fmt::format("windowBits={:#x}", arg1));
-        trace_info->fun_call->args.push_back(fmt::format("version={}", read_string_from_address(arg2)));
-        trace_info->fun_call->args.push_back(fmt::format("stream_size={:#x}", arg3));
+        capture_value(trace_info, "strm", kCallArgHex, arg0);
+        capture_value(trace_info, "windowBits", kCallArgHex, arg1);
+        capture_string(trace_info, "version", arg2);
+        capture_value(trace_info, "stream_size", kCallArgHex, arg3);
         trace_info->fun_call->ret_type = kNumber;
     });
     //mmap
@@ -33,9 +33,15 @@ public:
 
     ~DispatchLibz() override = default;
 
-    bool dispatch_args(inst_trace_info_t* info) override;
+    void resolve(uintptr_t address, dispatch_target_t* target) override;
 
-    bool dispatch_ret(inst_trace_info_t* info, const QBDI::GPRState* ret_status) override;
+    bool dispatch_args(inst_trace_info_t* info, const dispatch_target_t& target) override;
+
+    bool dispatch_ret(inst_trace_info_t* info, const QBDI::GPRState* ret_status,
+                      const dispatch_target_t& target) override;
+
+protected:
+    void load() override;
 
 private:
     DispatchLibz();
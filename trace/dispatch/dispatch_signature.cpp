@@ -0,0 +1,132 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2024 g2wfw
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "dispatch_signature.h"
+#include <spdlog/fmt/fmt.h>
+#include "signature_registry.h"
+
+// the names of the enum value is made of, hex for bits no name covers
+static std::string format_flags(const signature_arg_t &arg, uintptr_t value) {
+    if (arg.flags.empty()) {
+        return fmt::format("{:#x}", value);
+    }
+    for (const auto &flag: arg.flags) {
+        if (flag.value == value) {
+            return flag.name;
+        }
+    }
+    std::string out;
+    uint64_t rest = value;
+    for (const auto &flag: arg.flags) {
+        if (flag.value != 0 && (rest & flag.value) == flag.value) {
+            out += flag.name;
+            out += '|';
+            rest &= ~flag.value;
+        }
+    }
+    if (rest != 0 || out.empty()) {
+        out += fmt::format("{:#x}", rest);
+    } else {
+        out.pop_back();
+    }
+    return out;
+}
+
+DispatchSignature *DispatchSignature::get_instance() {
+    static DispatchSignature dispatchSignature;
+    return &dispatchSignature;
+}
+
+bool DispatchSignature::dispatch_args(inst_trace_info_t *info, const dispatch_target_t &target) {
+    const auto *signature = target.signature;
+    auto fun_call = info->fun_call;
+    fun_call->call_module_name = signature->library;
+    fun_call->fun_name = signature->name;
+    fun_call->ret_type = signature->ret_type;
+    for (uint32_t i = 0; i < signature->args.size(); ++i) {
+        const auto &arg = signature->args[i];
+        auto value = get_arg_register_value(&info->pre_status, i);
+        switch (arg.kind) {
+            case kSigArgInt:
+            case kSigArgFd:
+                capture_value(info, arg.name.c_str(), kCallArgSigned,
+                              static_cast<int64_t>(static_cast<intptr_t>(value)));
+                break;
+            case kSigArgString:
+                capture_string(info, arg.name.c_str(), value);
+                break;
+            case kSigArgBuffer: {
+                size_t length = arg.length_arg >= 0 ?
+                                get_arg_register_value(&info->pre_status, arg.length_arg) :
+                                arg.length;
+                capture_buffer(info, arg.name.c_str(), value, length);
+                break;
+            }
+            case kSigArgFlags:
+                // the enum names are only known here
+                capture_text(info, arg.name.c_str(), format_flags(arg, value));
+                break;
+            default:
+                capture_value(info, arg.name.c_str(), kCallArgHex, value);
+                break;
+        }
+    }
+    return true;
+}
+
+bool DispatchSignature::dispatch_ret(inst_trace_info_t *info, const QBDI::GPRState *ret_status,
+                                     const dispatch_target_t &target) {
+    if (target.ret_handler != nullptr) {
+        // the memory bookkeeping of the built in handler still applies
+        target.ret_handler(info, ret_status);
+    }
+    const auto *signature = target.signature;
+    auto ret_value = get_ret_register_value(ret_status, 0);
+    auto &out = info->fun_call->ret_value;
+    switch (signature->ret_type) {
+        case kVoid:
+            out.clear();
+            break;
+        case kString:
+            out = fmt::format("ret={}", read_string_from_address(ret_value));
+            break;
+        default:
+            out = fmt::format("ret={:#x}", ret_value);
+            break;
+    }
+    for (uint32_t i = 0; i < signature->args.size(); ++i) {
+        const auto &arg = signature->args[i];
+        if (arg.kind != kSigArgOut) {
+            continue;
+        }
+        auto value = get_arg_register_value(&info->pre_status, i);
+        uintptr_t word = 0;
+        if (ArgCapture::get_instance()->copy(value, &word, sizeof(word)) != sizeof(word)) {
+            continue;
+        }
+        out += fmt::format("{}{}=>{:#x}", out.empty() ? "" : " ", arg.name, word);
+    }
+    return true;
+}
@@ -0,0 +1,51 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2024 g2wfw
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_DISPATCH_SIGNATURE_H
+#define QBDI_TRACER_DISPATCH_SIGNATURE_H
+
+#include "dispatch_base.h"
+
+/**
+ * Decodes every function of SignatureRegistry. It owns no module, the
+ * dispatch manager routes a target here when the registry has its
+ * signature, whichever dispatcher owns the address.
+ */
+class DispatchSignature final : public DispatchBase {
+public:
+    static DispatchSignature *get_instance();
+
+    ~DispatchSignature() override = default;
+
+    bool dispatch_args(inst_trace_info_t *info, const dispatch_target_t &target) override;
+
+    bool dispatch_ret(inst_trace_info_t *info, const QBDI::GPRState *ret_status,
+                      const dispatch_target_t &target) override;
+
+private:
+    DispatchSignature() = default;
+};
+
+#endif  //QBDI_TRACER_DISPATCH_SIGNATURE_H
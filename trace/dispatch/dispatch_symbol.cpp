@@ -0,0 +1,64 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2024 g2wfw
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "dispatch_symbol.h"
+#include <spdlog/fmt/fmt.h>
+#include "../symbol_cache.h"
+
+DispatchSymbol *DispatchSymbol::get_instance() {
+    static DispatchSymbol dispatchSymbol;
+    return &dispatchSymbol;
+}
+
+void DispatchSymbol::resolve(uintptr_t address, dispatch_target_t *target) {
+    symbol_location_t location;
+    if (!SymbolCache::getInstance()->lookup(address, &location)) {
+        return;
+    }
+    auto &entry = names[address];
+    entry.module = std::move(location.module);
+    entry.name = SymbolCache::format(location);
+    target->module_name = entry.module.c_str();
+    target->fun_name = entry.name.c_str();
+}
+
+bool DispatchSymbol::dispatch_args(inst_trace_info_t *info, const dispatch_target_t &target) {
+    auto fun_call = info->fun_call;
+    if (target.fun_name != nullptr) {
+        fun_call->call_module_name = target.module_name;
+        fun_call->fun_name = target.fun_name;
+    } else {
+        // jit code or an anonymous trampoline
+        fun_call->call_module_name.clear();
+        fun_call->fun_name = fmt::format("{:#x}", fun_call->fun_address);
+    }
+    add_common_reg_values(info);
+    return true;
+}
+
+bool DispatchSymbol::dispatch_ret(inst_trace_info_t *info, const QBDI::GPRState *ret_status,
+                                  const dispatch_target_t &target) {
+    return add_common_return_value(info, ret_status);
+}
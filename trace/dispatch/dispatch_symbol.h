@@ -0,0 +1,63 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2024 g2wfw
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_DISPATCH_SYMBOL_H
+#define QBDI_TRACER_DISPATCH_SYMBOL_H
+
+#include <unordered_map>
+#include "dispatch_base.h"
+
+/**
+ * Fallback for call targets in modules without a dispatcher of their own:
+ * names them through SymbolCache and dumps the argument registers. The dispatch
+ * manager resolves a target once, the names live here until it is resolved
+ * again after a library load.
+ */
+class DispatchSymbol final : public DispatchBase {
+public:
+    static DispatchSymbol *get_instance();
+
+    ~DispatchSymbol() override = default;
+
+    void resolve(uintptr_t address, dispatch_target_t *target) override;
+
+    bool dispatch_args(inst_trace_info_t *info, const dispatch_target_t &target) override;
+
+    bool dispatch_ret(inst_trace_info_t *info, const QBDI::GPRState *ret_status,
+                      const dispatch_target_t &target) override;
+
+private:
+    typedef struct symbol_name {
+        std::string module;
+        std::string name;
+    } symbol_name_t;
+
+    DispatchSymbol() = default;
+
+    // node based, resolved targets point into it
+    std::unordered_map<uintptr_t, symbol_name_t> names;
+};
+
+#endif  //QBDI_TRACER_DISPATCH_SYMBOL_H
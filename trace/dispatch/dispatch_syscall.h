@@ -14,13 +14,20 @@ public:
 
     ~DispatchSyscall() override = default;
 
-    bool dispatch_args(inst_trace_info_t* info) override;
+    // svc has no call target, target is empty and the syscall number picks the descriptor
+    bool dispatch_args(inst_trace_info_t* info, const dispatch_target_t& target) override;
 
-    bool dispatch_ret(inst_trace_info_t* info, const QBDI::GPRState* ret_status) override;
+    bool dispatch_ret(inst_trace_info_t* info, const QBDI::GPRState* ret_status,
+                      const dispatch_target_t& target) override;
 
 private:
     DispatchSyscall();
-    void record_memory_info(inst_trace_info_t* info, const QBDI::GPRState* ret_status);
+
+    // prctl arguments depend on the option, syscalls.txt only has the generic form
+    static void decode_prctl(inst_trace_info_t* info, uintptr_t option, uintptr_t arg1);
+
+    // memory bookkeeping by syscall number, run when the syscall returns
+    std::unordered_map<uint32_t, ret_handler_t> memory_handlers;
 };
 
 #endif  //MEITUAN_DISPATCH_SYSCALL_H
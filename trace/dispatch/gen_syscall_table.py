@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+# Generates syscall_table.inc from syscalls.txt, see syscall_table.h.
+#
+#   python3 gen_syscall_table.py [syscalls.txt] [syscall_table.inc]
+
+import os
+import re
+import sys
+
+ARG_KINDS = {
+    "value": "kSysArgValue",
+    "int": "kSysArgInt",
+    "fd": "kSysArgFd",
+    "path": "kSysArgPath",
+    "ptr": "kSysArgPointer",
+    "flags": "kSysArgFlags",
+    "size": "kSysArgSize",
+    "in": "kSysArgInBuffer",
+    "out": "kSysArgOutBuffer",
+}
+# buffer kinds, their length is the next argument
+BUFFER_KINDS = ("in", "out")
+RET_TYPES = {
+    "number": "kNumber",
+    "pointer": "kPointer",
+    "string": "kString",
+    "void": "kVoid",
+}
+MAX_ARGS = 6
+LINE = re.compile(r"^(\w+)\((.*)\)\s*->\s*(\w+)$")
+
+
+def parse(path):
+    entries = []
+    names = set()
+    with open(path) as spec:
+        for number, line in enumerate(spec, 1):
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            match = LINE.match(line)
+            if match is None:
+                sys.exit("%s:%d: expected name(kind arg, ...) -> ret" % (path, number))
+            name, args, ret = match.groups()
+            if name in names:
+                sys.exit("%s:%d: %s listed twice" % (path, number, name))
+            if ret not in RET_TYPES:
+                sys.exit("%s:%d: unknown return kind %s" % (path, number, ret))
+            parsed = []
+            for arg in filter(None, (a.strip() for a in args.split(","))):
+                kind, _, arg_name = arg.partition(" ")
+                if kind not in ARG_KINDS or not arg_name:
+                    sys.exit("%s:%d: bad argument '%s'" % (path, number, arg))
+                parsed.append((arg_name.strip(), kind))
+            for index, (arg_name, kind) in enumerate(parsed):
+                if kind in BUFFER_KINDS and index + 1 == len(parsed):
+                    sys.exit("%s:%d: %s buffer %s has no length argument after it"
+                             % (path, number, kind, arg_name))
+            if len(parsed) > MAX_ARGS:
+                sys.exit("%s:%d: more than %d arguments" % (path, number, MAX_ARGS))
+            names.add(name)
+            entries.append((name, parsed, ret))
+    return entries
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    spec = sys.argv[1] if len(sys.argv) > 1 else os.path.join(here, "syscalls.txt")
+    out = sys.argv[2] if len(sys.argv) > 2 else os.path.join(here, "syscall_table.inc")
+    lines = ["// generated by gen_syscall_table.py from syscalls.txt, do not edit", ""]
+    for name, args, ret in parse(spec):
+        arg_list = ", ".join('{"%s", %s}' % (arg, ARG_KINDS[kind]) for arg, kind in args)
+        lines.append("#ifdef __NR_%s" % name)
+        lines.append('{__NR_%s, {"%s", %s, %d, {%s}}},' % (name, name, RET_TYPES[ret], len(args),
+                                                           arg_list))
+        lines.append("#endif")
+    with open(out, "w") as inc:
+        inc.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -4,9 +4,159 @@
 
 #include <cstring>
 #include <cstdlib>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 #include "jni.h"
 #include "jni_internal.h"
 
+/**
+ * Classes and method ids of the reflection calls below, kept for the process
+ * once all of them resolved. jclass handles are global refs, ids stay valid
+ * with them.
+ */
+typedef struct jni_reflection {
+    bool ready = false;
+    jclass class_class = nullptr;
+    jmethodID class_get_name = nullptr;
+    jmethodID class_is_array = nullptr;
+    jmethodID class_is_primitive = nullptr;
+    jmethodID class_get_component_type = nullptr;
+    jclass constructor_class = nullptr;
+    jmethodID constructor_get_name = nullptr;
+    jmethodID constructor_get_parameter_types = nullptr;
+    jmethodID method_get_name = nullptr;
+    jmethodID method_get_parameter_types = nullptr;
+    jmethodID method_get_return_type = nullptr;
+    jmethodID field_get_name = nullptr;
+    jmethodID field_get_type = nullptr;
+    jclass system_class = nullptr;
+    jmethodID system_identity_hash_code = nullptr;
+} jni_reflection_t;
+
+// names of classes are kept as long as a class, every class name costs a global ref
+static constexpr size_t kMaxCachedClasses = 4096;
+
+typedef struct class_name_entry {
+    jclass clazz;
+    std::string name;
+} class_name_entry_t;
+
+static std::mutex jni_cache_mutex;
+// ids are stable for the lifetime of their class, so are the signatures
+static std::unordered_map<jmethodID, std::string> method_signatures;
+static std::unordered_map<jfieldID, std::string> field_signatures;
+// by identity hash code, equal codes are told apart by IsSameObject
+static std::unordered_map<jint, std::vector<class_name_entry_t>> class_names;
+static size_t class_name_count = 0;
+
+// a lookup below raised it, so it is ours to clear
+static void clear_lookup_failure(JNIEnv *env) {
+    if (env->ExceptionCheck()) {
+        env->ExceptionClear();
+    }
+}
+
+static jclass find_global_class(JNIEnv *env, const char *name) {
+    auto local = env->FindClass(name);
+    if (local == nullptr) {
+        clear_lookup_failure(env);
+        return nullptr;
+    }
+    auto global = static_cast<jclass>(env->NewGlobalRef(local));
+    env->DeleteLocalRef(local);
+    return global;
+}
+
+static std::mutex reflection_mutex;
+static std::atomic<bool> reflection_ready{false};
+// handed out while the lookups have not succeeded yet, ready stays false
+static const jni_reflection_t kNoReflection{};
+
+static bool load_reflection(JNIEnv *env, jni_reflection_t &r) {
+    r.class_class = find_global_class(env, "java/lang/Class");
+    r.constructor_class = find_global_class(env, "java/lang/reflect/Constructor");
+    r.system_class = find_global_class(env, "java/lang/System");
+    auto method_class = env->FindClass("java/lang/reflect/Method");
+    clear_lookup_failure(env);
+    auto field_class = env->FindClass("java/lang/reflect/Field");
+    clear_lookup_failure(env);
+    bool ok = r.class_class != nullptr && r.constructor_class != nullptr &&
+              r.system_class != nullptr && method_class != nullptr && field_class != nullptr;
+    if (ok) {
+        r.class_get_name = env->GetMethodID(r.class_class, "getName", "()Ljava/lang/String;");
+        r.class_is_array = env->GetMethodID(r.class_class, "isArray", "()Z");
+        r.class_is_primitive = env->GetMethodID(r.class_class, "isPrimitive", "()Z");
+        r.class_get_component_type = env->GetMethodID(r.class_class, "getComponentType",
+                                                      "()Ljava/lang/Class;");
+        r.constructor_get_name = env->GetMethodID(r.constructor_class, "getName",
+                                                  "()Ljava/lang/String;");
+        r.constructor_get_parameter_types = env->GetMethodID(r.constructor_class,
+                                                             "getParameterTypes",
+                                                             "()[Ljava/lang/Class;");
+        r.method_get_name = env->GetMethodID(method_class, "getName", "()Ljava/lang/String;");
+        r.method_get_parameter_types = env->GetMethodID(method_class, "getParameterTypes",
+                                                        "()[Ljava/lang/Class;");
+        r.method_get_return_type = env->GetMethodID(method_class, "getReturnType",
+                                                    "()Ljava/lang/Class;");
+        r.field_get_name = env->GetMethodID(field_class, "getName", "()Ljava/lang/String;");
+        r.field_get_type = env->GetMethodID(field_class, "getType", "()Ljava/lang/Class;");
+        r.system_identity_hash_code = env->GetStaticMethodID(r.system_class, "identityHashCode",
+                                                             "(Ljava/lang/Object;)I");
+        ok = !env->ExceptionCheck();
+        clear_lookup_failure(env);
+    }
+    if (method_class != nullptr) {
+        env->DeleteLocalRef(method_class);
+    }
+    if (field_class != nullptr) {
+        env->DeleteLocalRef(field_class);
+    }
+    if (!ok) {
+        // the next call looks everything up again
+        for (auto clazz: {r.class_class, r.constructor_class, r.system_class}) {
+            if (clazz != nullptr) {
+                env->DeleteGlobalRef(clazz);
+            }
+        }
+        r = jni_reflection_t{};
+    }
+    return ok;
+}
+
+static const jni_reflection_t &get_reflection(JNIEnv *env) {
+    static jni_reflection_t reflection;
+    if (reflection_ready.load(std::memory_order_acquire)) {
+        return reflection;
+    }
+    // the app has an exception pending, no lookup may run and it is not ours to clear
+    if (env->ExceptionCheck()) {
+        return kNoReflection;
+    }
+    std::lock_guard<std::mutex> lock(reflection_mutex);
+    if (!reflection_ready.load(std::memory_order_relaxed)) {
+        if (!load_reflection(env, reflection)) {
+            return kNoReflection;
+        }
+        reflection.ready = true;
+        reflection_ready.store(true, std::memory_order_release);
+    }
+    return reflection;
+}
+
+
+// set when a call below raised, whatever was being built is partial and must not be cached
+static thread_local bool lookup_failed = false;
+
+static bool describe_exception(JNIEnv *env) {
+    if (!env->ExceptionCheck()) {
+        return false;
+    }
+    env->ExceptionDescribe();
+    lookup_failed = true;
+    return true;
+}
 
 std::string jstring_to_string(JNIEnv *env, jstring data) {
     if (data == nullptr) {
@@ -35,14 +185,34 @@ std::string get_jni_class_or_java_class_name(JNIEnv *env, jclass clazz) {
     if (clazz == nullptr) {
         return "nullptr";
     }
-    auto java_Class_clazz = env->FindClass("java/lang/Class");
-    jmethodID getName_mid = env->GetMethodID(java_Class_clazz, "getName", "()Ljava/lang/String;");
-    env->DeleteLocalRef(java_Class_clazz);
-    jstring classNameJString = (jstring) env->CallObjectMethod(clazz, getName_mid);
+    const auto &reflection = get_reflection(env);
+    if (!reflection.ready) {
+        return "";
+    }
+    // one call into ART instead of getName and its string
+    auto hash = env->CallStaticIntMethod(reflection.system_class,
+                                         reflection.system_identity_hash_code, clazz);
+    {
+        std::lock_guard<std::mutex> lock(jni_cache_mutex);
+        auto find = class_names.find(hash);
+        if (find != class_names.end()) {
+            for (const auto &entry: find->second) {
+                if (env->IsSameObject(entry.clazz, clazz)) {
+                    return entry.name;
+                }
+            }
+        }
+    }
+    jstring classNameJString = (jstring) env->CallObjectMethod(clazz, reflection.class_get_name);
     auto result = jstring_to_string(env, classNameJString);
     env->DeleteLocalRef(classNameJString);
-    if (env->ExceptionCheck()) {
-        env->ExceptionDescribe();
+    if (describe_exception(env)) {
+        return result;
+    }
+    std::lock_guard<std::mutex> lock(jni_cache_mutex);
+    if (class_name_count < kMaxCachedClasses) {
+        class_names[hash].push_back({static_cast<jclass>(env->NewGlobalRef(clazz)), result});
+        class_name_count++;
     }
     return result;
 }
@@ -51,31 +221,20 @@ std::string get_jni_type(JNIEnv *env, jobject java_class) {
     if (java_class == nullptr) {
         return "";
     }
-    jclass java_class_clazz = env->GetObjectClass(java_class);
-    jmethodID is_array_method = env->GetMethodID(java_class_clazz, "isArray", "()Z");
-    if (env->ExceptionCheck()) {
-        env->ExceptionDescribe();
+    const auto &reflection = get_reflection(env);
+    if (!reflection.ready) {
+        return "";
     }
-    if (env->CallBooleanMethod(java_class, is_array_method)) {
+    if (env->CallBooleanMethod(java_class, reflection.class_is_array)) {
         std::string result = "[";
-        //getComponentType
-        jmethodID getComponentType = env->GetMethodID(java_class_clazz, "getComponentType",
-                                                      "()Ljava/lang/Class;");
-        jclass java_class_ = static_cast<jclass>(env->CallObjectMethod(java_class,
-                                                                       getComponentType));
+        jclass java_class_ = static_cast<jclass>(env->CallObjectMethod(
+                java_class, reflection.class_get_component_type));
         result.append(get_jni_type(env, java_class_));
         env->DeleteLocalRef(java_class_);
-        env->DeleteLocalRef(java_class_clazz);
         return result;
     }
-    if (env->ExceptionCheck()) {
-        env->ExceptionDescribe();
-    }
-    jmethodID isPrimitive = env->GetMethodID(java_class_clazz, "isPrimitive", "()Z");
-    if (env->ExceptionCheck()) {
-        env->ExceptionDescribe();
-    }
-    if (env->CallBooleanMethod(java_class, isPrimitive)) {
+    describe_exception(env);
+    if (env->CallBooleanMethod(java_class, reflection.class_is_primitive)) {
         auto name = get_jni_class_or_java_class_name(env, (jclass) java_class);
         if (name == "byte") {
             return "B";
@@ -117,43 +276,38 @@ std::string get_reflected_method_info(JNIEnv *env, jobject method) {
     if (method == nullptr) {
         return "nullptr";
     }
+    const auto &reflection = get_reflection(env);
+    if (!reflection.ready) {
+        return "";
+    }
     std::string info = "";
-    jclass reflected_method_class = env->GetObjectClass(method);
-    std::string class_name = get_jni_class_or_java_class_name(env, reflected_method_class);
-    jmethodID reflected_method_mid_get_name = env->GetMethodID(reflected_method_class, "getName",
-                                                               "()Ljava/lang/String;");
-    jstring method_name_jstring = static_cast<jstring>(env->CallObjectMethod(method,
-                                                                             reflected_method_mid_get_name));
+    bool is_constructor = env->IsInstanceOf(method, reflection.constructor_class);
+    jstring method_name_jstring = static_cast<jstring>(env->CallObjectMethod(
+            method, is_constructor ? reflection.constructor_get_name : reflection.method_get_name));
     info.append(jstring_to_string(env, method_name_jstring));
     env->DeleteLocalRef(method_name_jstring);
-    if (env->ExceptionCheck()) {
-        env->ExceptionDescribe();
-    }
+    describe_exception(env);
     info.append("(");
-    jmethodID reflected_method_mid_get_parameter_types = env->GetMethodID(reflected_method_class,
-                                                                          "getParameterTypes",
-                                                                          "()[Ljava/lang/Class;");
-    jobjectArray parameter_types_jarray = static_cast<jobjectArray>(env->CallObjectMethod(method,
-                                                                                          reflected_method_mid_get_parameter_types));
-
-    for (int i = 0; i < env->GetArrayLength(parameter_types_jarray); i++) {
-        jclass java_class = static_cast<jclass>(env->GetObjectArrayElement(parameter_types_jarray,
-                                                                           i));
-        info.append(get_jni_type(env, java_class));
-        env->DeleteLocalRef(java_class);
-    }
-    if (env->ExceptionCheck()) {
-        env->ExceptionDescribe();
+    jobjectArray parameter_types_jarray = static_cast<jobjectArray>(env->CallObjectMethod(
+            method, is_constructor ? reflection.constructor_get_parameter_types :
+                    reflection.method_get_parameter_types));
+    if (parameter_types_jarray != nullptr) {
+        auto count = env->GetArrayLength(parameter_types_jarray);
+        for (int i = 0; i < count; i++) {
+            jclass java_class = static_cast<jclass>(env->GetObjectArrayElement(
+                    parameter_types_jarray, i));
+            info.append(get_jni_type(env, java_class));
+            env->DeleteLocalRef(java_class);
+        }
+        env->DeleteLocalRef(parameter_types_jarray);
     }
+    describe_exception(env);
     info.append(")");
     //判断是否为构造函数
-    if (class_name == "java.lang.reflect.Constructor") {
+    if (is_constructor) {
         info.append("V");
     } else {
-        jmethodID returnType = env->GetMethodID(reflected_method_class, "getReturnType",
-                                                "()Ljava/lang/Class;");
-        jobject ret = env->CallObjectMethod(method, returnType);
-
+        jobject ret = env->CallObjectMethod(method, reflection.method_get_return_type);
         info.append(get_jni_type(env, ret));
         env->DeleteLocalRef(ret);
     }
@@ -166,18 +320,17 @@ std::string get_jni_jobject_name(JNIEnv *env, jobject object) {
         return "nullptr";
     }
     //check is java.lang.Class
-    jclass java_lang_Class_clazz = env->FindClass("java/lang/Class");
-    if (env->IsInstanceOf(object, java_lang_Class_clazz)) {
-        env->DeleteLocalRef(java_lang_Class_clazz);
+    const auto &reflection = get_reflection(env);
+    if (!reflection.ready) {
+        return "";
+    }
+    if (env->IsInstanceOf(object, reflection.class_class)) {
         return get_jni_class_or_java_class_name(env, (jclass) object);
     }
-    env->DeleteLocalRef(java_lang_Class_clazz);
     jclass clazz = env->GetObjectClass(object);;
     auto result = get_jni_class_or_java_class_name(env, clazz);
     env->DeleteLocalRef(clazz);
-    if (env->ExceptionCheck()) {
-        env->ExceptionDescribe();
-    }
+    describe_exception(env);
     return result;
 }
 
@@ -186,20 +339,32 @@ std::string get_jni_method_signature(JNIEnv *env, jmethodID method) {
     if (method == nullptr || env == nullptr) {
         return "";
     }
-    auto java_Class_clazz = env->FindClass("java/lang/Class");
-    auto method_object = env->ToReflectedMethod(java_Class_clazz, method, false);
-    if (env->ExceptionCheck()) {
-        env->ExceptionDescribe();
+    {
+        std::lock_guard<std::mutex> lock(jni_cache_mutex);
+        auto find = method_signatures.find(method);
+        if (find != method_signatures.end()) {
+            return find->second;
+        }
+    }
+    const auto &reflection = get_reflection(env);
+    if (!reflection.ready) {
+        return "";
     }
+    lookup_failed = false;
+    // ART ignores the class, any one does
+    auto method_object = env->ToReflectedMethod(reflection.class_class, method, false);
+    describe_exception(env);
     if (method_object== nullptr){
         return "";
     }
-    env->DeleteLocalRef(java_Class_clazz);
     auto res = get_reflected_method_info(env, method_object);
     env->DeleteLocalRef(method_object);
-    if (env->ExceptionCheck()) {
-        env->ExceptionDescribe();
+    describe_exception(env);
+    if (lookup_failed) {
+        return res;
     }
+    std::lock_guard<std::mutex> lock(jni_cache_mutex);
+    method_signatures.emplace(method, res);
     return res;
 }
 
@@ -207,26 +372,22 @@ std::string get_reflected_field_info(JNIEnv *env, jobject filed) {
     if (filed == nullptr) {
         return "nullptr";
     }
+    const auto &reflection = get_reflection(env);
+    if (!reflection.ready) {
+        return "";
+    }
     std::string info = "";
-    jclass reflected_method_class = env->GetObjectClass(filed);
-    jmethodID reflected_method_mid_get_name = env->GetMethodID(reflected_method_class, "getName",
-                                                               "()Ljava/lang/String;");
-    jstring field_name_jstring = static_cast<jstring>(env->CallObjectMethod(filed,
-                                                                            reflected_method_mid_get_name));
+    jstring field_name_jstring = static_cast<jstring>(env->CallObjectMethod(
+            filed, reflection.field_get_name));
     info.append(jstring_to_string(env, field_name_jstring));
     env->DeleteLocalRef(field_name_jstring);
 
-    jmethodID reflected_method_mid_get_type = env->GetMethodID(reflected_method_class, "getType",
-                                                               "()Ljava/lang/Class;");
-    jobject java_class = (env->CallObjectMethod(filed,
-                                                reflected_method_mid_get_type));
+    jobject java_class = env->CallObjectMethod(filed, reflection.field_get_type);
 
     info.append(":");
     info.append(get_jni_type(env, java_class));
     env->DeleteLocalRef(java_class);
-    if (env->ExceptionCheck()) {
-        env->ExceptionDescribe();
-    }
+    describe_exception(env);
     return info;
 }
 
@@ -234,14 +395,31 @@ std::string get_jni_field_signature(JNIEnv *env, jfieldID field) {
     if (field == nullptr) {
         return "nullptr";
     }
-    auto java_Class_clazz = env->FindClass("java/lang/Class");
-    auto filed_object = env->ToReflectedField(java_Class_clazz, field, false);
+    {
+        std::lock_guard<std::mutex> lock(jni_cache_mutex);
+        auto find = field_signatures.find(field);
+        if (find != field_signatures.end()) {
+            return find->second;
+        }
+    }
+    const auto &reflection = get_reflection(env);
+    if (!reflection.ready) {
+        return "";
+    }
+    lookup_failed = false;
+    auto filed_object = env->ToReflectedField(reflection.class_class, field, false);
+    describe_exception(env);
+    if (filed_object == nullptr) {
+        return "";
+    }
     auto res = get_reflected_field_info(env, filed_object);
     env->DeleteLocalRef(filed_object);
-    env->DeleteLocalRef(java_Class_clazz);
-    if (env->ExceptionCheck()) {
-        env->ExceptionDescribe();
+    describe_exception(env);
+    if (lookup_failed) {
+        return res;
     }
+    std::lock_guard<std::mutex> lock(jni_cache_mutex);
+    field_signatures.emplace(field, res);
     return res;
 }
 
@@ -0,0 +1,297 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2024 g2wfw
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "signature_registry.h"
+#include <android/log.h>
+#include <core/library.h>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#define LOG_TAG "QBDI"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#define LOGD(...) __android_log_print(ANDROID_LOG_DEBUG, LOG_TAG, __VA_ARGS__)
+
+// beyond what get_arg_register_value reads from the stack on either arch
+static constexpr size_t kMaxSignatureArgs = 16;
+
+static std::string trim(const std::string &str) {
+    auto begin = str.find_first_not_of(" \t\r");
+    if (begin == std::string::npos) {
+        return {};
+    }
+    auto end = str.find_last_not_of(" \t\r");
+    return str.substr(begin, end - begin + 1);
+}
+
+static bool parse_number(const std::string &str, uint64_t &value) {
+    if (str.empty()) {
+        return false;
+    }
+    char *end = nullptr;
+    value = strtoull(str.c_str(), &end, 0);
+    return *end == 0;
+}
+
+static bool parse_ret_type(const std::string &str, fun_data_type_t &type) {
+    if (str == "number") {
+        type = kNumber;
+    } else if (str == "pointer") {
+        type = kPointer;
+    } else if (str == "string") {
+        type = kString;
+    } else if (str == "void") {
+        type = kVoid;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static bool parse_arg_kind(const std::string &str, signature_arg_kind_t &kind) {
+    if (str == "value" || str == "ptr" || str == "size") {
+        kind = kSigArgValue;
+    } else if (str == "int") {
+        kind = kSigArgInt;
+    } else if (str == "string" || str == "path") {
+        kind = kSigArgString;
+    } else if (str == "buffer") {
+        kind = kSigArgBuffer;
+    } else if (str == "fd") {
+        kind = kSigArgFd;
+    } else if (str == "flags") {
+        kind = kSigArgFlags;
+    } else if (str == "out") {
+        kind = kSigArgOut;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool SignatureRegistry::parse_line(const std::string &raw_line, std::string &library,
+                                   std::string *error) {
+    auto line = trim(raw_line.substr(0, raw_line.find('#')));
+    if (line.empty()) {
+        return true;
+    }
+    if (line.front() == '[') {
+        if (line.back() != ']' || line.size() < 3) {
+            *error = "bad library section";
+            return false;
+        }
+        library = trim(line.substr(1, line.size() - 2));
+        return true;
+    }
+    if (line.compare(0, 5, "enum ") == 0) {
+        std::istringstream stream(line.substr(5));
+        std::string name, item;
+        stream >> name;
+        std::vector<signature_flag_t> flags;
+        while (stream >> item) {
+            auto equal = item.find('=');
+            signature_flag_t flag;
+            if (equal == std::string::npos ||
+                !parse_number(item.substr(equal + 1), flag.value)) {
+                *error = "bad enum value " + item;
+                return false;
+            }
+            flag.name = item.substr(0, equal);
+            flags.push_back(flag);
+        }
+        if (name.empty() || flags.empty()) {
+            *error = "empty enum";
+            return false;
+        }
+        enums[name] = std::move(flags);
+        return true;
+    }
+    if (library.empty()) {
+        *error = "signature outside a [library] section";
+        return false;
+    }
+    auto open = line.find('(');
+    auto close = line.rfind(')');
+    auto arrow = line.find("->", close == std::string::npos ? 0 : close);
+    if (open == std::string::npos || close == std::string::npos || close < open ||
+        arrow == std::string::npos) {
+        *error = "expected name(args) -> ret";
+        return false;
+    }
+    function_signature_t signature;
+    signature.library = library;
+    signature.name = trim(line.substr(0, open));
+    auto at = signature.name.find('@');
+    if (at != std::string::npos) {
+        uint64_t offset;
+        if (!parse_number(trim(signature.name.substr(at + 1)), offset) || offset == 0) {
+            *error = "bad offset in " + signature.name;
+            return false;
+        }
+        signature.offset = offset;
+        signature.name = trim(signature.name.substr(0, at));
+    }
+    if (signature.name.empty()) {
+        *error = "missing function name";
+        return false;
+    }
+    if (!parse_ret_type(trim(line.substr(arrow + 2)), signature.ret_type)) {
+        *error = "bad return kind " + trim(line.substr(arrow + 2));
+        return false;
+    }
+    // buffer lengths may name an argument that comes later
+    std::vector<std::string> length_names;
+    std::istringstream args(line.substr(open + 1, close - open - 1));
+    std::string item;
+    while (std::getline(args, item, ',')) {
+        item = trim(item);
+        auto space = item.find_first_of(" \t");
+        if (space == std::string::npos) {
+            *error = "expected kind name, got " + item;
+            return false;
+        }
+        signature_arg_t arg;
+        arg.name = trim(item.substr(space));
+        auto kind = item.substr(0, space);
+        std::string param;
+        auto colon = kind.find(':');
+        if (colon != std::string::npos) {
+            param = kind.substr(colon + 1);
+            kind = kind.substr(0, colon);
+        }
+        if (!parse_arg_kind(kind, arg.kind)) {
+            *error = "unknown kind " + kind;
+            return false;
+        }
+        length_names.emplace_back();
+        if (arg.kind == kSigArgFlags && !param.empty()) {
+            auto find = enums.find(param);
+            if (find == enums.end()) {
+                *error = "unknown enum " + param;
+                return false;
+            }
+            arg.flags = find->second;
+        } else if (arg.kind == kSigArgBuffer) {
+            uint64_t length;
+            if (param.empty()) {
+                *error = "buffer " + arg.name + " needs a length";
+                return false;
+            }
+            if (parse_number(param, length)) {
+                arg.length = length;
+            } else {
+                length_names.back() = param;
+            }
+        }
+        signature.args.push_back(std::move(arg));
+    }
+    if (signature.args.size() > kMaxSignatureArgs) {
+        *error = "more than 16 arguments";
+        return false;
+    }
+    for (size_t i = 0; i < signature.args.size(); ++i) {
+        if (length_names[i].empty()) {
+            continue;
+        }
+        for (size_t j = 0; j < signature.args.size(); ++j) {
+            if (signature.args[j].name == length_names[i]) {
+                signature.args[i].length_arg = static_cast<int>(j);
+            }
+        }
+        if (signature.args[i].length_arg < 0) {
+            *error = "no argument " + length_names[i];
+            return false;
+        }
+    }
+    auto &slot = signatures[{signature.library, signature.name}];
+    if (slot.bound) {
+        // replaced, the address may differ and gets bound again
+        for (auto it = bound_signatures.begin(); it != bound_signatures.end();) {
+            it = it->second == &slot ? bound_signatures.erase(it) : std::next(it);
+        }
+    }
+    slot = std::move(signature);
+    return true;
+}
+
+bool SignatureRegistry::load(const std::string &spec, std::string *error) {
+    std::istringstream stream(spec);
+    std::string line, library, line_error;
+    size_t line_number = 0;
+    size_t bad_lines = 0;
+    while (std::getline(stream, line)) {
+        line_number++;
+        if (parse_line(line, library, &line_error)) {
+            continue;
+        }
+        LOGE("signature spec line %zu: %s", line_number, line_error.c_str());
+        if (bad_lines++ == 0 && error != nullptr) {
+            *error = "line " + std::to_string(line_number) + ": " + line_error;
+        }
+    }
+    LOGI("%zu function signatures, %zu bad lines", signatures.size(), bad_lines);
+    return bad_lines == 0;
+}
+
+bool SignatureRegistry::load_file(const std::string &path, std::string *error) {
+    std::ifstream file(path);
+    if (!file) {
+        if (error != nullptr) {
+            *error = "can not open " + path;
+        }
+        return false;
+    }
+    std::stringstream spec;
+    spec << file.rdbuf();
+    return load(spec.str(), error);
+}
+
+void SignatureRegistry::bind() {
+    // ordered by library, so each library is looked up once
+    std::string library;
+    std::unique_ptr<stl::Library> module;
+    for (auto &[key, signature]: signatures) {
+        if (signature.bound) {
+            continue;
+        }
+        if (key.first != library) {
+            library = key.first;
+            module = stl::Library::find_library(library);
+        }
+        if (module == nullptr) {
+            continue;
+        }
+        signature.bound = true;
+        auto address = signature.offset != 0 ? module->get_load_bias() + signature.offset :
+                       (uintptr_t) module->find_symbol(signature.name);
+        if (address == 0) {
+            LOGW("no symbol %s in %s", signature.name.c_str(), library.c_str());
+            continue;
+        }
+        bound_signatures[address] = &signature;
+    }
+}
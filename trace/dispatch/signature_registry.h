@@ -0,0 +1,129 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2024 g2wfw
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_SIGNATURE_REGISTRY_H
+#define QBDI_TRACER_SIGNATURE_REGISTRY_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../common.h"
+
+typedef enum {
+    // hex
+    kSigArgValue,
+    // decimal
+    kSigArgInt,
+    kSigArgString,
+    // hexdump, the length comes from another argument or is fixed
+    kSigArgBuffer,
+    kSigArgFd,
+    // names of the enum the value is made of, hex without an enum
+    kSigArgFlags,
+    // the callee writes through it, the pointed word prints when the call returns
+    kSigArgOut,
+} signature_arg_kind_t;
+
+typedef struct signature_flag {
+    std::string name;
+    uint64_t value;
+} signature_flag_t;
+
+typedef struct signature_arg {
+    std::string name;
+    signature_arg_kind_t kind = kSigArgValue;
+    // kSigArgBuffer, index of the length argument or -1 to dump length bytes
+    int length_arg = -1;
+    size_t length = 0;
+    // kSigArgFlags
+    std::vector<signature_flag_t> flags;
+} signature_arg_t;
+
+typedef struct function_signature {
+    std::string library;
+    std::string name;
+    // from the library load bias, 0 to look name up as a symbol
+    uintptr_t offset = 0;
+    fun_data_type_t ret_type = kNumber;
+    std::vector<signature_arg_t> args;
+    // true once the library was found, a missing symbol is not looked up again
+    bool bound = false;
+} function_signature_t;
+
+/**
+ * Function signatures read from a text spec at runtime, so functions of
+ * private libraries decode without rebuilding the tracer:
+ *
+ *   # comment
+ *   [libfoo.so]
+ *   enum open_flags O_RDONLY=0 O_WRONLY=1 O_RDWR=2 O_CREAT=0x40
+ *   foo_open(string path, flags:open_flags flags, int mode) -> number
+ *   foo_read(fd fd, buffer:count buf, size count) -> number
+ *   foo_get_key@0x1a2b0(ptr ctx, out key, buffer:16 iv) -> void
+ *
+ * Kinds are value/ptr/size (hex), int, string, fd, flags[:enum],
+ * buffer:<length argument or byte count> and out; ret is number, pointer,
+ * string or void. name@offset names a function of a stripped library by
+ * its offset from the load bias. A signature overrides the built in handler
+ * of the same function, a later one for the same function replaces it.
+ * Signatures of libraries not loaded yet bind once they are.
+ */
+class SignatureRegistry {
+public:
+    static SignatureRegistry *get_instance() {
+        static SignatureRegistry instance;
+        return &instance;
+    }
+
+    // load before tracing starts, error gets the first bad line
+    bool load_file(const std::string &path, std::string *error = nullptr);
+
+    bool load(const std::string &spec, std::string *error = nullptr);
+
+    // binds the signatures of libraries loaded since, InstructionDispatchManager runs it on rebuild
+    void bind();
+
+    [[nodiscard]] const function_signature_t *find(uintptr_t address) const {
+        auto find = bound_signatures.find(address);
+        return find == bound_signatures.end() ? nullptr : find->second;
+    }
+
+private:
+    SignatureRegistry() = default;
+
+    bool parse_line(const std::string &line, std::string &library, std::string *error);
+
+    // library and name to signature, nodes stay put so bound_signatures may point at them
+    std::map<std::pair<std::string, std::string>, function_signature_t> signatures;
+    std::unordered_map<uintptr_t, const function_signature_t *> bound_signatures;
+    std::unordered_map<std::string, std::vector<signature_flag_t>> enums;
+
+    DISALLOW_COPY_AND_ASSIGN(SignatureRegistry);
+};
+
+
+#endif //QBDI_TRACER_SIGNATURE_REGISTRY_H
@@ -0,0 +1,80 @@
+//
+//
+//
+
+#ifndef ITRACE_NATIVE_SYSCALL_TABLE_H
+#define ITRACE_NATIVE_SYSCALL_TABLE_H
+
+#include <array>
+#include <cstdint>
+#include <sys/syscall.h>
+#include "../common.h"
+
+typedef enum syscall_arg_kind : uint8_t {
+    // printed as hex, like everything but kSysArgPath and kSysArgInt
+    kSysArgValue,
+    kSysArgInt,
+    kSysArgFd,
+    kSysArgPath,
+    kSysArgPointer,
+    kSysArgFlags,
+    kSysArgSize,
+    // hexdump of the buffer, its length is the next argument
+    kSysArgInBuffer,
+    // filled by the call, dumped on return with as many bytes as it returned
+    kSysArgOutBuffer,
+} syscall_arg_kind_t;
+
+typedef struct syscall_arg_desc {
+    const char *name;
+    syscall_arg_kind_t kind;
+} syscall_arg_desc_t;
+
+typedef struct syscall_desc {
+    const char *name;
+    fun_data_type_t ret_type;
+    uint8_t arg_count;
+    syscall_arg_desc_t args[6];
+} syscall_desc_t;
+
+typedef struct syscall_entry {
+    uint32_t nr;
+    syscall_desc_t desc;
+} syscall_entry_t;
+
+/**
+ * Every syscall of syscalls.txt the headers of this arch define, in the
+ * order of the spec. Edit syscalls.txt and run gen_syscall_table.py rather
+ * than syscall_table.inc.
+ */
+inline constexpr syscall_entry_t kSyscallEntries[] = {
+#include "syscall_table.inc"
+};
+
+// above every __NR_ of arm and arm64, the private __ARM_NR_ calls are not decoded
+inline constexpr uint32_t kMaxSyscallNumber = 512;
+
+constexpr std::array<uint16_t, kMaxSyscallNumber> build_syscall_index() {
+    std::array<uint16_t, kMaxSyscallNumber> index{};
+    for (auto &slot: index) {
+        slot = UINT16_MAX;
+    }
+    for (size_t i = 0; i < sizeof(kSyscallEntries) / sizeof(kSyscallEntries[0]); ++i) {
+        if (kSyscallEntries[i].nr < kMaxSyscallNumber) {
+            index[kSyscallEntries[i].nr] = static_cast<uint16_t>(i);
+        }
+    }
+    return index;
+}
+
+// syscall number to position in kSyscallEntries, built by the compiler
+inline constexpr auto kSyscallIndex = build_syscall_index();
+
+static inline const syscall_desc_t *get_syscall_desc(uintptr_t nr) {
+    if (nr >= kMaxSyscallNumber || kSyscallIndex[nr] == UINT16_MAX) {
+        return nullptr;
+    }
+    return &kSyscallEntries[kSyscallIndex[nr]].desc;
+}
+
+#endif  //ITRACE_NATIVE_SYSCALL_TABLE_H
@@ -44,6 +44,15 @@ QBDI::VMAction pre_instruction_call(QBDI::VM *vm, QBDI::GPRState *gprState,
     if (fprState != nullptr) {
         memcpy(&info->pre_status.fpr_state, fprState, sizeof(QBDI::FPRState));
     }
+    // write addresses are known before the instruction runs, their values only after
+    if (info_manger->is_snapshot_enabled()) {
+        for (const auto &ma: vm->getInstMemoryAccess()) {
+            if (ma.type != QBDI::MemoryAccessType::MEMORY_READ &&
+                !self->is_address_in_stack_range(ma.accessAddress)) {
+                info_manger->before_memory_write(ma.accessAddress, ma.size);
+            }
+        }
+    }
     //check fun call
     if ((inst->isBranch || inst->isCall) && inst->affectControlFlow) {
         info_manger->alloc_fun_call(gprState->pc);
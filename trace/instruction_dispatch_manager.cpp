@@ -24,40 +24,167 @@
 
 
 #include "instruction_dispatch_manager.h"
+#include <algorithm>
+#include <cstring>
+#include <dlfcn.h>
+#include <thread>
 #include "dispatch/dispatch_jni_env.h"
 #include "dispatch/dispatch_libz.h"
 #include "dispatch/dispatch_libc.h"
 #include "dispatch/dispatch_syscall.h"
+#include "dispatch/dispatch_signature.h"
+#include "dispatch/dispatch_symbol.h"
+#include "dispatch/signature_registry.h"
+
+// svc carries no call target
+static const dispatch_target_t kSyscallTarget = {};
 
 bool InstructionDispatchManager::dispatch_args(inst_trace_info_t *call) {
     if (call->fun_call != nullptr && call->fun_call->is_svc) {
-        DispatchSyscall::get_instance()->dispatch_args(call);
+        DispatchSyscall::get_instance()->dispatch_args(call, kSyscallTarget);
         return true;
     }
-    for (const auto &item: this->dispatch_list) {
-        if (item->dispatch_args(call)) {
-            return true;
-        }
+    auto target = resolve(call->pc, call->fun_call->fun_address);
+    call->fun_call->target = target;
+    if (target->dispatcher == nullptr) {
+        return false;
     }
-    return false;
+    return target->dispatcher->dispatch_args(call, *target);
 }
 
 bool InstructionDispatchManager::dispatch_ret(inst_trace_info_t *call,
                                               const QBDI::GPRState *ret_status) {
     if (call->fun_call != nullptr && call->fun_call->is_svc) {
-        DispatchSyscall::get_instance()->dispatch_ret(call, ret_status);
+        DispatchSyscall::get_instance()->dispatch_ret(call, ret_status, kSyscallTarget);
         return true;
     }
-    for (const auto &item: this->dispatch_list) {
-        if (item->dispatch_ret(call, ret_status)) {
-            return true;
+    // a dispatcher that finished loading in between would read args it never captured
+    auto target = std::move(call->fun_call->target);
+    if (target == nullptr) {
+        target = resolve(call->pc, call->fun_call->fun_address);
+    }
+    if (target->dispatcher == nullptr) {
+        return false;
+    }
+    return target->dispatcher->dispatch_ret(call, ret_status, *target);
+}
+
+const char *InstructionDispatchManager::get_target_name(inst_trace_info_t *call) {
+    return resolve(call->pc, call->fun_call->fun_address)->fun_name;
+}
+
+std::shared_ptr<const dispatch_target_t> InstructionDispatchManager::resolve(uintptr_t call_pc,
+                                                                          uintptr_t target) {
+    if (index_dirty.exchange(false, std::memory_order_acquire)) {
+        rebuild_index();
+    }
+    // instructions are at least 2 bytes apart
+    auto &entry = call_site_cache[(call_pc >> 1) & (kCallSiteCacheSize - 1)];
+    if (entry.resolved != nullptr && entry.call_pc == call_pc && entry.target == target) {
+        return entry.resolved;
+    }
+    auto find = resolved_targets.find(target);
+    if (find == resolved_targets.end()) {
+        dispatch_target_t resolved;
+        resolved.dispatcher = find_dispatch(target);
+        if (resolved.dispatcher != nullptr && !resolved.dispatcher->is_loaded()) {
+            return resolve_pending(resolved.dispatcher, target);
+        }
+        if (resolved.dispatcher == nullptr) {
+            resolved.dispatcher = DispatchSymbol::get_instance();
+        }
+        resolved.dispatcher->resolve(target, &resolved);
+        auto signature = SignatureRegistry::get_instance()->find(target);
+        if (signature != nullptr) {
+            // a spec signature wins over the built in handler, its ret_handler stays
+            resolved.dispatcher = DispatchSignature::get_instance();
+            resolved.fun_name = signature->name.c_str();
+            resolved.signature = signature;
         }
+        find = resolved_targets.emplace(
+                target, std::make_shared<const dispatch_target_t>(resolved)).first;
     }
-    return false;
+    entry.call_pc = call_pc;
+    entry.target = target;
+    entry.resolved = find->second;
+    return entry.resolved;
+}
+
+std::shared_ptr<const dispatch_target_t>
+InstructionDispatchManager::resolve_pending(DispatchBase *dispatch, uintptr_t target) {
+    // the dynamic symbol table is mapped already, dladdr names exports without touching disk
+    auto pending = std::make_shared<dispatch_target_t>();
+    pending->dispatcher = dispatch;
+    Dl_info info;
+    if (dladdr(reinterpret_cast<void *>(target), &info) != 0 && info.dli_sname != nullptr &&
+        reinterpret_cast<uintptr_t>(info.dli_saddr) == target) {
+        pending->fun_name = info.dli_sname;
+    }
+    return pending;
+}
+
+DispatchBase *InstructionDispatchManager::find_dispatch(uintptr_t address) const {
+    auto it = std::upper_bound(dispatch_index.begin(), dispatch_index.end(), address,
+                               [](uintptr_t value, const dispatch_range_t &range) {
+                                   return value < range.base;
+                               });
+    if (it == dispatch_index.begin()) {
+        return nullptr;
+    }
+    --it;
+    return address <= it->end ? it->dispatch : nullptr;
+}
+
+void InstructionDispatchManager::rebuild_index() {
+    dispatch_index.clear();
+    for (auto dispatch: get_dispatch_list()) {
+        const auto &range = dispatch->get_module_range();
+        dispatch_index.push_back({range.base, range.end, dispatch});
+    }
+    std::sort(dispatch_index.begin(), dispatch_index.end(),
+              [](const dispatch_range_t &a, const dispatch_range_t &b) {
+                  return a.base < b.base;
+              });
+    for (auto &entry: call_site_cache) {
+        entry = {};
+    }
+    resolved_targets.clear();
+    SignatureRegistry::get_instance()->bind();
+}
+
+void InstructionDispatchManager::add_dispatch(DispatchBase *dispatch) {
+    dispatch->ensure_loaded();
+    {
+        std::lock_guard<std::mutex> lock(dispatch_mutex);
+        dispatch_list.emplace_back(dispatch);
+    }
+    invalidate();
+}
+
+void InstructionDispatchManager::on_library_loaded(const char *path, stl::linker_type_t type,
+                                                   void *so_info, void *user_data) {
+    static_cast<InstructionDispatchManager *>(user_data)->invalidate();
 }
 
 InstructionDispatchManager::InstructionDispatchManager() {
     this->dispatch_list.emplace_back(DispatchLibc::get_instance());
     this->dispatch_list.emplace_back(DispatchLibz::get_instance());
     this->dispatch_list.emplace_back(DispatchJNIEnv::get_instance());
+    rebuild_index();
+    // the handler tables take a while, calls made before they are done only get a name
+    loader = std::thread([this, pending = dispatch_list]() {
+        for (auto dispatch: pending) {
+            dispatch->ensure_loaded();
+        }
+        invalidate();
+    });
+    // every path of a shared library contains .so
+    stl::Linker::getInstance()->add_library_monitor(".so", stl::DLOPEN_POST, on_library_loaded,
+                                                    this);
+}
+
+InstructionDispatchManager::~InstructionDispatchManager() {
+    if (loader.joinable()) {
+        loader.join();
+    }
 }
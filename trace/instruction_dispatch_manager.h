@@ -26,11 +26,28 @@
 #ifndef QBDI_TRACER_INSTRUCTION_DISPATCH_MANAGER_H
 #define QBDI_TRACER_INSTRUCTION_DISPATCH_MANAGER_H
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 #include <QBDI.h>
+#include <core/linker.h>
 #include "common.h"
 #include "dispatch/dispatch_base.h"
 
+/**
+ * Routes a call to the dispatcher of the module it lands in. The module
+ * ranges of all dispatchers form one sorted interval index, every target is
+ * resolved once to its dispatch_target_t, and a direct mapped cache keyed by
+ * call site remembers the last target of each call instruction, so repeated
+ * calls from a hot loop cost one compare. Loading a library rebuilds it all.
+ *
+ * Dispatchers only find their module when constructed, their handler tables
+ * and export names are built on a background thread, so the first traced
+ * call never waits for symbols read from disk.
+ */
 class InstructionDispatchManager {
 public:
     static InstructionDispatchManager *getInstance() {
@@ -38,15 +55,73 @@ public:
         return &instance;
     }
 
+    ~InstructionDispatchManager();
+
     bool dispatch_args(inst_trace_info_t *call);
 
     bool dispatch_ret(inst_trace_info_t *call, const QBDI::GPRState *ret_status);
 
+    // name of the call target, kept with the resolved target so it is built once per target
+    const char *get_target_name(inst_trace_info_t *call);
+
+    // the dispatcher must live for the whole process, it is used from the next call on
+    void add_dispatch(DispatchBase *dispatch);
+
+    // rebuilds the index and drops every resolved target on the next call
+    void invalidate() {
+        index_dirty.store(true, std::memory_order_release);
+    }
+
+    [[nodiscard]] std::vector<DispatchBase *> get_dispatch_list() {
+        std::lock_guard<std::mutex> lock(dispatch_mutex);
+        return dispatch_list;
+    }
+
 private:
+    typedef struct dispatch_range {
+        uintptr_t base;
+        // inclusive, as DispatchBase::is_module_address
+        uintptr_t end;
+        DispatchBase *dispatch;
+    } dispatch_range_t;
+
+    typedef struct call_site_entry {
+        uintptr_t call_pc;
+        uintptr_t target;
+        std::shared_ptr<const dispatch_target_t> resolved;
+    } call_site_entry_t;
+
+    static constexpr size_t kCallSiteCacheSize = 1024;
+
     InstructionDispatchManager();
 
+    // the resolved target of a call, DispatchSymbol for modules without a dispatcher;
+    // shared so a call keeps its target across a rebuild between args and ret
+    std::shared_ptr<const dispatch_target_t> resolve(uintptr_t call_pc, uintptr_t target);
+
+    // a target of a dispatcher still loading, named by dladdr and not cached
+    static std::shared_ptr<const dispatch_target_t> resolve_pending(DispatchBase *dispatch,
+                                                                    uintptr_t target);
+
+    [[nodiscard]] DispatchBase *find_dispatch(uintptr_t address) const;
+
+    void rebuild_index();
+
+    static void on_library_loaded(const char *path, stl::linker_type_t type, void *so_info,
+                                  void *user_data);
+
+    // add_dispatch may run on another thread than the traced one rebuilding the index
+    std::mutex dispatch_mutex;
     /*global instance no free*/
     std::vector<DispatchBase *> dispatch_list;
+    // sorted by base, modules do not overlap
+    std::vector<dispatch_range_t> dispatch_index;
+    std::unordered_map<uintptr_t, std::shared_ptr<const dispatch_target_t>> resolved_targets;
+    call_site_entry_t call_site_cache[kCallSiteCacheSize] = {};
+    // builds the handler tables of the first dispatchers, joined before the manager goes
+    std::thread loader;
+    // set from the thread that loaded a library, the index is rebuilt on the next call
+    std::atomic<bool> index_dirty{false};
 
 };
 
@@ -24,6 +24,8 @@
 
 
 #include "instruction_info_manager.h"
+#include "allocation_tracker.h"
+#include "dispatch/signature_registry.h"
 #define LOG_TAG "QBDI"
 #define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
 #define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
@@ -33,12 +35,71 @@ void InstructionInfoManager::set_enable_to_logcat(bool enable) const {
     this->logger->set_enable_to_logcat(enable);
 }
 
+void InstructionInfoManager::set_logcat_mode(logcat_mode_t mode) const {
+    this->logger->set_logcat_mode(mode);
+}
+
+void InstructionInfoManager::set_logcat_rate_limit(size_t lines_per_second, size_t burst) const {
+    this->logger->set_logcat_rate_limit(lines_per_second, burst);
+}
+
 void InstructionInfoManager::set_enable_to_file(bool enable) const {
     this->logger->set_enable_to_file(enable);
 }
 
-void InstructionInfoManager::set_memory_dump_to_file(bool enable) const {
-    this->logger->set_memory_dump_to_file(enable);
+void InstructionInfoManager::set_memory_dump_to_file(bool enable, bool compress) const {
+    this->logger->set_memory_dump_to_file(enable, compress);
+}
+
+void InstructionInfoManager::set_memory_snapshot(memory_snapshot_mode_t mode,
+                                                 size_t interval) const {
+    this->logger->set_memory_snapshot(mode, interval);
+}
+
+bool InstructionInfoManager::is_snapshot_enabled() const {
+    return this->logger->is_snapshot_enabled();
+}
+
+void InstructionInfoManager::before_memory_write(uintptr_t addr, size_t size) const {
+    this->logger->before_memory_write(addr, size);
+}
+
+bool InstructionInfoManager::set_enable_allocation_tracker(bool enable) const {
+    return AllocationTracker::getInstance()->set_enable(enable);
+}
+
+bool InstructionInfoManager::load_function_signatures(const std::string& path) const {
+    std::string error;
+    auto loaded = SignatureRegistry::get_instance()->load_file(path, &error);
+    if (!loaded) {
+        LOGE("load function signatures %s: %s", path.c_str(), error.c_str());
+    }
+    // good lines of a spec with bad ones still apply
+    this->dispatch_manager->invalidate();
+    return loaded;
+}
+
+void InstructionInfoManager::set_capture_limit(capture_kind_t kind, uint32_t bytes) const {
+    ArgCapture::get_instance()->set_limit(kind, bytes);
+}
+
+bool InstructionInfoManager::set_enable_to_shared_memory(bool enable,
+                                                         const std::string& collector_name,
+                                                         size_t ring_size) const {
+    return this->logger->set_enable_to_shared_memory(enable, collector_name, ring_size);
+}
+
+bool InstructionInfoManager::set_enable_to_binary_file(bool enable, bool compress) const {
+    return this->logger->set_enable_to_binary_file(enable, compress);
+}
+
+bool InstructionInfoManager::set_enable_to_socket(bool enable, const std::string& address,
+                                                  bool compress) const {
+    return this->logger->set_enable_to_socket(enable, address, compress);
+}
+
+void InstructionInfoManager::set_branch_only(bool enable) const {
+    this->logger->set_branch_only(enable);
 }
 
 void InstructionInfoManager::flush() {
@@ -111,7 +172,13 @@ void InstructionInfoManager::dispatch_fun_call_common_args(uintptr_t pc) const {
     auto jump_target_address = pc;
     cur_info->fun_call->fun_address = jump_target_address;
     cur_info->fun_call->call_module_name = this->module_name;
-    cur_info->fun_call->fun_name = fmt::format("{:#x}", pc - this->module_range.base);
+    // the export holding pc or module+offset, formatted once per target by DispatchSymbol
+    auto name = this->dispatch_manager->get_target_name(cur_info);
+    if (name != nullptr) {
+        cur_info->fun_call->fun_name = name;
+    } else {
+        cur_info->fun_call->fun_name = fmt::format("{:#x}", pc - this->module_range.base);
+    }
     add_common_reg_values(cur_info);
 }
 
@@ -32,6 +32,7 @@
 #include "common.h"
 #include "instruction_dispatch_manager.h"
 #include "logger_manager.h"
+#include "dispatch/arg_capture.h"
 
 class InstructionInfoManager {
 public:
@@ -81,9 +82,40 @@ public:
 
     void set_enable_to_logcat(bool enable) const;
 
+    void set_logcat_mode(logcat_mode_t mode) const;
+
+    void set_logcat_rate_limit(size_t lines_per_second, size_t burst) const;
+
     void set_enable_to_file(bool enable) const;
 
-    void set_memory_dump_to_file(bool enable) const;
+    void set_memory_dump_to_file(bool enable, bool compress = true) const;
+
+    void set_memory_snapshot(memory_snapshot_mode_t mode, size_t interval = 0) const;
+
+    [[nodiscard]] bool is_snapshot_enabled() const;
+
+    // a traced instruction is about to write, see MemoryManager::before_write
+    void before_memory_write(uintptr_t addr, size_t size) const;
+
+    // process wide, see AllocationTracker
+    bool set_enable_allocation_tracker(bool enable) const;
+
+    // function signatures to decode, see SignatureRegistry for the format
+    bool load_function_signatures(const std::string& path) const;
+
+    // bytes a call may copy of a string or buffer argument, see ArgCapture
+    void set_capture_limit(capture_kind_t kind, uint32_t bytes) const;
+
+    bool set_enable_to_shared_memory(bool enable,
+                                     const std::string& collector_name = kDefaultCollectorName,
+                                     size_t ring_size = kDefaultRingSize) const;
+
+    bool set_enable_to_binary_file(bool enable, bool compress = true) const;
+
+    bool set_enable_to_socket(bool enable, const std::string& address = kDefaultCollectorName,
+                              bool compress = true) const;
+
+    void set_branch_only(bool enable) const;
 
     void flush();
 private:
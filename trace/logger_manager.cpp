@@ -27,7 +27,10 @@
 #include "jni_provider.h"
 #include "common.h"
 #include "memory_manager.h"
-#include <spdlog/sinks/android_sink.h>
+#include "trace_bundle.h"
+#include "sink/file_trace_output.h"
+#include "sink/socket_trace_output.h"
+#include "record/call_arg_format.h"
 #include <spdlog/sinks/sink.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/async.h>
@@ -42,6 +45,9 @@
 #define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
 #define LOGD(...) __android_log_print(ANDROID_LOG_DEBUG, LOG_TAG, __VA_ARGS__)
 
+// summary logcat mode prints the counters every kSummaryInterval instructions
+static constexpr uint64_t kSummaryInterval = 100000;
+
 static uint64_t get_timestamp_ms() {
     struct timeval tv;
     gettimeofday(&tv, nullptr);
@@ -94,36 +100,66 @@ static std::string get_files_dir(JNIEnv *env) {
 }
 
 void LoggerManager::set_enable_to_logcat(bool enable) {
-    if (enable && this->logcat != nullptr) {
+    set_logcat_mode(enable ? kLogcatFull : kLogcatDisable);
+}
+
+void LoggerManager::set_logcat_mode(logcat_mode_t mode) {
+    this->logcat_mode = mode;
+    if (mode == kLogcatDisable) {
+        if (this->logcat != nullptr) {
+            this->logcat->flush();
+            this->logcat.reset();
+            this->logcat_sink.reset();
+        }
         return;
     }
-    if (!enable && this->logcat != nullptr) {
-        this->logcat.reset();
+    if (this->logcat != nullptr) {
         return;
     }
-    if (enable) {
-        this->logcat = spdlog::android_logger_mt("logcat_itrace", "qbdi");
-        logcat->set_pattern("[%H:%M:%S.%e] %v");
+    // not registered with spdlog, so logcat can be switched off and on again
+    this->logcat_sink = std::make_shared<LogcatBatchSink>("qbdi", logcat_lines_per_second,
+                                                          logcat_burst);
+    this->logcat = std::make_shared<spdlog::logger>("logcat_itrace", logcat_sink);
+    logcat->set_pattern("[%H:%M:%S.%e] %v");
+}
+
+void LoggerManager::set_logcat_rate_limit(size_t lines_per_second, size_t burst) {
+    this->logcat_lines_per_second = lines_per_second;
+    this->logcat_burst = burst;
+    if (this->logcat_sink != nullptr) {
+        this->logcat_sink->set_rate_limit(lines_per_second, burst);
+    }
+}
+
+bool LoggerManager::prepare_trace_log_base() {
+    if (!trace_log_base.empty()) {
+        return true;
+    }
+    auto env = smjni::jni_provider::get_jni();
+    auto file_dir = get_files_dir(env);
+    std::string trace_log_dir = file_dir + "/itrace/";
+    if (!check_and_mkdir(trace_log_dir)) {
+        LOGE("mkdir failed %s", trace_log_dir.c_str());
+        return false;
+    }
+    trace_log_base = fmt::format("{}{}_{:x}_{:x}/", trace_log_dir,
+                                 basename(this->module_name.c_str()), module_range.base,
+                                 get_timestamp_ms());
+    if (!check_and_mkdir(trace_log_base)) {
+        LOGE("mkdir failed %s", trace_log_base.c_str());
     }
+    TraceBundleWriter bundle(trace_log_dir, trace_log_base);
+    if (!bundle.write(this->module_name, module_range)) {
+        LOGW("trace bundle of %s is incomplete", trace_log_base.c_str());
+    }
+    return true;
 }
 
 void LoggerManager::set_enable_to_file(bool enable) {
     if (enable) {
-        auto env = smjni::jni_provider::get_jni();
-        auto file_dir = get_files_dir(env);
-        std::string trace_log_dir = file_dir + "/itrace/";
-        if (!check_and_mkdir(trace_log_dir)) {
-            LOGE("mkdir failed %s", trace_log_dir.c_str());
+        if (!prepare_trace_log_base()) {
             return;
         }
-        if (trace_log_base.empty()) {
-            trace_log_base = fmt::format("{}{}_{:x}_{:x}/", trace_log_dir,
-                                         basename(this->module_name.c_str()), module_range.base,
-                                         get_timestamp_ms());
-            if (!check_and_mkdir(trace_log_base)) {
-                LOGE("mkdir failed %s", trace_log_base.c_str());
-            }
-        }
         if (this->file_log == nullptr) {
             this->file_log = spdlog::basic_logger_mt("itracer", trace_log_base + "itrace.txt",
                                                      false);
@@ -136,27 +172,16 @@ void LoggerManager::set_enable_to_file(bool enable) {
     }
 }
 
-void LoggerManager::set_memory_dump_to_file(bool dump) {
+void LoggerManager::set_memory_dump_to_file(bool dump, bool compress) {
     if (dump) {
-        auto env = smjni::jni_provider::get_jni();
-        auto file_dir = get_files_dir(env);
-        std::string trace_log_dir = file_dir + "/itrace/";
-        if (!check_and_mkdir(trace_log_dir)) {
-            LOGE("mkdir failed %s", trace_log_dir.c_str());
+        if (!prepare_trace_log_base()) {
             return;
         }
-        if (trace_log_base.empty()) {
-            trace_log_base = fmt::format("{}{}_{:x}_{:x}/", trace_log_dir,
-                                         basename(this->module_name.c_str()), module_range.base,
-                                         get_timestamp_ms());
-            if (!check_and_mkdir(trace_log_base)) {
-                LOGE("mkdir failed %s", trace_log_base.c_str());
-            }
-        }
         if (memory_manager == nullptr) {
             memory_manager = std::make_unique<MemoryManager>();
         }
-        memory_manager->set_dump_path(trace_log_base + "/memory_dump.txt");
+        memory_manager->set_snapshot_mode(snapshot_mode, snapshot_interval);
+        memory_manager->set_dump_path(trace_log_base + "memory_dump.bin", compress);
     } else {
         if (this->memory_manager != nullptr) {
             this->memory_manager.reset();
@@ -164,10 +189,133 @@ void LoggerManager::set_memory_dump_to_file(bool dump) {
     }
 }
 
+bool LoggerManager::set_enable_to_shared_memory(bool enable, const std::string &collector_name,
+                                                size_t ring_size) {
+    if (!enable) {
+        if (this->ring_output != nullptr) {
+            this->record_writer->remove_output(this->ring_output);
+            this->ring_output.reset();
+            update_record_writer();
+        }
+        return true;
+    }
+    if (this->ring_output != nullptr) {
+        return true;
+    }
+    auto session_name = fmt::format("{}_{:x}_{:x}", basename(this->module_name.c_str()),
+                                    module_range.base, get_timestamp_ms());
+    this->ring_output = ShmRingOutput::create(collector_name, session_name, ring_size);
+    if (this->ring_output == nullptr) {
+        LOGE("trace collector @%s not available", collector_name.c_str());
+        return false;
+    }
+    update_record_writer();
+    this->record_writer->add_output(this->ring_output);
+    return true;
+}
+
+bool LoggerManager::set_enable_to_binary_file(bool enable, bool compress) {
+    if (!enable) {
+        if (this->binary_file_output != nullptr) {
+            this->record_writer->remove_output(this->binary_file_output);
+            this->binary_file_output.reset();
+            update_record_writer();
+        }
+        return true;
+    }
+    if (this->binary_file_output != nullptr) {
+        return true;
+    }
+    if (!prepare_trace_log_base()) {
+        return false;
+    }
+    auto file_output = FileTraceOutput::create(trace_log_base + "itrace.bin");
+    if (file_output == nullptr) {
+        return false;
+    }
+    this->binary_file_output = std::make_shared<AsyncTraceOutput>(file_output, compress);
+    update_record_writer();
+    this->record_writer->add_output(this->binary_file_output);
+    return true;
+}
+
+bool LoggerManager::set_enable_to_socket(bool enable, const std::string &address, bool compress) {
+    if (!enable) {
+        if (this->socket_output != nullptr) {
+            this->record_writer->remove_output(this->socket_output);
+            this->socket_output.reset();
+            update_record_writer();
+        }
+        return true;
+    }
+    if (this->socket_output != nullptr) {
+        return true;
+    }
+    auto session_name = fmt::format("{}_{:x}_{:x}", basename(this->module_name.c_str()),
+                                    module_range.base, get_timestamp_ms());
+    // a collector that is not running yet is picked up by the reconnect logic
+    auto stream = SocketTraceOutput::create(address, session_name);
+    this->socket_output = std::make_shared<AsyncTraceOutput>(stream, compress);
+    update_record_writer();
+    this->record_writer->add_output(this->socket_output);
+    return true;
+}
+
+void LoggerManager::set_memory_snapshot(memory_snapshot_mode_t mode, size_t interval) {
+    this->snapshot_mode = mode;
+    this->snapshot_interval = interval;
+    if (this->memory_manager != nullptr) {
+        this->memory_manager->set_snapshot_mode(mode, interval);
+    }
+}
+
+bool LoggerManager::is_snapshot_enabled() const {
+    return this->memory_manager != nullptr && this->memory_manager->is_snapshot_enabled();
+}
+
+void LoggerManager::before_memory_write(uintptr_t addr, size_t size) const {
+    if (is_address_in_module_range(addr) || this->memory_manager == nullptr) {
+        return;
+    }
+    this->memory_manager->before_write(addr, size);
+}
+
+void LoggerManager::set_branch_only(bool enable) {
+    this->branch_only = enable;
+    if (this->record_writer != nullptr && this->record_writer->is_branch_only() != enable) {
+        // the writer only exists while outputs are attached, the next one picks the mode up
+        LOGW("branch only mode %s once every binary output is disabled",
+             enable ? "starts" : "ends");
+    }
+}
+
+void LoggerManager::update_record_writer() {
+    if (this->record_writer == nullptr) {
+        this->record_writer = std::make_unique<TraceRecordWriter>(module_name, module_range);
+        this->record_writer->set_branch_only(this->branch_only);
+        return;
+    }
+    if (!this->record_writer->has_output()) {
+        this->record_writer.reset();
+    }
+}
+
 void LoggerManager::flush() {
     if (this->memory_manager != nullptr) {
         this->memory_manager->clear();
     }
+    if (this->record_writer != nullptr) {
+        this->record_writer->flush();
+    }
+    if (this->logcat != nullptr) {
+        if (this->logcat_mode == kLogcatSummary) {
+            write_summary();
+        }
+        this->logcat->flush();
+    }
+    if (this->file_log != nullptr) {
+        this->file_log->flush();
+    }
 }
 
 bool LoggerManager::check_and_mkdir(std::string &path) {
@@ -204,10 +352,11 @@ static inline std::string trim(const std::string &str) {
 void LoggerManager::write_trace_info(const inst_trace_info_t *info,
                                      const QBDI::InstAnalysis *instAnalysis,
                                      std::vector<QBDI::MemoryAccess> &memoryAccesses) const {
-    if (this->logcat == nullptr && this->file_log == nullptr) {
+    if (this->logcat == nullptr && this->file_log == nullptr && this->record_writer == nullptr) {
         return;
     }
-    if (info->fun_call != nullptr && !info->fun_call->fun_name.empty()) {
+    if (info->fun_call != nullptr && !info->fun_call->fun_name.empty() &&
+        memory_manager != nullptr) {
         if (info->fun_call->memory_free_address != 0) {
             memory_manager->remove_memory(info->fun_call->memory_free_address);
         }
@@ -215,6 +364,30 @@ void LoggerManager::write_trace_info(const inst_trace_info_t *info,
             memory_manager->add_memory(info->fun_call->memory_alloc_address,
                                        info->fun_call->memory_alloc_size);
         }
+        if (info->fun_call->memory_map_changed) {
+            memory_manager->invalidate_maps();
+        }
+        memory_manager->on_call();
+    }
+    collect_access_info(memoryAccesses);
+    if (this->record_writer != nullptr) {
+        this->record_writer->write_inst(info, instAnalysis, access_infos);
+    }
+    if (this->logcat == nullptr && this->file_log == nullptr) {
+        return;
+    }
+    bool is_call = info->fun_call != nullptr && !info->fun_call->fun_name.empty();
+    inst_count++;
+    if (is_call) {
+        call_count++;
+    }
+    if (this->logcat_mode == kLogcatSummary && this->logcat != nullptr &&
+        inst_count % kSummaryInterval == 0) {
+        write_summary();
+    }
+    if (this->file_log == nullptr && this->logcat_mode == kLogcatSummary && !is_call) {
+        // summary logcat does not need the line, skip formatting it
+        return;
     }
     std::string line = (fmt::format("|{:#x}", info->pc));
     //[00:31:57.995]|0x76a5af6488|0x13214c| lsl w15, w15, #3|[W15= 0x8 ==> 0x40]
@@ -231,7 +404,7 @@ void LoggerManager::write_trace_info(const inst_trace_info_t *info,
     }
     line.append("|");
     std::string memory_access_info;
-    format_access_info(memory_access_info, memoryAccesses);;
+    format_access_info(memory_access_info, access_infos);
     if (!memory_access_info.empty()) {
         line.append(memory_access_info);
     }
@@ -242,43 +415,63 @@ void LoggerManager::write_trace_info(const inst_trace_info_t *info,
         line.append(call_info);
     }
 
-    write_info(line);
+    write_info(line, is_call);
 }
 
 
+void LoggerManager::collect_access_info(std::vector<QBDI::MemoryAccess> &memoryAccesses) const {
+    access_infos.clear();
+    for (const auto &ma: memoryAccesses) {
+        trace_memory_access_t access{};
+        access.address = ma.accessAddress;
+        access.value = ma.value;
+        access.size = ma.size;
+        access.type = ma.type == QBDI::MemoryAccessType::MEMORY_READ ? kAccessRead : kAccessWrite;
+        if (is_address_in_module_range(ma.accessAddress)) {
+            access.flags = kAccessInModule;
+        } else if (this->memory_manager != nullptr) {
+            auto [offset, memory_index] = this->memory_manager->get_memory_offset(ma.accessAddress);
+            access.block_offset = offset;
+            access.block_index = memory_index;
+        } else {
+            access.block_offset = static_cast<size_t>(-1);
+        }
+        access_infos.push_back(access);
+    }
+}
+
 void LoggerManager::format_access_info(std::string &result,
-                                       std::vector<QBDI::MemoryAccess> &memoryAccesses) const {
-    if (memoryAccesses.empty()) {
+                                       const std::vector<trace_memory_access_t> &accesses) const {
+    if (accesses.empty()) {
         return;
     }
     std::vector<std::string> ma_info;
-    for (const auto &ma: memoryAccesses) {
-        if (is_address_in_module_range(ma.accessAddress)) {
-            if (ma.type == QBDI::MemoryAccessType::MEMORY_READ) {
+    for (const auto &ma: accesses) {
+        if (ma.flags & kAccessInModule) {
+            if (ma.type == kAccessRead) {
                 ma_info.push_back(
                         fmt::format("read module offset:{:#x} size:{:#x} => {:#x}",
-                                    ma.accessAddress - module_range.base,
+                                    ma.address - module_range.base,
                                     ma.size, ma.value));
             } else {
                 ma_info.push_back(
                         fmt::format("write module offset:{:#x} size:{:#x} => {:#x} ",
-                                    ma.accessAddress - module_range.base,
+                                    ma.address - module_range.base,
                                     ma.size, ma.value));
             }
         } else {
-            auto [offset, memory_index] = this->memory_manager->get_memory_offset(ma.accessAddress);
-            if (ma.type == QBDI::MemoryAccessType::MEMORY_READ) {
+            if (ma.type == kAccessRead) {
                 ma_info.push_back(
                         fmt::format(
                                 "read memory:{:#x}=>{:#x} memory block index:{:#x} size:{:#x} offset:{:#x}",
-                                ma.accessAddress, ma.value, memory_index,
-                                ma.size, offset));
+                                ma.address, ma.value, ma.block_index,
+                                ma.size, ma.block_offset));
             } else {
                 ma_info.push_back(
                         fmt::format(
                                 "write memory:{:#x}=>{:#x} memory block index:{:#x} size:{:#x} offset:{:#x}",
-                                ma.accessAddress, ma.value, memory_index,
-                                ma.size, offset));
+                                ma.address, ma.value, ma.block_index,
+                                ma.size, ma.block_offset));
 
             }
         }
@@ -290,8 +483,8 @@ void LoggerManager::format_access_info(std::string &result,
     result = join(ma_info, ",");
 }
 
-void LoggerManager::write_info(std::string &line) const {
-    if (this->logcat != nullptr) {
+void LoggerManager::write_info(std::string &line, bool is_call) const {
+    if (this->logcat != nullptr && (this->logcat_mode == kLogcatFull || is_call)) {
         this->logcat->info(line);
     }
     if (this->file_log != nullptr) {
@@ -299,6 +492,12 @@ void LoggerManager::write_info(std::string &line) const {
     }
 }
 
+void LoggerManager::write_summary() const {
+    this->logcat->info(fmt::format("|summary|{}|instructions:{} calls:{} logcat dropped:{}",
+                                   module_name, inst_count, call_count,
+                                   logcat_sink->get_dropped_lines()));
+}
+
 void LoggerManager::format_register_info(std::string &result, const inst_trace_info_t *info,
                                          const QBDI::InstAnalysis *inst) {
     //[],read:[]
@@ -471,9 +670,24 @@ void LoggerManager::format_call_info(std::string &result, const inst_trace_info_
     result.append(call->call_module_name);
     result.append(":");
     result.append(call->fun_name);
-    result.append(" args:");
-    result.append(join(call->args, ","));
-    result.append(" ");
+    // rendered arguments then raw ones in one list, the same text as before the raw capture.
+    // The text log renders them here on the traced thread, binary traces leave it to the reader
+    result.append(" args:[");
+    for (size_t i = 0; i < call->args.size(); ++i) {
+        if (i != 0) {
+            result.append(",");
+        }
+        result.append(call->args[i]);
+    }
+    for (size_t i = 0; i < call->raw_args.size(); ++i) {
+        const auto &arg = call->raw_args[i];
+        if (i != 0 || !call->args.empty()) {
+            result.append(",");
+        }
+        append_call_arg(result, arg.name, arg.kind, arg.value,
+                        call->arg_data.data() + arg.data_offset, arg.data_size);
+    }
+    result.append("] ");
     result.append(call->ret_value);
 }
 
@@ -481,4 +695,6 @@ LoggerManager::~LoggerManager() {
     if (this->memory_manager != nullptr) {
         this->memory_manager->clear();
     }
+    // closes the outputs with the final instruction count
+    this->record_writer.reset();
 }
\ No newline at end of file
@@ -31,6 +31,18 @@
 #include <QBDI.h>
 #include "memory_manager.h"
 #include "common.h"
+#include "sink/logcat_batch_sink.h"
+#include "sink/shm_ring_output.h"
+#include "sink/async_trace_output.h"
+#include "record/trace_record_writer.h"
+
+typedef enum logcat_mode {
+    kLogcatDisable,
+    // every trace line goes to logcat
+    kLogcatFull,
+    // only call lines and periodic counters, the full trace is expected in the file
+    kLogcatSummary,
+} logcat_mode_t;
 
 class LoggerManager {
 public:
@@ -48,16 +60,45 @@ public:
 
     void set_enable_to_logcat(bool enable);
 
+    void set_logcat_mode(logcat_mode_t mode);
+
+    void set_logcat_rate_limit(size_t lines_per_second, size_t burst);
+
     void set_enable_to_file(bool enable);
 
-    void set_memory_dump_to_file(bool dump);
+    // binary memory_dump.bin, rendered as text by itrace-memdump
+    void set_memory_dump_to_file(bool dump, bool compress = true);
+
+    // versions of tracked blocks in memory_dump.bin, interval only counts for kSnapshotPerWrites
+    void set_memory_snapshot(memory_snapshot_mode_t mode, size_t interval = 0);
+
+    [[nodiscard]] bool is_snapshot_enabled() const;
+
+    // called before the instruction runs, the snapshot has to see the old bytes
+    void before_memory_write(uintptr_t addr, size_t size) const;
+
+    bool set_enable_to_shared_memory(bool enable,
+                                     const std::string &collector_name = kDefaultCollectorName,
+                                     size_t ring_size = kDefaultRingSize);
+
+    bool set_enable_to_binary_file(bool enable, bool compress = true);
+
+    bool set_enable_to_socket(bool enable, const std::string &address = kDefaultCollectorName,
+                              bool compress = true);
+
+    // applies to binary outputs enabled while no other binary output is active
+    void set_branch_only(bool enable);
 
     void flush();
 
 private:
     static bool check_and_mkdir(std::string &path);
 
-    void write_info(std::string &line) const;
+    bool prepare_trace_log_base();
+
+    void write_info(std::string &line, bool is_call) const;
+
+    void write_summary() const;
 
     static void
     format_register_info(std::string &result, const inst_trace_info_t *info,
@@ -67,7 +108,11 @@ private:
                                  const QBDI::InstAnalysis *instAnalysis);
 
     void
-    format_access_info(std::string &result, std::vector <QBDI::MemoryAccess> &memoryAccesses) const;
+    format_access_info(std::string &result, const std::vector <trace_memory_access_t> &accesses) const;
+
+    void collect_access_info(std::vector <QBDI::MemoryAccess> &memoryAccesses) const;
+
+    void update_record_writer();
 
     [[nodiscard]] inline bool is_address_in_module_range(uintptr_t addr) const {
         return addr >= this->module_range.base && addr < this->module_range.end;
@@ -76,7 +121,21 @@ private:
 
 private:
     std::unique_ptr <MemoryManager> memory_manager;
+    memory_snapshot_mode_t snapshot_mode = kSnapshotDisable;
+    size_t snapshot_interval = 0;
     std::shared_ptr <spdlog::logger> logcat;
+    std::shared_ptr <LogcatBatchSink> logcat_sink;
+    logcat_mode_t logcat_mode = kLogcatDisable;
+    size_t logcat_lines_per_second = LogcatBatchSink::kDefaultLinesPerSecond;
+    size_t logcat_burst = LogcatBatchSink::kDefaultBurst;
+    std::unique_ptr <TraceRecordWriter> record_writer;
+    bool branch_only = false;
+    std::shared_ptr <ShmRingOutput> ring_output;
+    std::shared_ptr <AsyncTraceOutput> binary_file_output;
+    std::shared_ptr <AsyncTraceOutput> socket_output;
+    mutable std::vector <trace_memory_access_t> access_infos;
+    mutable uint64_t inst_count = 0;
+    mutable uint64_t call_count = 0;
     std::shared_ptr <spdlog::logger> file_log;
     std::string trace_log_file;
     std::string trace_log_base;
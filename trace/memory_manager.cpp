@@ -24,13 +24,23 @@
 
 #include <spdlog/fmt/fmt.h>
 #include <android/api-level.h>
+#include <algorithm>
+#include <cstring>
 #include <dlfcn.h>
 #include <QBDI.h>
-#include <sstream>
 #include "memory_manager.h"
-#include "hex_dump.h"
+#include "allocation_tracker.h"
+#include "sink/async_trace_output.h"
+#include "sink/file_trace_output.h"
 
 
+// granularity writes are tracked at between two versions of a block
+static constexpr size_t kSnapshotLineSize = 64;
+// larger blocks are usually whole mappings found by address, too costly to dump in full
+static constexpr size_t kMaxSnapshotSize = 1024 * 1024;
+// tracker blocks given an index, the oldest are forgotten past it and renumbered if seen again
+static constexpr size_t kMaxTrackerIndices = 64 * 1024;
+
 #define LOG_TAG "QBDI"
 #define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
 #define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
@@ -61,12 +71,20 @@ MemoryManager::MemoryManager() {
     dlclose(handler);
 }
 
-void MemoryManager::set_dump_path(const std::string &path) {
+void MemoryManager::set_dump_path(const std::string &path, bool compress) {
     this->dump_path = path;
-    this->memory_dump_file.open(path, std::ios::out | std::ios::trunc | std::ios::binary);
-    if (this->memory_dump_file.is_open()) {
-        LOGI("Memory dump file opened.");
+    auto file_output = FileTraceOutput::create(path);
+    if (file_output == nullptr) {
+        return;
     }
+    auto output = std::make_shared<AsyncTraceOutput>(file_output, compress);
+    this->dump_writer = std::make_unique<MemoryDumpWriter>(output);
+    // the writer closes the output, the worker never calls it after that
+    auto writer = this->dump_writer.get();
+    output->set_drop_listener([writer](const trace_chunk_header_t &header) {
+        writer->on_chunk_dropped(header);
+    });
+    LOGI("Memory dump file opened.");
 }
 
 bool MemoryManager::add_memory(const uintptr_t addr, const size_t size) {
@@ -75,99 +93,265 @@ bool MemoryManager::add_memory(const uintptr_t addr, const size_t size) {
     if (is_in_memory(addr) || is_in_memory(end)) {
         return false;
     }
-    this->memory_infos.emplace_back(this->memory_index.load(), start, end);
+    insert_memory_info({this->memory_index.load(), start, end});
     this->memory_index.fetch_add(1);
     return true;
 }
 
+void MemoryManager::insert_memory_info(const memory_info_t &memory_info) {
+    auto next = this->memory_blocks.upper_bound(memory_info.start);
+    bool overlaps = next != this->memory_blocks.end() && next->second.start <= memory_info.end;
+    if (!overlaps && next != this->memory_blocks.begin()) {
+        overlaps = std::prev(next)->second.end >= memory_info.start;
+    }
+    if (overlaps) {
+        this->overlap_blocks.push_back(memory_info);
+    } else {
+        this->memory_blocks.emplace_hint(next, memory_info.start, memory_info);
+    }
+}
+
+const memory_info_t *MemoryManager::find_memory_info(uintptr_t addr) {
+    // with overlapping blocks an older one may hold addr but not the last address
+    if (this->has_last_hit && this->overlap_blocks.empty() && addr >= this->last_hit.start &&
+        addr <= this->last_hit.end) {
+        return &this->last_hit;
+    }
+    const memory_info_t *found = nullptr;
+    auto it = this->memory_blocks.upper_bound(addr);
+    if (it != this->memory_blocks.begin()) {
+        --it;
+        if (addr <= it->second.end) {
+            found = &it->second;
+        }
+    }
+    for (const auto &memory_info: this->overlap_blocks) {
+        if (addr >= memory_info.start && addr <= memory_info.end &&
+            (found == nullptr || memory_info.memory_index < found->memory_index)) {
+            found = &memory_info;
+        }
+    }
+    if (found == nullptr) {
+        return nullptr;
+    }
+    this->last_hit = *found;
+    this->has_last_hit = true;
+    return &this->last_hit;
+}
+
 void MemoryManager::clear() {
-    for (auto &&memory_info: this->memory_infos) {
+    // dumped in allocation order, as the blocks were tracked
+    std::vector<memory_info_t> memory_infos;
+    memory_infos.reserve(this->memory_blocks.size() + this->overlap_blocks.size());
+    for (const auto &item: this->memory_blocks) {
+        memory_infos.push_back(item.second);
+    }
+    memory_infos.insert(memory_infos.end(), this->overlap_blocks.begin(),
+                        this->overlap_blocks.end());
+    std::sort(memory_infos.begin(), memory_infos.end(), [](const auto &a, const auto &b) {
+        return a.memory_index < b.memory_index;
+    });
+    for (auto &&memory_info: memory_infos) {
         LOGI("memory block index:0x%zx size:0x%zx address:0x%zx", memory_info.memory_index,
              memory_info.end - memory_info.start, memory_info.start);
         this->write_memory_buffer(reinterpret_cast<void *>(memory_info.start),
                                   memory_info.end - memory_info.start, memory_info.memory_index);
 
     }
-    this->memory_infos.clear();
-    this->memory_dump_file.flush();
-    this->memory_dump_file.close();
+    this->memory_blocks.clear();
+    this->overlap_blocks.clear();
+    this->tracker_indices.clear();
+    this->has_last_hit = false;
+    this->snapshots.clear();
+    // closing waits for the background writer
+    this->dump_writer.reset();
 }
 
 
 bool MemoryManager::write_memory_buffer(void *addr, size_t len, size_t index) {
-    // write hexdump to file
-    if (!this->memory_dump_file.is_open()) {
+    if (this->dump_writer == nullptr) {
         return false;
     }
-    //format buffer to hexdump
-    this->memory_dump_file << "memory block index:"
-                           << fmt::format("{:#x} size:{:#x} address:{:#x}\n", index, len,
-                                          (uintptr_t) addr);
-    const HexDump hexdump(addr, len);
-    if (len == 16) {
-        std::stringstream ss;
-        ss << hexdump;
-        LOGI("memory:%s", ss.str().c_str());
-        this->memory_dump_file << ss.str();
-    } else {
-        this->memory_dump_file << hexdump;
-    }
-    this->memory_dump_file << "\n";
-    this->memory_dump_file.flush();
+    this->dump_writer->write_block(index, reinterpret_cast<uintptr_t>(addr), len);
     return true;
 }
 
 bool MemoryManager::remove_memory(const uintptr_t addr) {
-    for (auto it = this->memory_infos.begin(); it != this->memory_infos.end();) {
-        if (it->start == addr) {
-            this->write_memory_buffer(reinterpret_cast<void *>(it->start), it->end - it->start,
-                                      it->memory_index);
-            it = memory_infos.erase(it);
-            return true;
+    // the oldest block starting at addr goes, like the first match of a scan
+    auto block = this->memory_blocks.find(addr);
+    auto overlap = this->overlap_blocks.end();
+    for (auto it = this->overlap_blocks.begin(); it != this->overlap_blocks.end(); ++it) {
+        if (it->start == addr &&
+            (overlap == this->overlap_blocks.end() || it->memory_index < overlap->memory_index)) {
+            overlap = it;
         }
-        ++it;
     }
-    return false;
+    if (overlap != this->overlap_blocks.end() &&
+        (block == this->memory_blocks.end() ||
+         overlap->memory_index < block->second.memory_index)) {
+        this->write_memory_buffer(reinterpret_cast<void *>(overlap->start),
+                                  overlap->end - overlap->start, overlap->memory_index);
+        this->snapshots.erase(overlap->memory_index);
+        this->overlap_blocks.erase(overlap);
+    } else if (block != this->memory_blocks.end()) {
+        const auto &memory_info = block->second;
+        this->write_memory_buffer(reinterpret_cast<void *>(memory_info.start),
+                                  memory_info.end - memory_info.start, memory_info.memory_index);
+        this->snapshots.erase(memory_info.memory_index);
+        this->memory_blocks.erase(block);
+    } else {
+        return false;
+    }
+    this->has_last_hit = false;
+    return true;
 }
 
 bool MemoryManager::is_in_memory(uintptr_t addr) {
     if (addr == 0) {
         return false;
     }
-    auto contains = std::any_of(this->memory_infos.begin(), this->memory_infos.end(),
-                                [&](const auto &memory_info) {
-                                    if (addr >= memory_info.start && addr <= memory_info.end) {
-                                        return true;
-                                    }
-                                    return false;
-                                });
-    return contains;
+    return find_memory_info(addr) != nullptr;
 }
 
 std::tuple<size_t, uint64_t> MemoryManager::get_memory_offset(uintptr_t addr) {
-    size_t offset = -1;
-    uint64_t block_index = 0;
-    bool any_of = std::any_of(this->memory_infos.begin(), this->memory_infos.end(),
-                              [&](const auto &memory_info) {
-                                  if (addr >= memory_info.start && addr <= memory_info.end) {
-                                      offset = addr - memory_info.start;
-                                      block_index = memory_info.memory_index;
-                                      return true;
-                                  }
-                                  return false;
-                              });
-    if (any_of) {
-        return {offset, block_index};
+    auto memory_info = find_memory_info(addr);
+    if (memory_info != nullptr) {
+        return {addr - memory_info->start, memory_info->memory_index};
+    }
+    // the tracker sees every malloc, a block allocated after the gap was cached may lie inside it
+    tracked_allocation_t allocation;
+    if (AllocationTracker::getInstance()->find(addr, allocation)) {
+        // the tracker sees every free, its blocks are looked up there and never copied
+        auto [it, inserted] = this->tracker_indices.try_emplace(allocation.id, 0);
+        if (inserted) {
+            it->second = this->memory_index.fetch_add(1);
+            if (this->tracker_indices.size() > kMaxTrackerIndices) {
+                auto oldest = this->tracker_indices.begin();
+                this->tracker_indices.erase(oldest == it ? std::next(oldest) : oldest);
+            }
+        }
+        return {addr - allocation.start, it->second};
+    }
+    if (addr >= this->negative_start && addr < this->negative_end) {
+        return {-1, 0};
     }
     LOGE("addr:%zx not in memory,find memory block.", addr);
     auto already_alloc_memory_info = find_already_alloc_memory_info(addr);
     if (already_alloc_memory_info.start != 0) {
-        this->memory_infos.emplace_back(already_alloc_memory_info);
+        insert_memory_info(already_alloc_memory_info);
         return {addr - already_alloc_memory_info.start, already_alloc_memory_info.memory_index};
     }
     return {-1, 0};
 }
 
+void MemoryManager::invalidate_maps() {
+    this->memory_maps_valid = false;
+    this->memory_maps.clear();
+    this->negative_start = 0;
+    this->negative_end = 0;
+}
+
+void MemoryManager::set_snapshot_mode(memory_snapshot_mode_t mode, size_t interval) {
+    this->snapshot_mode = mode;
+    this->snapshot_interval = interval != 0 ? interval : 1;
+    this->snapshot_writes = 0;
+}
+
+void MemoryManager::on_call() {
+    if (this->snapshot_mode == kSnapshotPerCall) {
+        this->snapshot_phase++;
+    }
+}
+
+void MemoryManager::before_write(uintptr_t addr, size_t size) {
+    if (!is_snapshot_enabled() || size == 0) {
+        return;
+    }
+    // blocks found by address are only added on their first access
+    if (std::get<0>(get_memory_offset(addr)) == static_cast<size_t>(-1)) {
+        return;
+    }
+    auto memory_info = find_memory_info(addr);
+    if (memory_info == nullptr) {
+        return;
+    }
+    if (this->snapshot_mode == kSnapshotPerWrites) {
+        this->snapshot_phase = this->snapshot_writes++ / this->snapshot_interval;
+    }
+    auto block_size = memory_info->end - memory_info->start;
+    if (memory_info->start == 0 || block_size == 0 || block_size > kMaxSnapshotSize) {
+        return;
+    }
+    auto [it, inserted] = this->snapshots.try_emplace(memory_info->memory_index);
+    auto &snapshot = it->second;
+    if (inserted || snapshot.phase != this->snapshot_phase) {
+        snapshot.phase = this->snapshot_phase;
+        write_snapshot(*memory_info, snapshot);
+    }
+    auto first = (addr - memory_info->start) / kSnapshotLineSize;
+    auto last = std::min(addr - memory_info->start + size - 1, block_size - 1) / kSnapshotLineSize;
+    for (auto line = first; line <= last; ++line) {
+        snapshot.dirty[line / 64] |= 1ull << (line % 64);
+    }
+    snapshot.has_dirty = true;
+}
+
+void MemoryManager::write_snapshot(const memory_info_t &memory_info,
+                                   block_snapshot_t &snapshot) {
+    auto size = memory_info.end - memory_info.start;
+    auto &runs = this->snapshot_runs;
+    runs.clear();
+    if (snapshot.dirty.empty()) {
+        runs.push_back({0, static_cast<uint32_t>(size)});
+        auto lines = (size + kSnapshotLineSize - 1) / kSnapshotLineSize;
+        snapshot.dirty.assign((lines + 63) / 64, 0);
+    } else {
+        if (!snapshot.has_dirty) {
+            return;
+        }
+        // lines written during the last phase, the bytes are still as that phase left them
+        for (size_t word = 0; word < snapshot.dirty.size(); ++word) {
+            for (auto bits = snapshot.dirty[word]; bits != 0; bits &= bits - 1) {
+                size_t offset = (word * 64 + __builtin_ctzll(bits)) * kSnapshotLineSize;
+                auto line = std::min(kSnapshotLineSize, size - offset);
+                if (!runs.empty() && runs.back().offset + runs.back().size == offset) {
+                    runs.back().size += line;
+                } else {
+                    runs.push_back({static_cast<uint32_t>(offset), static_cast<uint32_t>(line)});
+                }
+            }
+            snapshot.dirty[word] = 0;
+        }
+        snapshot.has_dirty = false;
+    }
+    this->dump_writer->write_version(memory_info.memory_index, memory_info.start, size,
+                                     snapshot.phase, snapshot.version++, runs);
+}
+
+const QBDI::MemoryMap *MemoryManager::find_memory_map(uintptr_t addr) {
+    if (!this->memory_maps_valid) {
+        this->memory_maps = QBDI::getCurrentProcessMaps(true);
+        std::sort(this->memory_maps.begin(), this->memory_maps.end(),
+                  [](const auto &a, const auto &b) {
+                      return a.range.start() < b.range.start();
+                  });
+        this->memory_maps_valid = true;
+    }
+    auto it = std::upper_bound(this->memory_maps.begin(), this->memory_maps.end(), addr,
+                               [](uintptr_t value, const auto &map) {
+                                   return value < map.range.start();
+                               });
+    if (it == this->memory_maps.begin()) {
+        return nullptr;
+    }
+    --it;
+    // ends are inclusive, the lower mapping wins an address on the border
+    if (it != this->memory_maps.begin() && std::prev(it)->range.end() >= addr) {
+        --it;
+    }
+    return it->range.end() >= addr ? &*it : nullptr;
+}
+
 typedef struct {
     uintptr_t addr;
     uintptr_t chunk;
@@ -192,19 +376,31 @@ memory_info_t MemoryManager::find_already_alloc_memory_info(uintptr_t addr) {
         return {0, 0, 0};
     }
     malloc_chunk_t chunk{addr, 0, 0};
-    auto memory_maps = QBDI::getCurrentProcessMaps(true);
-    for (auto &memory_map: memory_maps) {
-        if (memory_map.range.start() <= addr && memory_map.range.end() >= addr) {
-            LOGI("find already alloc memory info:%zx", memory_map.range.start());
-            malloc_iterate_addr(memory_map.range.start(), memory_map.range.size(), callback,
-                                &chunk);
-            if (chunk.chunk == 0) {
-                return {this->memory_index.fetch_add(1), memory_map.range.start(),
-                        memory_map.range.end()};
-            }
-            break;
-        }
+    bool fresh_maps = !this->memory_maps_valid;
+    auto memory_map = find_memory_map(addr);
+    if (memory_map == nullptr && !fresh_maps) {
+        // the address was accessed, so it was mapped after the snapshot by a call the
+        // tracer does not see, e.g. malloc internals, another thread or the linker
+        invalidate_maps();
+        memory_map = find_memory_map(addr);
+    }
+    if (memory_map == nullptr) {
+        // not even in fresh maps, nothing is mapped between the neighbours right now
+        auto next = std::upper_bound(this->memory_maps.begin(), this->memory_maps.end(), addr,
+                                     [](uintptr_t value, const auto &map) {
+                                         return value < map.range.start();
+                                     });
+        this->negative_start = next == this->memory_maps.begin() ? 0 :
+                               std::prev(next)->range.end() + 1;
+        this->negative_end = next == this->memory_maps.end() ? UINTPTR_MAX :
+                             next->range.start();
+        return {this->memory_index.fetch_add(1), 0, 0};
+    }
+    LOGI("find already alloc memory info:%zx", memory_map->range.start());
+    malloc_iterate_addr(memory_map->range.start(), memory_map->range.size(), callback, &chunk);
+    if (chunk.chunk == 0) {
+        return {this->memory_index.fetch_add(1), memory_map->range.start(),
+                memory_map->range.end()};
     }
-
     return {this->memory_index.fetch_add(1), chunk.chunk, chunk.chunk + chunk.size};
-}
\ No newline at end of file
+}
@@ -27,10 +27,29 @@
 #define QBDI_TRACER_MEMORY_MANAGER_H
 
 #include <atomic>
-#include <fstream>
+#include <map>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 #include "common.h"
-
+#include "record/memory_dump_writer.h"
+
+typedef enum memory_snapshot_mode {
+    kSnapshotDisable,
+    // a phase ends at every traced call
+    kSnapshotPerCall,
+    // a phase ends every snapshot_interval writes to tracked blocks
+    kSnapshotPerWrites,
+} memory_snapshot_mode_t;
+
+typedef struct block_snapshot {
+    // phase of the last version, the first write of a later phase takes the next one
+    uint64_t phase = 0;
+    uint32_t version = 0;
+    // one bit per 64 byte line written since the last version
+    std::vector<uint64_t> dirty;
+    bool has_dirty = false;
+} block_snapshot_t;
 
 class MemoryManager {
 public:
@@ -38,7 +57,8 @@ public:
 
     ~MemoryManager() = default;
 
-    void set_dump_path(const std::string& path);
+    // memory_dump.bin, compressed on the background thread when compress is set
+    void set_dump_path(const std::string& path, bool compress = true);
 
     bool add_memory(uintptr_t addr, size_t size);
 
@@ -50,17 +70,72 @@ public:
 
     std::tuple<size_t, uint64_t> get_memory_offset(uintptr_t addr);
 
+    // drops the cached maps, called after a traced call changed the mappings
+    void invalidate_maps();
+
+    // versions go to the dump file next to the final contents, see kRecordMemoryVersion
+    void set_snapshot_mode(memory_snapshot_mode_t mode, size_t interval);
+
+    // a traced call ran, ends the phase in kSnapshotPerCall
+    void on_call();
+
+    /**
+     * A traced instruction is about to write size bytes at addr. The first
+     * write of a phase snapshots the block before it lands, later writes
+     * only mark their lines for the next version.
+     */
+    void before_write(uintptr_t addr, size_t size);
+
+    [[nodiscard]] bool is_snapshot_enabled() const {
+        return this->snapshot_mode != kSnapshotDisable && this->dump_writer != nullptr;
+    }
+
 private:
     memory_info_t find_already_alloc_memory_info(uintptr_t addr);
 
+    /**
+     * Block holding addr, ends are inclusive. When blocks overlap the oldest
+     * one wins, the same block a scan in insertion order would find.
+     */
+    const memory_info_t *find_memory_info(uintptr_t addr);
+
+    void insert_memory_info(const memory_info_t &memory_info);
+
+    // cached mapping holding addr, maps are only parsed again after invalidate_maps
+    const QBDI::MemoryMap *find_memory_map(uintptr_t addr);
+
 
     bool write_memory_buffer(void* addr, size_t len, size_t index);
 
+    void write_snapshot(const memory_info_t &memory_info, block_snapshot_t &snapshot);
+
 private:
-    std::ofstream memory_dump_file;
+    std::unique_ptr<MemoryDumpWriter> dump_writer;
     std::atomic_uint64_t memory_index = 0;
     std::string dump_path;
-    std::vector<memory_info_t> memory_infos;
+    // disjoint blocks by start address
+    std::map<uintptr_t, memory_info_t> memory_blocks;
+    // blocks overlapping one of memory_blocks, rare enough to scan
+    std::vector<memory_info_t> overlap_blocks;
+    // result of the last lookup, only reused while all blocks are disjoint
+    memory_info_t last_hit{};
+    bool has_last_hit = false;
+    // /proc/self/maps sorted by start, valid until a call changes the mappings
+    std::vector<QBDI::MemoryMap> memory_maps;
+    bool memory_maps_valid = false;
+    // AllocationTracker block id to the memory_index its accesses are reported with,
+    // ids grow with each allocation so the first entry is the oldest block
+    std::map<uint64_t, uint64_t> tracker_indices;
+    // last address range known to hold no block, misses inside it skip the lookup
+    uintptr_t negative_start = 0;
+    uintptr_t negative_end = 0;
+    memory_snapshot_mode_t snapshot_mode = kSnapshotDisable;
+    size_t snapshot_interval = 0;
+    uint64_t snapshot_phase = 0;
+    uint64_t snapshot_writes = 0;
+    // by memory_index, dropped with the block
+    std::unordered_map<uint64_t, block_snapshot_t> snapshots;
+    std::vector<trace_memory_run_t> snapshot_runs;
     DISALLOW_COPY_AND_ASSIGN(MemoryManager);
 };
 
@@ -0,0 +1,144 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2024 g2wfw
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_CALL_ARG_FORMAT_H
+#define QBDI_TRACER_CALL_ARG_FORMAT_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include "trace_format.h"
+
+/*
+ * Renders the raw call arguments the dispatchers capture. The tracer uses it
+ * for the text log, the host tools for binary traces, so both print the
+ * same line. Only std, like trace_format.h.
+ */
+
+static inline void append_call_arg_hex(std::string &out, uint64_t value) {
+    static const char digits[] = "0123456789abcdef";
+    char buffer[16];
+    size_t count = 0;
+    do {
+        buffer[count++] = digits[value & 0xf];
+        value >>= 4;
+    } while (value != 0);
+    out.append("0x");
+    while (count > 0) {
+        out.push_back(buffer[--count]);
+    }
+}
+
+// 16 bytes a line: address, hex bytes, printable characters
+static inline void append_call_arg_hexdump(std::string &out, uint64_t address, const uint8_t *data,
+                                           size_t size) {
+    static const char digits[] = "0123456789ABCDEF";
+    for (size_t i = 0; i < size; i += 16) {
+        append_call_arg_hex(out, address + i);
+        out.append(": ");
+        for (size_t j = 0; j < 16; ++j) {
+            if (i + j < size) {
+                out.push_back(digits[data[i + j] >> 4]);
+                out.push_back(digits[data[i + j] & 0xf]);
+                out.push_back(' ');
+            } else {
+                out.append("   ");
+            }
+        }
+        out.append(" |");
+        for (size_t j = 0; j < 16 && i + j < size; ++j) {
+            char c = static_cast<char>(data[i + j]);
+            out.push_back(c >= 32 && c <= 126 ? c : '.');
+        }
+        out.append("| \t");
+    }
+}
+
+// short enough to read back as the same value, jfloat arguments arrive widened to double
+static inline void append_call_arg_double(std::string &out, uint64_t bits) {
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    char buffer[32];
+    auto narrow = static_cast<float>(value);
+    int length;
+    if (static_cast<double>(narrow) == value) {
+        length = snprintf(buffer, sizeof(buffer), "%.7g", value);
+        if (strtof(buffer, nullptr) != narrow) {
+            length = snprintf(buffer, sizeof(buffer), "%.9g", value);
+        }
+    } else {
+        length = snprintf(buffer, sizeof(buffer), "%.15g", value);
+        if (strtod(buffer, nullptr) != value) {
+            length = snprintf(buffer, sizeof(buffer), "%.17g", value);
+        }
+    }
+    out.append(buffer, static_cast<size_t>(length));
+}
+
+static inline void append_call_arg(std::string &out, std::string_view name, uint8_t kind,
+                                   uint64_t value, const uint8_t *data, size_t size) {
+    out.append(name);
+    out.push_back('=');
+    switch (kind) {
+        case kCallArgUnsigned:
+            out.append(std::to_string(value));
+            break;
+        case kCallArgSigned:
+            out.append(std::to_string(static_cast<int64_t>(value)));
+            break;
+        case kCallArgString:
+            out.append(reinterpret_cast<const char *>(data), size);
+            break;
+        case kCallArgQuoted:
+            out.push_back('"');
+            out.append(reinterpret_cast<const char *>(data), size);
+            out.push_back('"');
+            break;
+        case kCallArgLabeled:
+            out.append(reinterpret_cast<const char *>(data), size);
+            out.push_back(' ');
+            append_call_arg_hex(out, value);
+            break;
+        case kCallArgDouble:
+            append_call_arg_double(out, value);
+            break;
+        case kCallArgHexdump:
+            append_call_arg_hex(out, value);
+            if (size != 0) {
+                out.push_back('\n');
+                append_call_arg_hexdump(out, value, data, size);
+            }
+            break;
+        default:
+            append_call_arg_hex(out, value);
+            break;
+    }
+}
+
+
+#endif //QBDI_TRACER_CALL_ARG_FORMAT_H
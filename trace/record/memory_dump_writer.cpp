@@ -0,0 +1,230 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include "memory_dump_writer.h"
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+#include <sys/time.h>
+#include <android/log.h>
+
+#define LOG_TAG "QBDI"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#define LOGD(...) __android_log_print(ANDROID_LOG_DEBUG, LOG_TAG, __VA_ARGS__)
+
+// records larger than this do not fit the uint32_t sizes of the format
+static constexpr uint64_t kMaxBlobSize = UINT32_MAX - 4096;
+
+static uint64_t get_timestamp_ms() {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return (tv.tv_sec * 1000ull) + (tv.tv_usec / 1000);
+}
+
+static constexpr uint64_t kBlobSeed = 0x9e3779b97f4a7c15ull;
+static constexpr uint64_t kBlobCheckSeed = 0xc2b2ae3d27d4eb4full;
+
+// word at a time multiply-xorshift, only has to tell dumps apart
+static uint64_t hash_bytes(const uint8_t *data, size_t size, uint64_t seed) {
+    uint64_t hash = seed ^ size;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * 0xff51afd7ed558ccdull;
+        hash ^= hash >> 32;
+    }
+    for (; i < size; ++i) {
+        hash = (hash ^ data[i]) * 0x100000001b3ull;
+    }
+    hash ^= hash >> 29;
+    return hash;
+}
+
+MemoryDumpWriter::MemoryDumpWriter(std::shared_ptr<TraceOutput> output, size_t chunk_size)
+        : output(std::move(output)), chunk_size(chunk_size) {
+    file_header.memory_enable = true;
+    file_header.is_64bit = sizeof(void *) == 8;
+    file_header.flags = kTraceMemoryDump;
+    file_header.inst_offset = sizeof(serialize_file_t);
+    if (!this->output->write_header(file_header)) {
+        LOGE("write memory dump header failed");
+    }
+    chunk.reserve(chunk_size + 4096);
+}
+
+MemoryDumpWriter::~MemoryDumpWriter() {
+    seal_chunk();
+    output->close(file_header);
+}
+
+uint8_t *MemoryDumpWriter::begin_record(trace_record_type_t type, uint64_t size) {
+    size = trace_align8(size + sizeof(trace_record_header_t));
+    size_t offset = chunk.size();
+    chunk.resize(offset + size);
+    auto record = chunk.data() + offset;
+    trace_record_header_t header{};
+    header.type = type;
+    header.size = size;
+    memcpy(record, &header, sizeof(header));
+    chunk_record_count++;
+    return record + sizeof(trace_record_header_t);
+}
+
+void MemoryDumpWriter::write_block(uint64_t block_index, uintptr_t address, size_t size) {
+    if (size > kMaxBlobSize) {
+        LOGW("memory block 0x%llx of 0x%zx bytes is too large to dump",
+             static_cast<unsigned long long>(block_index), size);
+        return;
+    }
+    if (has_dropped.load(std::memory_order_acquire)) {
+        forget_dropped_blobs();
+    }
+    auto bytes = reinterpret_cast<const uint8_t *>(address);
+    uint64_t hash = hash_bytes(bytes, size, kBlobSeed);
+    uint64_t check = hash_bytes(bytes, size, kBlobCheckSeed);
+    // the bytes are gone once written, a key taken by other contents moves on to the next one
+    auto [it, inserted] = blobs.try_emplace(hash, blob_entry_t{size, check, 0});
+    while (!inserted && (it->second.size != size || it->second.check != check)) {
+        std::tie(it, inserted) = blobs.try_emplace(++hash, blob_entry_t{size, check, 0});
+    }
+    if (inserted) {
+        // a large blob goes out in a chunk of its own
+        if (!chunk.empty() && chunk.size() + size > chunk_size) {
+            seal_chunk();
+        }
+        auto cursor = begin_record(kRecordMemoryBlob, sizeof(trace_memory_blob_record_t) + size);
+        trace_memory_blob_record_t blob{};
+        blob.hash = hash;
+        blob.size = size;
+        memcpy(cursor, &blob, sizeof(blob));
+        memcpy(cursor + sizeof(blob), bytes, size);
+        chunk_blobs.push_back(hash);
+    }
+    auto cursor = begin_record(kRecordMemoryBlock, sizeof(trace_memory_block_record_t));
+    trace_memory_block_record_t block{};
+    block.block_index = block_index;
+    block.address = address;
+    block.hash = hash;
+    block.size = size;
+    memcpy(cursor, &block, sizeof(block));
+    block_count++;
+    if (chunk.size() >= chunk_size) {
+        seal_chunk();
+    }
+}
+
+void MemoryDumpWriter::write_version(uint64_t block_index, uintptr_t address, size_t size,
+                                     uint64_t phase, uint32_t version,
+                                     const std::vector<trace_memory_run_t> &runs) {
+    uint64_t bytes_size = 0;
+    for (const auto &run: runs) {
+        bytes_size += run.size;
+    }
+    uint64_t body_size = sizeof(trace_memory_version_record_t) +
+                         runs.size() * sizeof(trace_memory_run_t) + bytes_size;
+    if (body_size > kMaxBlobSize) {
+        LOGW("memory block 0x%llx version %u is too large to dump",
+             static_cast<unsigned long long>(block_index), version);
+        return;
+    }
+    if (!chunk.empty() && chunk.size() + body_size > chunk_size) {
+        seal_chunk();
+    }
+    auto cursor = begin_record(kRecordMemoryVersion, body_size);
+    trace_memory_version_record_t record{};
+    record.block_index = block_index;
+    record.address = address;
+    record.size = size;
+    record.phase = phase;
+    record.version = version;
+    record.run_count = runs.size();
+    memcpy(cursor, &record, sizeof(record));
+    cursor += sizeof(record);
+    memcpy(cursor, runs.data(), runs.size() * sizeof(trace_memory_run_t));
+    cursor += runs.size() * sizeof(trace_memory_run_t);
+    for (const auto &run: runs) {
+        memcpy(cursor, reinterpret_cast<const uint8_t *>(address) + run.offset, run.size);
+        cursor += run.size;
+    }
+    if (chunk.size() >= chunk_size) {
+        seal_chunk();
+    }
+}
+
+void MemoryDumpWriter::seal_chunk() {
+    if (chunk.empty()) {
+        return;
+    }
+    trace_chunk_header_t header{};
+    header.stored_size = chunk.size();
+    header.raw_size = chunk.size();
+    header.first_index = block_count;
+    header.record_count = chunk_record_count;
+    header.timestamp_ms = get_timestamp_ms();
+    if (!output->write_chunk(header, chunk.data())) {
+        LOGW("memory dump output dropped %u records", chunk_record_count);
+        // later blocks with the same contents have to carry the bytes again
+        for (auto hash: chunk_blobs) {
+            blobs.erase(hash);
+        }
+    } else {
+        for (auto hash: chunk_blobs) {
+            blobs[hash].chunk = header.first_index;
+        }
+    }
+    chunk.clear();
+    chunk_blobs.clear();
+    chunk_record_count = 0;
+}
+
+void MemoryDumpWriter::on_chunk_dropped(const trace_chunk_header_t &header) {
+    std::lock_guard<std::mutex> lock(dropped_mutex);
+    dropped_chunks.push_back(header.first_index);
+    has_dropped.store(true, std::memory_order_release);
+}
+
+void MemoryDumpWriter::forget_dropped_blobs() {
+    std::vector<uint64_t> dropped;
+    {
+        std::lock_guard<std::mutex> lock(dropped_mutex);
+        dropped.swap(dropped_chunks);
+        has_dropped.store(false, std::memory_order_relaxed);
+    }
+    LOGW("memory dump output dropped %zu chunks", dropped.size());
+    // rare, a scan of the blobs is cheaper than an index kept for every chunk
+    for (auto it = blobs.begin(); it != blobs.end();) {
+        if (std::find(dropped.begin(), dropped.end(), it->second.chunk) != dropped.end()) {
+            it = blobs.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void MemoryDumpWriter::flush() {
+    seal_chunk();
+    output->flush();
+}
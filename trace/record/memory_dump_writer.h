@@ -0,0 +1,106 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_MEMORY_DUMP_WRITER_H
+#define QBDI_TRACER_MEMORY_DUMP_WRITER_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <core/stl_macro.h>
+#include "../sink/trace_output.h"
+#include "trace_format.h"
+
+/**
+ * Writes tracked memory blocks to memory_dump.bin as raw bytes, see
+ * kRecordMemoryBlob. Identical contents are stored once, keyed by a hash of
+ * the bytes; size and a second hash have to match as well before a key is
+ * shared. The traced thread only hashes and copies, the
+ * output is meant to be an AsyncTraceOutput doing compression and I/O;
+ * itrace-memdump renders the old text hexdump offline.
+ */
+class MemoryDumpWriter {
+public:
+    static constexpr size_t kDefaultChunkSize = 256 * 1024;
+
+    explicit MemoryDumpWriter(std::shared_ptr<TraceOutput> output,
+                              size_t chunk_size = kDefaultChunkSize);
+
+    ~MemoryDumpWriter();
+
+    void write_block(uint64_t block_index, uintptr_t address, size_t size);
+
+    // runs are read from the live block at address, see kRecordMemoryVersion
+    void write_version(uint64_t block_index, uintptr_t address, size_t size, uint64_t phase,
+                       uint32_t version, const std::vector<trace_memory_run_t> &runs);
+
+    void flush();
+
+    /**
+     * A chunk the output accepted and failed to write later, AsyncTraceOutput
+     * reports them from its worker. Its blobs are forgotten before the next
+     * block, so their contents are carried again.
+     */
+    void on_chunk_dropped(const trace_chunk_header_t &header);
+
+private:
+    uint8_t *begin_record(trace_record_type_t type, uint64_t size);
+
+    void seal_chunk();
+
+    void forget_dropped_blobs();
+
+    DISALLOW_COPY_AND_ASSIGN(MemoryDumpWriter);
+
+private:
+    std::shared_ptr<TraceOutput> output;
+    serialize_file_t file_header;
+    size_t chunk_size;
+    std::vector<uint8_t> chunk;
+    uint32_t chunk_record_count = 0;
+    uint64_t block_count = 0;
+    typedef struct blob_entry {
+        uint64_t size;
+        // second hash of the bytes with another seed, tells a collision from a duplicate
+        uint64_t check;
+        // first_index of the chunk the bytes went out in
+        uint64_t chunk;
+    } blob_entry_t;
+
+    // key of every blob written
+    std::unordered_map<uint64_t, blob_entry_t> blobs;
+    // blobs of the open chunk, forgotten again when the output drops it
+    std::vector<uint64_t> chunk_blobs;
+    // first_index of chunks dropped by the output after it accepted them
+    std::mutex dropped_mutex;
+    std::vector<uint64_t> dropped_chunks;
+    std::atomic<bool> has_dropped{false};
+};
+
+
+#endif //QBDI_TRACER_MEMORY_DUMP_WRITER_H
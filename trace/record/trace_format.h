@@ -0,0 +1,380 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_TRACE_FORMAT_H
+#define QBDI_TRACER_TRACE_FORMAT_H
+
+#include <cstdint>
+
+/*
+ * Binary trace stream, shared by the tracer and the host tools, so nothing in
+ * here may depend on QBDI or Android headers.
+ *
+ *   serialize_file_t
+ *   chunk: trace_chunk_header_t + payload
+ *   chunk: ...
+ *
+ * A chunk payload is a sequence of records, each starting with a
+ * trace_record_header_t. Every chunk repeats the instruction descriptors its
+ * records use, so chunks can be decoded independently of each other.
+ * All values are little endian.
+ */
+
+static constexpr uint32_t kTraceMagic = 0xDEADBEEF;
+static constexpr uint32_t kTraceVersion = 0x00000002;
+// "ITCK"
+static constexpr uint32_t kTraceChunkMagic = 0x4B435449;
+
+typedef struct serialize_file {
+    uint32_t magic = kTraceMagic;
+    uint32_t version = kTraceVersion;
+    uint32_t check_sum = 0;
+    bool memory_enable = false;
+    bool is_64bit = false;
+    // trace_file_flag_t
+    uint16_t flags = 0;
+
+    // filled in when the stream is closed, 0 when unknown
+    uint64_t inst_count = 0;
+    // offset of the first chunk
+    uint64_t inst_offset = 0;
+
+    uint64_t module_base = 0;
+    uint64_t module_end = 0;
+
+    char module_name[64] = {};
+} serialize_file_t;
+
+static_assert(sizeof(serialize_file_t) == 112, "serialize_file_t layout changed");
+
+typedef enum trace_file_flag {
+    // chunks carry kRecordFlow instead of kRecordInst, see trace_flow_record_t
+    kTraceBranchOnly = 1 << 0,
+    // memory_dump.bin, chunks carry kRecordMemoryBlob / Block / Version only
+    kTraceMemoryDump = 1 << 1,
+    // written by itrace-expand, instructions carry no operands, registers are only known at keyframes
+    kTraceExpanded = 1 << 2,
+} trace_file_flag_t;
+
+typedef enum trace_chunk_flag {
+    // payload is a zlib stream of raw_size bytes once inflated
+    kChunkCompressed = 1 << 0,
+} trace_chunk_flag_t;
+
+typedef struct trace_chunk_header {
+    uint32_t magic = kTraceChunkMagic;
+    uint16_t flags = 0;
+    uint16_t header_size = sizeof(trace_chunk_header);
+    // payload bytes following the header
+    uint32_t stored_size = 0;
+    // payload bytes once decoded
+    uint32_t raw_size = 0;
+    // sequence number of the first instruction record in the chunk
+    uint64_t first_index = 0;
+    uint32_t inst_count = 0;
+    uint32_t record_count = 0;
+    // wall clock time the chunk was sealed
+    uint64_t timestamp_ms = 0;
+} trace_chunk_header_t;
+
+static_assert(sizeof(trace_chunk_header_t) == 40, "trace_chunk_header_t layout changed");
+
+typedef enum trace_record_type {
+    kRecordInstDesc = 1,
+    kRecordInst = 2,
+    kRecordCall = 3,
+    kRecordKeyframe = 4,
+    kRecordModuleImage = 5,
+    kRecordFlow = 6,
+    kRecordMemoryBlob = 7,
+    kRecordMemoryBlock = 8,
+    kRecordMemoryVersion = 9,
+} trace_record_type_t;
+
+typedef struct trace_record_header {
+    uint8_t type;
+    uint8_t flags;
+    uint16_t reserved;
+    // record size including this header, always a multiple of 8
+    uint32_t size;
+} trace_record_header_t;
+
+typedef enum trace_inst_flag {
+    kInstBranch = 1 << 0,
+    kInstCall = 1 << 1,
+    kInstReturn = 1 << 2,
+    kInstCompare = 1 << 3,
+    kInstPredicable = 1 << 4,
+    kInstMayLoad = 1 << 5,
+    kInstMayStore = 1 << 6,
+} trace_inst_flag_t;
+
+/**
+ * kRecordInstDesc, emitted the first time a pc is seen in a chunk:
+ *   trace_inst_desc_t
+ *   trace_operand_desc_t[operand_count]
+ *   mnemonic[mnemonic_size] disassembly[disassembly_size]
+ */
+typedef struct trace_inst_desc {
+    uint32_t desc_id;
+    uint32_t inst_size;
+    uint64_t address;
+    uint16_t flags;
+    uint8_t operand_count;
+    uint8_t mnemonic_size;
+    uint16_t disassembly_size;
+    uint16_t reserved;
+} trace_inst_desc_t;
+
+typedef enum trace_operand_kind {
+    kOperandGpr = 1,
+    kOperandFpr = 2,
+} trace_operand_kind_t;
+
+typedef enum trace_operand_flag {
+    kOperandRead = 1 << 0,
+    kOperandWrite = 1 << 1,
+    // the value before the instruction is stored in front of the value after it
+    kOperandPreValue = 1 << 2,
+} trace_operand_flag_t;
+
+typedef enum trace_value_format {
+    kValueHex = 0,
+    kValueFloat = 1,
+    kValueDouble = 2,
+} trace_value_format_t;
+
+typedef struct trace_operand_desc {
+    uint8_t kind;
+    uint8_t flags;
+    // bytes stored for each value
+    uint8_t size;
+    uint8_t format;
+    // byte offset of the register inside GPRState / FPRState
+    uint16_t state_offset;
+    char name[10];
+} trace_operand_desc_t;
+
+static_assert(sizeof(trace_operand_desc_t) == 16, "trace_operand_desc_t layout changed");
+
+typedef enum trace_access_type {
+    kAccessRead = 1,
+    kAccessWrite = 2,
+} trace_access_type_t;
+
+typedef enum trace_access_flag {
+    kAccessInModule = 1 << 0,
+} trace_access_flag_t;
+
+typedef struct trace_memory_access {
+    uint64_t address;
+    uint64_t value;
+    // MemoryManager block the address belongs to, unused for module addresses
+    uint64_t block_index;
+    uint64_t block_offset;
+    uint16_t size;
+    uint8_t type;
+    uint8_t flags;
+    uint32_t reserved;
+} trace_memory_access_t;
+
+static_assert(sizeof(trace_memory_access_t) == 40, "trace_memory_access_t layout changed");
+
+/**
+ * kRecordInst, one per traced instruction:
+ *   trace_inst_record_t
+ *   operand values, in descriptor order, sized by the descriptor
+ *   padding to 8 bytes
+ *   trace_memory_access_t[access_count]
+ */
+typedef struct trace_inst_record {
+    uint32_t desc_id;
+    uint16_t access_count;
+    uint16_t values_size;
+} trace_inst_record_t;
+
+/**
+ * kRecordCall, follows the kRecordInst of the calling instruction:
+ *   trace_call_record_t
+ *   call_module_name, fun_name, ret_value, args[arg_count]
+ *   raw args[raw_arg_count], each: name, uint8_t kind, uint64_t value, data
+ * every string is stored as uint16_t size followed by the bytes, data is the
+ * bytes copied at call time. args are rendered by the tracer, raw args are
+ * rendered by the reader, see append_call_arg.
+ */
+typedef struct trace_call_record {
+    uint64_t fun_address;
+    uint8_t ret_type;
+    uint8_t is_svc;
+    uint16_t arg_count;
+    uint16_t raw_arg_count;
+    uint16_t reserved;
+} trace_call_record_t;
+
+typedef enum trace_call_arg_kind {
+    // name=0x1f
+    kCallArgHex = 0,
+    // name=31
+    kCallArgUnsigned = 1,
+    // name=-1
+    kCallArgSigned = 2,
+    // name=<data>
+    kCallArgString = 3,
+    // name="<data>"
+    kCallArgQuoted = 4,
+    // name=<value as hex>, then a hexdump of data at that address
+    kCallArgHexdump = 5,
+    // name=<data> 0x1f, a handle and what the tracer knew about it
+    kCallArgLabeled = 6,
+    // name=1.5, value holds the bits of a double
+    kCallArgDouble = 7,
+} trace_call_arg_kind_t;
+
+// most bytes a raw arg carries, the size is written as a u16, see ArgCapture for the caps
+static constexpr uint32_t kMaxCallArgData = UINT16_MAX;
+
+/**
+ * kRecordKeyframe, precedes the kRecordInst it belongs to:
+ *   trace_keyframe_record_t
+ *   GPRState, gpr_size bytes
+ *   FPRState, fpr_size bytes
+ * the complete register state before that instruction ran, so a reader can
+ * rebuild all registers at any instruction by replaying from the closest
+ * keyframe. Written as the first instruction of every chunk, every keyframe
+ * interval instructions and after a call left the traced module. Branch only
+ * chunks open with one too, ahead of their kRecordFlow, and carry no other.
+ */
+typedef struct trace_keyframe_record {
+    // number of the instruction the state belongs to
+    uint64_t inst_index;
+    uint16_t gpr_size;
+    uint16_t fpr_size;
+    uint32_t reserved;
+} trace_keyframe_record_t;
+
+/**
+ * kRecordModuleImage, executable bytes of the traced module:
+ *   trace_module_image_record_t
+ *   bytes[size]
+ * Branch only traces open every output with these, in chunks without
+ * instructions, so the reader can walk the code the flow records point into.
+ */
+typedef struct trace_module_image_record {
+    // offset of the bytes from module_base
+    uint64_t offset;
+    uint32_t size;
+    uint32_t reserved;
+} trace_module_image_record_t;
+
+/**
+ * kRecordFlow, the only instruction record of a branch only chunk:
+ *   trace_flow_record_t
+ *   events, event_size bytes
+ * Instructions run one after the other from start_offset unless an event
+ * says otherwise. Every event starts with varint (skip << 2 | kind): skip
+ * instructions are stepped over first, the event then belongs to the
+ * instruction reached. Several events of one instruction use skip 0.
+ *   kFlowJump  varint zigzag(target - pc) << 1 | thumb, the next instruction
+ *              does not follow this one
+ *   kFlowRead  varint size, address, value of a read outside the module
+ *   kFlowSvc   varint value of the return register after the svc
+ * The jump of an instruction is always its last event.
+ */
+typedef enum trace_flow_event {
+    kFlowJump = 0,
+    kFlowRead = 1,
+    kFlowSvc = 2,
+} trace_flow_event_t;
+
+typedef struct trace_flow_record {
+    // offset of the first instruction from module_base
+    uint64_t start_offset;
+    uint32_t inst_count;
+    uint32_t event_size;
+    // the first instruction runs in thumb state
+    uint8_t thumb;
+    uint8_t reserved[7];
+} trace_flow_record_t;
+
+static_assert(sizeof(trace_flow_record_t) == 24, "trace_flow_record_t layout changed");
+
+/**
+ * kRecordMemoryBlob, bytes of a dumped memory block:
+ *   trace_memory_blob_record_t
+ *   bytes[size]
+ * Written once per distinct content, every kRecordMemoryBlock with the same
+ * hash refers to it, which may sit in an earlier chunk. The hash is a key
+ * chosen by the writer: usually the hash of the bytes, the next free value
+ * when other contents already took it.
+ */
+typedef struct trace_memory_blob_record {
+    uint64_t hash;
+    uint64_t size;
+} trace_memory_blob_record_t;
+
+/**
+ * kRecordMemoryBlock, a tracked block dumped when it was freed or at flush,
+ * block_index matches trace_memory_access_t.block_index of the trace.
+ */
+typedef struct trace_memory_block_record {
+    uint64_t block_index;
+    uint64_t address;
+    uint64_t hash;
+    uint64_t size;
+} trace_memory_block_record_t;
+
+/**
+ * kRecordMemoryVersion, a tracked block right before a traced write first
+ * touched it in a new phase (a call, or a batch of writes):
+ *   trace_memory_version_record_t
+ *   trace_memory_run_t[run_count]
+ *   bytes of every run, one after another
+ * Version 0 carries the whole block, every later one only the cache lines
+ * written since the previous version of the same block_index. A version
+ * number that skips means a chunk in between was dropped.
+ */
+typedef struct trace_memory_version_record {
+    uint64_t block_index;
+    uint64_t address;
+    uint64_t size;
+    uint64_t phase;
+    uint32_t version;
+    uint32_t run_count;
+} trace_memory_version_record_t;
+
+static_assert(sizeof(trace_memory_version_record_t) == 40,
+              "trace_memory_version_record_t layout changed");
+
+typedef struct trace_memory_run {
+    // offset into the block
+    uint32_t offset;
+    uint32_t size;
+} trace_memory_run_t;
+
+static inline uint32_t trace_align8(uint32_t size) {
+    return (size + 7u) & ~7u;
+}
+
+#endif //QBDI_TRACER_TRACE_FORMAT_H
@@ -0,0 +1,581 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "trace_record_writer.h"
+#include <algorithm>
+#include <cstring>
+#include <libgen.h>
+#include <sys/time.h>
+
+#define LOG_TAG "QBDI"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#define LOGD(...) __android_log_print(ANDROID_LOG_DEBUG, LOG_TAG, __VA_ARGS__)
+
+static uint64_t get_timestamp_ms() {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return (tv.tv_sec * 1000ull) + (tv.tv_usec / 1000);
+}
+
+static inline std::string trim(const char *str) {
+    if (str == nullptr) {
+        return "";
+    }
+    std::string result(str);
+    size_t start = result.find_first_not_of(" \t\n\r\f\v");
+    if (start == std::string::npos) {
+        return "";
+    }
+    size_t end = result.find_last_not_of(" \t\n\r\f\v");
+    return result.substr(start, end - start + 1);
+}
+
+static inline uint16_t get_inst_flags(const QBDI::InstAnalysis *inst) {
+    uint16_t flags = 0;
+    if (inst->isBranch) {
+        flags |= kInstBranch;
+    }
+    if (inst->isCall) {
+        flags |= kInstCall;
+    }
+    if (inst->isReturn) {
+        flags |= kInstReturn;
+    }
+    if (inst->isCompare) {
+        flags |= kInstCompare;
+    }
+    if (inst->isPredicable) {
+        flags |= kInstPredicable;
+    }
+    if (inst->mayLoad) {
+        flags |= kInstMayLoad;
+    }
+    if (inst->mayStore) {
+        flags |= kInstMayStore;
+    }
+    return flags;
+}
+
+/**
+ * Mirrors LoggerManager::format_register_info: decides which operands are
+ * recorded, where their value lives in the vm state and how it is rendered.
+ */
+static bool get_operand_desc(const QBDI::OperandAnalysis &operand, trace_operand_desc_t &desc) {
+    if (operand.regName == nullptr || operand.regCtxIdx < 0) {
+        return false;
+    }
+    if (operand.regAccess != QBDI::REGISTER_READ && operand.regAccess != QBDI::REGISTER_WRITE &&
+        operand.regAccess != QBDI::REGISTER_READ_WRITE) {
+        return false;
+    }
+    memset(&desc, 0, sizeof(desc));
+    bool is_read = operand.regAccess == QBDI::REGISTER_READ ||
+                   operand.regAccess == QBDI::REGISTER_READ_WRITE;
+    if (is_read) {
+        desc.flags |= kOperandRead;
+    }
+    if (operand.regAccess != QBDI::REGISTER_READ) {
+        desc.flags |= kOperandWrite;
+    }
+    size_t state_size;
+    if (operand.type == QBDI::OPERAND_FPR) {
+        desc.kind = kOperandFpr;
+        state_size = sizeof(QBDI::FPRState);
+#ifdef __arm__
+        switch (operand.size) {
+            case 4:
+                desc.format = kValueFloat;
+                break;
+            case 8:
+                desc.format = kValueDouble;
+                break;
+            case 16:
+                desc.format = kValueHex;
+                break;
+            default:
+                return false;
+        }
+        desc.size = operand.size;
+        desc.state_offset = operand.regCtxIdx * operand.size;
+#else
+        switch (operand.regName[0]) {
+            case 'B':
+                desc.size = 1;
+                break;
+            case 'H':
+                desc.size = 2;
+                break;
+            case 'S':
+                desc.size = 4;
+                break;
+            case 'D':
+                desc.size = 8;
+                break;
+            default:
+                desc.size = 16;
+                break;
+        }
+        desc.format = kValueHex;
+        desc.state_offset = (operand.regCtxIdx / desc.size) * desc.size;
+#endif
+        if (is_read) {
+            desc.flags |= kOperandPreValue;
+        }
+    } else if (operand.type == QBDI::OPERAND_GPR) {
+        desc.kind = kOperandGpr;
+        desc.size = sizeof(QBDI::rword);
+        desc.format = kValueHex;
+        desc.state_offset = operand.regCtxIdx * sizeof(QBDI::rword);
+        state_size = sizeof(QBDI::GPRState);
+#ifndef __arm__
+        // the arm text format only prints the value after the instruction
+        if (is_read) {
+            desc.flags |= kOperandPreValue;
+        }
+#endif
+    } else {
+        return false;
+    }
+    if (desc.state_offset + desc.size > state_size) {
+        return false;
+    }
+    strncpy(desc.name, operand.regName, sizeof(desc.name) - 1);
+    return true;
+}
+
+static inline const uint8_t *get_state_value(const trace_vm_status_t &status,
+                                             const trace_operand_desc_t &desc) {
+    if (desc.kind == kOperandGpr) {
+        return reinterpret_cast<const uint8_t *>(&status.gpr_state) + desc.state_offset;
+    }
+    return reinterpret_cast<const uint8_t *>(&status.fpr_state) + desc.state_offset;
+}
+
+static inline void write_string(uint8_t *&cursor, const std::string &str) {
+    uint16_t size = static_cast<uint16_t>(std::min<size_t>(str.size(), UINT16_MAX));
+    memcpy(cursor, &size, sizeof(size));
+    memcpy(cursor + sizeof(size), str.data(), size);
+    cursor += sizeof(size) + size;
+}
+
+static inline uint32_t get_string_size(const std::string &str) {
+    return sizeof(uint16_t) + static_cast<uint32_t>(std::min<size_t>(str.size(), UINT16_MAX));
+}
+
+static inline void write_string(uint8_t *&cursor, const char *str) {
+    uint16_t size = static_cast<uint16_t>(strnlen(str, UINT16_MAX));
+    memcpy(cursor, &size, sizeof(size));
+    memcpy(cursor + sizeof(size), str, size);
+    cursor += sizeof(size) + size;
+}
+
+static inline uint32_t get_string_size(const char *str) {
+    return sizeof(uint16_t) + static_cast<uint32_t>(strnlen(str, UINT16_MAX));
+}
+
+static inline void put_varint(std::vector<uint8_t> &out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+static inline uint64_t zigzag(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+// module image records are cut into pieces of this size
+static constexpr uint32_t kModuleImagePiece = 64 * 1024;
+
+TraceRecordWriter::TraceRecordWriter(const std::string &module_name, module_range_t module_range,
+                                     size_t chunk_size) : chunk_size(chunk_size) {
+    file_header.memory_enable = true;
+    file_header.is_64bit = sizeof(void *) == 8;
+    file_header.inst_offset = sizeof(serialize_file_t);
+    file_header.module_base = module_range.base;
+    file_header.module_end = module_range.end;
+    strncpy(file_header.module_name, basename(const_cast<char *>(module_name.c_str())),
+            sizeof(file_header.module_name) - 1);
+    chunk.reserve(chunk_size + 4096);
+}
+
+TraceRecordWriter::~TraceRecordWriter() {
+    seal_chunk();
+    file_header.inst_count = inst_index;
+    for (auto &output: outputs) {
+        output->close(file_header);
+    }
+}
+
+void TraceRecordWriter::add_output(const std::shared_ptr<TraceOutput> &output) {
+    if (output == nullptr) {
+        return;
+    }
+    if (std::find(outputs.begin(), outputs.end(), output) != outputs.end()) {
+        return;
+    }
+    // everything written so far goes to the existing outputs only
+    seal_chunk();
+    if (!output->write_header(file_header)) {
+        LOGE("write trace header failed");
+        return;
+    }
+    if (branch_only) {
+        write_module_image(output);
+    }
+    outputs.push_back(output);
+}
+
+void TraceRecordWriter::set_branch_only(bool enable) {
+    if (!outputs.empty()) {
+        LOGW("branch only mode can not change while outputs are attached");
+        return;
+    }
+    branch_only = enable;
+    if (enable) {
+        file_header.flags |= kTraceBranchOnly;
+    } else {
+        file_header.flags &= ~kTraceBranchOnly;
+    }
+}
+
+void TraceRecordWriter::remove_output(const std::shared_ptr<TraceOutput> &output) {
+    auto it = std::find(outputs.begin(), outputs.end(), output);
+    if (it == outputs.end()) {
+        return;
+    }
+    seal_chunk();
+    file_header.inst_count = inst_index;
+    output->close(file_header);
+    outputs.erase(it);
+}
+
+uint8_t *TraceRecordWriter::begin_record(trace_record_type_t type, uint32_t size) {
+    size = trace_align8(size + sizeof(trace_record_header_t));
+    size_t offset = chunk.size();
+    chunk.resize(offset + size);
+    auto record = chunk.data() + offset;
+    trace_record_header_t header{};
+    header.type = type;
+    header.size = size;
+    memcpy(record, &header, sizeof(header));
+    chunk_record_count++;
+    return record + sizeof(trace_record_header_t);
+}
+
+TraceRecordWriter::inst_desc_entry_t &
+TraceRecordWriter::get_inst_desc(const QBDI::InstAnalysis *inst) {
+    auto it = inst_descs.find(inst->address);
+    if (it != inst_descs.end()) {
+        return it->second;
+    }
+    inst_desc_entry_t desc{};
+    desc.desc_id = static_cast<uint32_t>(inst_descs.size());
+    desc.chunk_seq = 0;
+    desc.address = inst->address;
+    desc.inst_size = inst->instSize;
+    desc.flags = get_inst_flags(inst);
+    desc.mnemonic = inst->mnemonic != nullptr ? inst->mnemonic : "";
+    desc.disassembly = trim(inst->disassembly);
+    desc.values_size = 0;
+    for (int i = 0; i < inst->numOperands && desc.operands.size() < UINT8_MAX; ++i) {
+        trace_operand_desc_t operand;
+        if (!get_operand_desc(inst->operands[i], operand)) {
+            continue;
+        }
+        desc.values_size += (operand.flags & kOperandPreValue) ? operand.size * 2 : operand.size;
+        desc.operands.push_back(operand);
+    }
+    return inst_descs.emplace(inst->address, std::move(desc)).first->second;
+}
+
+void TraceRecordWriter::write_inst_desc(const inst_desc_entry_t &desc) {
+    auto mnemonic_size = static_cast<uint8_t>(std::min<size_t>(desc.mnemonic.size(), UINT8_MAX));
+    auto disassembly_size = static_cast<uint16_t>(std::min<size_t>(desc.disassembly.size(),
+                                                                   UINT16_MAX));
+    uint32_t operands_size = desc.operands.size() * sizeof(trace_operand_desc_t);
+    auto cursor = begin_record(kRecordInstDesc, sizeof(trace_inst_desc_t) + operands_size +
+                                                mnemonic_size + disassembly_size);
+    trace_inst_desc_t header{};
+    header.desc_id = desc.desc_id;
+    header.inst_size = desc.inst_size;
+    header.address = desc.address;
+    header.flags = desc.flags;
+    header.operand_count = desc.operands.size();
+    header.mnemonic_size = mnemonic_size;
+    header.disassembly_size = disassembly_size;
+    memcpy(cursor, &header, sizeof(header));
+    cursor += sizeof(header);
+    memcpy(cursor, desc.operands.data(), operands_size);
+    cursor += operands_size;
+    memcpy(cursor, desc.mnemonic.data(), mnemonic_size);
+    cursor += mnemonic_size;
+    memcpy(cursor, desc.disassembly.data(), disassembly_size);
+}
+
+void TraceRecordWriter::write_inst(const inst_trace_info_t *info, const QBDI::InstAnalysis *inst,
+                                   const std::vector<trace_memory_access_t> &accesses) {
+    if (outputs.empty()) {
+        return;
+    }
+    if (branch_only) {
+        write_flow(info, inst, accesses);
+        return;
+    }
+    auto &desc = get_inst_desc(inst);
+    if (desc.chunk_seq != chunk_seq) {
+        write_inst_desc(desc);
+        desc.chunk_seq = chunk_seq;
+    }
+    if (chunk_inst_count == 0 || keyframe_due ||
+        (keyframe_interval != 0 && inst_index - last_keyframe_index >= keyframe_interval)) {
+        write_keyframe(info->pre_status);
+    }
+    auto access_count = static_cast<uint16_t>(std::min<size_t>(accesses.size(), UINT16_MAX));
+    uint32_t values_size = trace_align8(sizeof(trace_inst_record_t) + desc.values_size);
+    auto cursor = begin_record(kRecordInst,
+                               values_size + access_count * sizeof(trace_memory_access_t));
+    auto record_start = cursor;
+    trace_inst_record_t record{};
+    record.desc_id = desc.desc_id;
+    record.access_count = access_count;
+    record.values_size = desc.values_size;
+    memcpy(cursor, &record, sizeof(record));
+    cursor += sizeof(record);
+    for (const auto &operand: desc.operands) {
+        if (operand.flags & kOperandPreValue) {
+            memcpy(cursor, get_state_value(info->pre_status, operand), operand.size);
+            cursor += operand.size;
+        }
+        memcpy(cursor, get_state_value(info->post_status, operand), operand.size);
+        cursor += operand.size;
+    }
+    memcpy(record_start + values_size, accesses.data(),
+           access_count * sizeof(trace_memory_access_t));
+    chunk_inst_count++;
+    inst_index++;
+
+    if (info->fun_call != nullptr && !info->fun_call->fun_name.empty()) {
+        write_call(info->fun_call);
+        keyframe_due = true;
+    }
+    if (chunk.size() >= chunk_size) {
+        seal_chunk();
+    }
+}
+
+void TraceRecordWriter::write_call(const inst_fun_call_t *call) {
+    auto arg_count = static_cast<uint16_t>(std::min<size_t>(call->args.size(), UINT16_MAX));
+    auto raw_arg_count = static_cast<uint16_t>(std::min<size_t>(call->raw_args.size(),
+                                                                UINT16_MAX));
+    uint32_t size = sizeof(trace_call_record_t) + get_string_size(call->call_module_name) +
+                    get_string_size(call->fun_name) + get_string_size(call->ret_value);
+    for (uint16_t i = 0; i < arg_count; ++i) {
+        size += get_string_size(call->args[i]);
+    }
+    for (uint16_t i = 0; i < raw_arg_count; ++i) {
+        const auto &arg = call->raw_args[i];
+        size += get_string_size(arg.name) + sizeof(uint8_t) + sizeof(uint64_t) +
+                sizeof(uint16_t) + arg.data_size;
+    }
+    auto cursor = begin_record(kRecordCall, size);
+    trace_call_record_t record{};
+    record.fun_address = call->fun_address;
+    record.ret_type = call->ret_type;
+    record.is_svc = call->is_svc;
+    record.arg_count = arg_count;
+    record.raw_arg_count = raw_arg_count;
+    memcpy(cursor, &record, sizeof(record));
+    cursor += sizeof(record);
+    write_string(cursor, call->call_module_name);
+    write_string(cursor, call->fun_name);
+    write_string(cursor, call->ret_value);
+    for (uint16_t i = 0; i < arg_count; ++i) {
+        write_string(cursor, call->args[i]);
+    }
+    // raw bytes as captured, rendering them is left to the reader
+    for (uint16_t i = 0; i < raw_arg_count; ++i) {
+        const auto &arg = call->raw_args[i];
+        write_string(cursor, arg.name);
+        *cursor++ = static_cast<uint8_t>(arg.kind);
+        memcpy(cursor, &arg.value, sizeof(arg.value));
+        cursor += sizeof(arg.value);
+        auto data_size = static_cast<uint16_t>(arg.data_size);
+        memcpy(cursor, &data_size, sizeof(data_size));
+        memcpy(cursor + sizeof(data_size), call->arg_data.data() + arg.data_offset, data_size);
+        cursor += sizeof(data_size) + data_size;
+    }
+}
+
+void TraceRecordWriter::write_keyframe(const trace_vm_status_t &status) {
+    auto cursor = begin_record(kRecordKeyframe, sizeof(trace_keyframe_record_t) +
+                                                sizeof(QBDI::GPRState) + sizeof(QBDI::FPRState));
+    trace_keyframe_record_t record{};
+    record.inst_index = inst_index;
+    record.gpr_size = sizeof(QBDI::GPRState);
+    record.fpr_size = sizeof(QBDI::FPRState);
+    memcpy(cursor, &record, sizeof(record));
+    cursor += sizeof(record);
+    memcpy(cursor, &status.gpr_state, sizeof(QBDI::GPRState));
+    cursor += sizeof(QBDI::GPRState);
+    memcpy(cursor, &status.fpr_state, sizeof(QBDI::FPRState));
+    last_keyframe_index = inst_index;
+    keyframe_due = false;
+}
+
+void TraceRecordWriter::write_flow(const inst_trace_info_t *info, const QBDI::InstAnalysis *inst,
+                                   const std::vector<trace_memory_access_t> &accesses) {
+    bool thumb = false;
+#ifdef __arm__
+    thumb = inst->cpuMode == QBDI::CPUMode::Thumb;
+#endif
+    uint64_t pc = inst->address;
+    if (chunk_inst_count == 0) {
+        // the only register values a branch only trace keeps
+        write_keyframe(info->pre_status);
+        flow_start_offset = pc - file_header.module_base;
+        flow_thumb = thumb;
+        flow_event_position = 0;
+    } else if (pc != flow_next_pc) {
+        // the previous instruction branched, the module image can not tell where to
+        put_flow_event(chunk_inst_count - 1, kFlowJump);
+        put_varint(flow_events, zigzag(static_cast<int64_t>(pc - flow_prev_pc)) << 1 | thumb);
+    }
+    for (const auto &access: accesses) {
+        if (access.type != kAccessRead || (access.flags & kAccessInModule)) {
+            continue;
+        }
+        put_flow_event(chunk_inst_count, kFlowRead);
+        put_varint(flow_events, access.size);
+        put_varint(flow_events, access.address);
+        put_varint(flow_events, access.value);
+    }
+    if (info->fun_call != nullptr && info->fun_call->is_svc) {
+        put_flow_event(chunk_inst_count, kFlowSvc);
+        put_varint(flow_events, QBDI_GPR_GET(&info->post_status.gpr_state, QBDI::REG_RETURN));
+    }
+    flow_prev_pc = pc;
+    flow_next_pc = pc + inst->instSize;
+    chunk_inst_count++;
+    inst_index++;
+    if (flow_events.size() >= chunk_size) {
+        seal_chunk();
+    }
+}
+
+void TraceRecordWriter::put_flow_event(uint32_t position, trace_flow_event_t kind) {
+    put_varint(flow_events, static_cast<uint64_t>(position - flow_event_position) << 2 | kind);
+    flow_event_position = position;
+}
+
+void TraceRecordWriter::write_flow_record() {
+    auto cursor = begin_record(kRecordFlow, sizeof(trace_flow_record_t) + flow_events.size());
+    trace_flow_record_t record{};
+    record.start_offset = flow_start_offset;
+    record.inst_count = chunk_inst_count;
+    record.event_size = flow_events.size();
+    record.thumb = flow_thumb;
+    memcpy(cursor, &record, sizeof(record));
+    memcpy(cursor + sizeof(record), flow_events.data(), flow_events.size());
+    flow_events.clear();
+}
+
+void TraceRecordWriter::write_module_image(const std::shared_ptr<TraceOutput> &output) {
+    uint64_t base = file_header.module_base;
+    uint64_t end = file_header.module_end;
+    for (const auto &map: QBDI::getCurrentProcessMaps(false)) {
+        if (!(map.permission & QBDI::PF_EXEC) || map.range.end() <= base ||
+            map.range.start() >= end) {
+            continue;
+        }
+        if (!(map.permission & QBDI::PF_READ)) {
+            LOGW("execute only code at 0x%llx is missing from the module image",
+                 static_cast<unsigned long long>(map.range.start()));
+            continue;
+        }
+        uint64_t start = std::max<uint64_t>(map.range.start(), base);
+        uint64_t stop = std::min<uint64_t>(map.range.end(), end);
+        for (uint64_t address = start; address < stop; address += kModuleImagePiece) {
+            auto size = static_cast<uint32_t>(std::min<uint64_t>(stop - address,
+                                                                 kModuleImagePiece));
+            auto cursor = begin_record(kRecordModuleImage,
+                                       sizeof(trace_module_image_record_t) + size);
+            trace_module_image_record_t record{};
+            record.offset = address - base;
+            record.size = size;
+            memcpy(cursor, &record, sizeof(record));
+            memcpy(cursor + sizeof(record), reinterpret_cast<const void *>(address), size);
+            trace_chunk_header_t header{};
+            header.stored_size = chunk.size();
+            header.raw_size = chunk.size();
+            header.first_index = inst_index;
+            header.record_count = chunk_record_count;
+            header.timestamp_ms = get_timestamp_ms();
+            if (!output->write_chunk(header, chunk.data())) {
+                LOGW("trace output dropped module image at 0x%llx",
+                     static_cast<unsigned long long>(record.offset));
+            }
+            chunk.clear();
+            chunk_record_count = 0;
+        }
+    }
+}
+
+void TraceRecordWriter::seal_chunk() {
+    if (branch_only && chunk_inst_count != 0) {
+        write_flow_record();
+    }
+    if (chunk.empty()) {
+        return;
+    }
+    trace_chunk_header_t header{};
+    header.stored_size = chunk.size();
+    header.raw_size = chunk.size();
+    header.first_index = chunk_first_index;
+    header.inst_count = chunk_inst_count;
+    header.record_count = chunk_record_count;
+    header.timestamp_ms = get_timestamp_ms();
+    for (auto &output: outputs) {
+        if (!output->write_chunk(header, chunk.data())) {
+            LOGW("trace output dropped chunk %llu",
+                 static_cast<unsigned long long>(chunk_seq));
+        }
+    }
+    chunk.clear();
+    chunk_seq++;
+    chunk_first_index = inst_index;
+    chunk_inst_count = 0;
+    chunk_record_count = 0;
+}
+
+void TraceRecordWriter::flush() {
+    seal_chunk();
+    for (auto &output: outputs) {
+        output->flush();
+    }
+}
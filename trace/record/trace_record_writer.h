@@ -0,0 +1,147 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_TRACE_RECORD_WRITER_H
+#define QBDI_TRACER_TRACE_RECORD_WRITER_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <QBDI.h>
+#include "../common.h"
+#include "../sink/trace_output.h"
+#include "trace_format.h"
+
+/**
+ * Encodes trace info into the binary record format of trace_format.h and hands
+ * sealed chunks to the attached outputs. Only raw register and memory values
+ * are copied on the traced thread, nothing is formatted.
+ */
+class TraceRecordWriter {
+public:
+    static constexpr size_t kDefaultChunkSize = 256 * 1024;
+    // instructions between two keyframes, on top of the one opening every chunk
+    static constexpr uint32_t kDefaultKeyframeInterval = 4096;
+
+    TraceRecordWriter(const std::string &module_name, module_range_t module_range,
+                      size_t chunk_size = kDefaultChunkSize);
+
+    ~TraceRecordWriter();
+
+    void add_output(const std::shared_ptr<TraceOutput> &output);
+
+    void remove_output(const std::shared_ptr<TraceOutput> &output);
+
+    [[nodiscard]] bool has_output() const {
+        return !outputs.empty();
+    }
+
+    // 0 leaves keyframes at chunk starts and after calls only
+    void set_keyframe_interval(uint32_t interval) {
+        keyframe_interval = interval;
+    }
+
+    /**
+     * Only records where the control flow went, reads from outside the module
+     * and svc results, plus the executable bytes of the module once per
+     * output. Has to be chosen before the first output is attached.
+     */
+    void set_branch_only(bool enable);
+
+    [[nodiscard]] bool is_branch_only() const {
+        return branch_only;
+    }
+
+    void write_inst(const inst_trace_info_t *info, const QBDI::InstAnalysis *inst,
+                    const std::vector<trace_memory_access_t> &accesses);
+
+    void flush();
+
+private:
+    typedef struct inst_desc_entry {
+        uint32_t desc_id;
+        // chunk the descriptor was last emitted in
+        uint64_t chunk_seq;
+        uint16_t values_size;
+        std::vector<trace_operand_desc_t> operands;
+        std::string mnemonic;
+        std::string disassembly;
+        uint64_t address;
+        uint32_t inst_size;
+        uint16_t flags;
+    } inst_desc_entry_t;
+
+    inst_desc_entry_t &get_inst_desc(const QBDI::InstAnalysis *inst);
+
+    void write_inst_desc(const inst_desc_entry_t &desc);
+
+    void write_call(const inst_fun_call_t *call);
+
+    void write_keyframe(const trace_vm_status_t &status);
+
+    void write_flow(const inst_trace_info_t *info, const QBDI::InstAnalysis *inst,
+                    const std::vector<trace_memory_access_t> &accesses);
+
+    void put_flow_event(uint32_t position, trace_flow_event_t kind);
+
+    void write_flow_record();
+
+    void write_module_image(const std::shared_ptr<TraceOutput> &output);
+
+    uint8_t *begin_record(trace_record_type_t type, uint32_t size);
+
+    void seal_chunk();
+
+    DISALLOW_COPY_AND_ASSIGN(TraceRecordWriter);
+
+private:
+    serialize_file_t file_header;
+    size_t chunk_size;
+    std::vector<uint8_t> chunk;
+    uint64_t chunk_seq = 1;
+    uint64_t inst_index = 0;
+    uint64_t chunk_first_index = 0;
+    uint32_t chunk_inst_count = 0;
+    uint32_t chunk_record_count = 0;
+    uint32_t keyframe_interval = kDefaultKeyframeInterval;
+    uint64_t last_keyframe_index = 0;
+    // set after a call, the callee ran untraced and may have changed any register
+    bool keyframe_due = false;
+    bool branch_only = false;
+    // branch only state of the open chunk, see trace_flow_record_t
+    std::vector<uint8_t> flow_events;
+    uint64_t flow_start_offset = 0;
+    bool flow_thumb = false;
+    uint64_t flow_prev_pc = 0;
+    uint64_t flow_next_pc = 0;
+    // instruction of the chunk the last event belongs to
+    uint32_t flow_event_position = 0;
+    std::unordered_map<uintptr_t, inst_desc_entry_t> inst_descs;
+    std::vector<std::shared_ptr<TraceOutput>> outputs;
+};
+
+
+#endif //QBDI_TRACER_TRACE_RECORD_WRITER_H
@@ -0,0 +1,195 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "async_trace_output.h"
+#include <android/log.h>
+#include <cstring>
+#include <zlib.h>
+
+#define LOG_TAG "QBDI"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#define LOGD(...) __android_log_print(ANDROID_LOG_DEBUG, LOG_TAG, __VA_ARGS__)
+
+AsyncTraceOutput::AsyncTraceOutput(std::shared_ptr<TraceOutput> target, bool compress,
+                                   size_t queue_size, uint32_t max_wait_ms)
+        : target(std::move(target)), compress(compress), queue_size(queue_size),
+          max_wait_ms(max_wait_ms) {
+    worker = std::thread(&AsyncTraceOutput::run, this);
+}
+
+AsyncTraceOutput::~AsyncTraceOutput() {
+    stop();
+}
+
+void AsyncTraceOutput::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    work_cond.notify_all();
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+bool AsyncTraceOutput::enqueue(pending_item_t &&item) {
+    size_t size = item.size;
+    std::unique_lock<std::mutex> lock(mutex);
+    if (closed) {
+        return false;
+    }
+    // a chunk larger than the whole queue still goes through once the queue is empty
+    bool has_space = space_cond.wait_for(lock, std::chrono::milliseconds(max_wait_ms), [&] {
+        return queued_bytes == 0 || queued_bytes + size <= queue_size;
+    });
+    if (!has_space) {
+        dropped_chunks.fetch_add(1, std::memory_order_relaxed);
+        if (item.type == kPendingChunk && free_buffers.size() < kMaxFreeBuffers) {
+            free_buffers.push_back(std::move(item.payload));
+        }
+        return false;
+    }
+    queued_bytes += size;
+    queue.push_back(std::move(item));
+    lock.unlock();
+    work_cond.notify_one();
+    return true;
+}
+
+bool AsyncTraceOutput::write_header(const serialize_file_t &header) {
+    pending_item_t item{};
+    item.type = kPendingHeader;
+    item.size = sizeof(header);
+    item.file_header = header;
+    return enqueue(std::move(item));
+}
+
+bool AsyncTraceOutput::write_chunk(const trace_chunk_header_t &header, const uint8_t *payload) {
+    pending_item_t item{};
+    item.type = kPendingChunk;
+    item.chunk_header = header;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!free_buffers.empty()) {
+            item.payload = std::move(free_buffers.back());
+            free_buffers.pop_back();
+        }
+    }
+    item.payload.assign(payload, payload + header.stored_size);
+    item.size = header.stored_size;
+    return enqueue(std::move(item));
+}
+
+void AsyncTraceOutput::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    space_cond.wait(lock, [&] {
+        return (queue.empty() && !writing) || stopping;
+    });
+    lock.unlock();
+    target->flush();
+}
+
+void AsyncTraceOutput::close(const serialize_file_t &header) {
+    pending_item_t item{};
+    item.type = kPendingClose;
+    item.size = 0;
+    item.file_header = header;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (closed) {
+            return;
+        }
+        // close must not be dropped by the backpressure of enqueue
+        queue.push_back(std::move(item));
+        closed = true;
+    }
+    work_cond.notify_one();
+    stop();
+    auto dropped = get_dropped_chunks();
+    if (dropped != 0) {
+        LOGW("async trace output dropped %llu chunks", static_cast<unsigned long long>(dropped));
+    }
+}
+
+void AsyncTraceOutput::write_item(pending_item_t &item) {
+    switch (item.type) {
+        case kPendingHeader:
+            target->write_header(item.file_header);
+            break;
+        case kPendingChunk: {
+            auto header = item.chunk_header;
+            const uint8_t *payload = item.payload.data();
+            if (compress && !(header.flags & kChunkCompressed)) {
+                uLongf compressed_size = compressBound(header.stored_size);
+                compress_buffer.resize(compressed_size);
+                int ret = compress2(compress_buffer.data(), &compressed_size, payload,
+                                    header.stored_size, Z_BEST_SPEED);
+                // incompressible chunks are stored as they are
+                if (ret == Z_OK && compressed_size < header.stored_size) {
+                    header.flags |= kChunkCompressed;
+                    header.stored_size = compressed_size;
+                    payload = compress_buffer.data();
+                }
+            }
+            if (!target->write_chunk(header, payload)) {
+                dropped_chunks.fetch_add(1, std::memory_order_relaxed);
+                if (drop_listener) {
+                    drop_listener(item.chunk_header);
+                }
+            }
+            break;
+        }
+        case kPendingClose:
+            target->close(item.file_header);
+            break;
+    }
+}
+
+void AsyncTraceOutput::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        work_cond.wait(lock, [&] { return !queue.empty() || stopping; });
+        if (queue.empty()) {
+            break;
+        }
+        auto item = std::move(queue.front());
+        queue.pop_front();
+        writing = true;
+        lock.unlock();
+
+        write_item(item);
+
+        lock.lock();
+        writing = false;
+        queued_bytes -= item.size;
+        if (item.type == kPendingChunk && free_buffers.size() < kMaxFreeBuffers) {
+            free_buffers.push_back(std::move(item.payload));
+        }
+        space_cond.notify_all();
+    }
+    space_cond.notify_all();
+}
@@ -0,0 +1,132 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_ASYNC_TRACE_OUTPUT_H
+#define QBDI_TRACER_ASYNC_TRACE_OUTPUT_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <core/stl_macro.h>
+#include "trace_output.h"
+
+/**
+ * Moves compression and I/O of another TraceOutput to a background thread.
+ * The traced thread only copies the chunk into the queue. When more than
+ * queue_size bytes are pending it waits up to max_wait_ms for the worker and
+ * drops the chunk after that, so a slow disk or collector cannot grow memory
+ * without bound.
+ */
+class AsyncTraceOutput : public TraceOutput {
+public:
+    static constexpr size_t kDefaultQueueSize = 32 * 1024 * 1024;
+    static constexpr uint32_t kDefaultMaxWaitMs = 1000;
+
+    // header as passed to write_chunk
+    typedef std::function<void(const trace_chunk_header_t &header)> drop_listener_t;
+
+    explicit AsyncTraceOutput(std::shared_ptr<TraceOutput> target, bool compress = true,
+                              size_t queue_size = kDefaultQueueSize,
+                              uint32_t max_wait_ms = kDefaultMaxWaitMs);
+
+    ~AsyncTraceOutput() override;
+
+    bool write_header(const serialize_file_t &header) override;
+
+    bool write_chunk(const trace_chunk_header_t &header, const uint8_t *payload) override;
+
+    // blocks until everything queued so far reached the target
+    void flush() override;
+
+    void close(const serialize_file_t &header) override;
+
+    /**
+     * Called on the worker thread for each chunk write_chunk accepted but the
+     * target failed to write. Chunks refused by write_chunk itself are not
+     * reported, its caller already knows. Set before the first chunk.
+     */
+    void set_drop_listener(drop_listener_t listener) {
+        drop_listener = std::move(listener);
+    }
+
+    [[nodiscard]] uint64_t get_dropped_chunks() const {
+        return dropped_chunks.load(std::memory_order_relaxed);
+    }
+
+private:
+    typedef enum pending_type {
+        kPendingHeader,
+        kPendingChunk,
+        kPendingClose,
+    } pending_type_t;
+
+    typedef struct pending_item {
+        pending_type_t type;
+        // bytes accounted against queue_size
+        size_t size;
+        serialize_file_t file_header;
+        trace_chunk_header_t chunk_header;
+        std::vector<uint8_t> payload;
+    } pending_item_t;
+
+    bool enqueue(pending_item_t &&item);
+
+    void run();
+
+    void write_item(pending_item_t &item);
+
+    void stop();
+
+    DISALLOW_COPY_AND_ASSIGN(AsyncTraceOutput);
+
+private:
+    std::shared_ptr<TraceOutput> target;
+    bool compress;
+    size_t queue_size;
+    uint32_t max_wait_ms;
+    std::mutex mutex;
+    std::condition_variable work_cond;
+    std::condition_variable space_cond;
+    std::deque<pending_item_t> queue;
+    size_t queued_bytes = 0;
+    bool writing = false;
+    bool stopping = false;
+    bool closed = false;
+    // payload buffers handed back by the worker, reused by write_chunk
+    static constexpr size_t kMaxFreeBuffers = 8;
+    std::vector<std::vector<uint8_t>> free_buffers;
+    std::vector<uint8_t> compress_buffer;
+    std::atomic<uint64_t> dropped_chunks{0};
+    drop_listener_t drop_listener;
+    std::thread worker;
+};
+
+
+#endif //QBDI_TRACER_ASYNC_TRACE_OUTPUT_H
@@ -0,0 +1,79 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_COLLECTOR_PROTOCOL_H
+#define QBDI_TRACER_COLLECTOR_PROTOCOL_H
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Framing between the tracer and itrace-collector, used both inside the shared
+ * memory ring and on streaming sockets (unix or tcp).
+ *
+ * A streaming connection starts with a trace_stream_hello_t, followed by
+ * frames. Frames carry the same bytes as the binary trace file: one
+ * kFrameHeader with serialize_file_t, then one kFrameChunk per chunk, so the
+ * collector writes the trace to disk by dropping the frame headers. After a
+ * reconnect the tracer sends a hello with kStreamResume and the header again
+ * and continues with the chunk that did not get through; the collector
+ * appends to the file of the session instead of starting a new one.
+ */
+
+static constexpr const char *kDefaultCollectorName = "qbdi_itrace";
+static constexpr uint32_t kStreamMagic = 0x4D525453; // "STRM"
+static constexpr uint32_t kStreamVersion = 1;
+
+typedef enum trace_stream_flag {
+    kStreamResume = 1 << 0,
+} trace_stream_flag_t;
+
+typedef enum trace_frame_type {
+    // serialize_file_t
+    kFrameHeader = 1,
+    // trace_chunk_header_t + payload
+    kFrameChunk = 2,
+    kFramePadding = 3,
+} trace_frame_type_t;
+
+typedef struct trace_frame_header {
+    uint32_t type;
+    // payload bytes, the frame occupies trace_frame_size(size)
+    uint32_t size;
+} trace_frame_header_t;
+
+typedef struct trace_stream_hello {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t pid;
+    uint32_t flags;
+    char session_name[128];
+} trace_stream_hello_t;
+
+static inline uint64_t trace_frame_size(uint32_t payload_size) {
+    return (sizeof(trace_frame_header_t) + static_cast<uint64_t>(payload_size) + 7u) & ~7ull;
+}
+
+#endif //QBDI_TRACER_COLLECTOR_PROTOCOL_H
@@ -0,0 +1,95 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "file_trace_output.h"
+#include <android/log.h>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+#define LOG_TAG "QBDI"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#define LOGD(...) __android_log_print(ANDROID_LOG_DEBUG, LOG_TAG, __VA_ARGS__)
+
+std::shared_ptr<FileTraceOutput> FileTraceOutput::create(const std::string &path) {
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        LOGE("open %s failed: %s", path.c_str(), strerror(errno));
+        return nullptr;
+    }
+    return std::shared_ptr<FileTraceOutput>(new FileTraceOutput(fd, path));
+}
+
+FileTraceOutput::~FileTraceOutput() {
+    if (fd >= 0) {
+        ::close(fd);
+    }
+}
+
+bool FileTraceOutput::write_fully(const void *data, size_t size) {
+    auto cursor = reinterpret_cast<const uint8_t *>(data);
+    while (size > 0) {
+        ssize_t written = write(fd, cursor, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            LOGE("write %s failed: %s", path.c_str(), strerror(errno));
+            return false;
+        }
+        cursor += written;
+        size -= written;
+    }
+    return true;
+}
+
+bool FileTraceOutput::write_header(const serialize_file_t &header) {
+    if (fd < 0) {
+        return false;
+    }
+    return write_fully(&header, sizeof(header));
+}
+
+bool FileTraceOutput::write_chunk(const trace_chunk_header_t &header, const uint8_t *payload) {
+    if (fd < 0) {
+        return false;
+    }
+    return write_fully(&header, sizeof(header)) && write_fully(payload, header.stored_size);
+}
+
+void FileTraceOutput::close(const serialize_file_t &header) {
+    if (fd < 0) {
+        return;
+    }
+    // the header goes out first, patch in the final instruction count
+    if (pwrite(fd, &header, sizeof(header), 0) != sizeof(header)) {
+        LOGE("update header of %s failed: %s", path.c_str(), strerror(errno));
+    }
+    ::close(fd);
+    fd = -1;
+}
@@ -0,0 +1,61 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_FILE_TRACE_OUTPUT_H
+#define QBDI_TRACER_FILE_TRACE_OUTPUT_H
+
+#include <memory>
+#include <string>
+#include "trace_output.h"
+
+/**
+ * Writes the binary trace stream to a file, byte for byte what
+ * itrace-collector writes for a ring or socket session. Meant to be wrapped
+ * in AsyncTraceOutput so the traced thread never touches the disk.
+ */
+class FileTraceOutput : public TraceOutput {
+public:
+    static std::shared_ptr<FileTraceOutput> create(const std::string &path);
+
+    ~FileTraceOutput() override;
+
+    bool write_header(const serialize_file_t &header) override;
+
+    bool write_chunk(const trace_chunk_header_t &header, const uint8_t *payload) override;
+
+    void close(const serialize_file_t &header) override;
+
+private:
+    FileTraceOutput(int fd, std::string path) : fd(fd), path(std::move(path)) {}
+
+    bool write_fully(const void *data, size_t size);
+
+private:
+    int fd;
+    std::string path;
+};
+
+
+#endif //QBDI_TRACER_FILE_TRACE_OUTPUT_H
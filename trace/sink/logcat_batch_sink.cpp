@@ -0,0 +1,162 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "logcat_batch_sink.h"
+#include <android/log.h>
+#include <algorithm>
+
+// a partially filled batch is pushed out once it gets older than this
+static constexpr auto kMaxBatchDelay = std::chrono::milliseconds(250);
+static constexpr auto kReportInterval = std::chrono::seconds(1);
+// older spdlog only takes whole seconds, a quiet batch waits at most this long plus the delay
+static constexpr auto kFlushInterval = std::chrono::seconds(1);
+
+LogcatBatchSink::LogcatBatchSink(std::string tag, size_t lines_per_second, size_t burst)
+        : tag(std::move(tag)),
+          tokens(static_cast<double>(burst)),
+          lines_per_second(static_cast<double>(lines_per_second)),
+          burst(static_cast<double>(burst)) {
+    batch.reserve(kMaxBatchSize);
+    last_refill = std::chrono::steady_clock::now();
+    last_report = last_refill;
+    batch_start = last_refill;
+    flusher = std::make_unique<spdlog::details::periodic_worker>([this]() {
+        flush_expired();
+    }, kFlushInterval);
+}
+
+LogcatBatchSink::~LogcatBatchSink() {
+    // joins the worker before the batch goes away
+    flusher.reset();
+    std::lock_guard<std::mutex> lock(mutex_);
+    write_batch();
+    report_dropped(std::chrono::steady_clock::now(), true);
+}
+
+void LogcatBatchSink::set_rate_limit(size_t lines_per_second, size_t burst) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    this->lines_per_second = static_cast<double>(lines_per_second);
+    this->burst = static_cast<double>(burst);
+    this->tokens = std::min(this->tokens, this->burst);
+}
+
+bool LogcatBatchSink::acquire_token(std::chrono::steady_clock::time_point now) {
+    if (lines_per_second <= 0) {
+        // zero means unlimited
+        return true;
+    }
+    std::chrono::duration<double> elapsed = now - last_refill;
+    last_refill = now;
+    tokens = std::min(burst, tokens + elapsed.count() * lines_per_second);
+    if (tokens < 1.0) {
+        return false;
+    }
+    tokens -= 1.0;
+    return true;
+}
+
+void LogcatBatchSink::write_batch() {
+    if (batch.empty()) {
+        return;
+    }
+    __android_log_write(ANDROID_LOG_INFO, tag.c_str(), batch.c_str());
+    batch.clear();
+}
+
+void LogcatBatchSink::report_dropped(std::chrono::steady_clock::time_point now, bool force) {
+    auto dropped = dropped_lines.load(std::memory_order_relaxed);
+    if (dropped == reported_dropped) {
+        return;
+    }
+    if (!force && now - last_report < kReportInterval) {
+        return;
+    }
+    __android_log_print(ANDROID_LOG_WARN, tag.c_str(),
+                        "logcat rate limit: dropped %llu lines (%llu total)",
+                        static_cast<unsigned long long>(dropped - reported_dropped),
+                        static_cast<unsigned long long>(dropped));
+    reported_dropped = dropped;
+    last_report = now;
+}
+
+void LogcatBatchSink::sink_it_(const spdlog::details::log_msg &msg) {
+    auto now = std::chrono::steady_clock::now();
+    if (!acquire_token(now)) {
+        dropped_lines.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    report_dropped(now, false);
+
+    spdlog::memory_buf_t formatted;
+    formatter_->format(msg, formatted);
+    // logd already terminates every entry, the batch separates lines itself
+    const char *data = formatted.data();
+    size_t size = formatted.size();
+    while (size > 0 && (data[size - 1] == '\n' || data[size - 1] == '\r')) {
+        size--;
+    }
+    // logd would cut the line, the head of it goes out in entries of their own
+    while (size > kMaxBatchSize) {
+        write_batch();
+        size_t piece = kMaxBatchSize;
+        // never split a utf-8 sequence
+        while (piece > 0 && (static_cast<uint8_t>(data[piece]) & 0xc0) == 0x80) {
+            piece--;
+        }
+        if (piece == 0) {
+            piece = kMaxBatchSize;
+        }
+        batch.assign(data, piece);
+        write_batch();
+        data += piece;
+        size -= piece;
+    }
+    if (!batch.empty() && batch.size() + size + 1 > kMaxBatchSize) {
+        write_batch();
+    }
+    if (batch.empty()) {
+        batch_start = now;
+    } else {
+        batch.push_back('\n');
+    }
+    batch.append(data, size);
+    if (batch.size() >= kMaxBatchSize || now - batch_start >= kMaxBatchDelay) {
+        write_batch();
+    }
+}
+
+void LogcatBatchSink::flush_expired() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto now = std::chrono::steady_clock::now();
+    if (!batch.empty() && now - batch_start >= kMaxBatchDelay) {
+        write_batch();
+    }
+    report_dropped(now, false);
+}
+
+void LogcatBatchSink::flush_() {
+    write_batch();
+    report_dropped(std::chrono::steady_clock::now(), true);
+}
@@ -0,0 +1,94 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_LOGCAT_BATCH_SINK_H
+#define QBDI_TRACER_LOGCAT_BATCH_SINK_H
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <spdlog/common.h>
+#include <spdlog/details/periodic_worker.h>
+#include <spdlog/sinks/base_sink.h>
+
+/**
+ * spdlog sink that packs trace lines into logd sized batches and throttles them
+ * with a token bucket, so logcat does not fall into "chatty" suppression.
+ * Lines rejected by the bucket are counted and reported periodically.
+ * A spdlog periodic worker pushes out a batch left waiting when logging goes
+ * quiet; a line longer than a batch goes out in pieces of its own.
+ */
+class LogcatBatchSink : public spdlog::sinks::base_sink<std::mutex> {
+public:
+    // logd truncates a single entry at LOGGER_ENTRY_MAX_PAYLOAD (4068 bytes)
+    static constexpr size_t kMaxBatchSize = 4000;
+    static constexpr size_t kDefaultLinesPerSecond = 2000;
+    static constexpr size_t kDefaultBurst = 4000;
+
+    explicit LogcatBatchSink(std::string tag,
+                             size_t lines_per_second = kDefaultLinesPerSecond,
+                             size_t burst = kDefaultBurst);
+
+    ~LogcatBatchSink() override;
+
+    void set_rate_limit(size_t lines_per_second, size_t burst);
+
+    [[nodiscard]] uint64_t get_dropped_lines() const {
+        return dropped_lines.load(std::memory_order_relaxed);
+    }
+
+protected:
+    void sink_it_(const spdlog::details::log_msg &msg) override;
+
+    void flush_() override;
+
+private:
+    bool acquire_token(std::chrono::steady_clock::time_point now);
+
+    void write_batch();
+
+    void report_dropped(std::chrono::steady_clock::time_point now, bool force);
+
+    // runs on the periodic worker
+    void flush_expired();
+
+private:
+    std::string tag;
+    std::string batch;
+    std::chrono::steady_clock::time_point batch_start;
+    double tokens;
+    double lines_per_second;
+    double burst;
+    std::chrono::steady_clock::time_point last_refill;
+    std::chrono::steady_clock::time_point last_report;
+    std::atomic<uint64_t> dropped_lines{0};
+    uint64_t reported_dropped = 0;
+    std::unique_ptr<spdlog::details::periodic_worker> flusher;
+};
+
+
+#endif //QBDI_TRACER_LOGCAT_BATCH_SINK_H
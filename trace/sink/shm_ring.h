@@ -0,0 +1,89 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_SHM_RING_H
+#define QBDI_TRACER_SHM_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "collector_protocol.h"
+
+/*
+ * Layout of the shared memory ring between the tracer and itrace-collector,
+ * included by both sides.
+ *
+ * The tracer creates a memfd (ashmem on old kernels), connects to the
+ * collector's abstract unix socket and passes the fd along with a
+ * shm_ring_hello_t. It keeps the socket open for the whole session, so the
+ * collector notices through the hang up when the traced app dies.
+ *
+ * The ring is single producer / single consumer. head and tail count bytes
+ * ever written / consumed, the data offset is head % capacity. Frames never
+ * wrap: a frame that does not fit before the end of the data area is preceded
+ * by a kFramePadding frame filling the rest. Frames are the same as on the
+ * streaming socket, see collector_protocol.h.
+ */
+
+static constexpr uint32_t kShmRingMagic = 0x474E5249; // "IRNG"
+static constexpr uint32_t kShmRingVersion = 1;
+static constexpr size_t kDefaultRingSize = 64 * 1024 * 1024;
+
+typedef enum shm_ring_state {
+    kRingOpen = 0,
+    // the tracer is done, everything before head is valid
+    kRingClosed = 1,
+} shm_ring_state_t;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "the ring needs lock free 64 bit atomics to be shared between processes");
+
+typedef struct shm_ring_header {
+    uint32_t magic;
+    uint32_t version;
+    // bytes in the data area, a multiple of 8
+    uint64_t capacity;
+    std::atomic<uint64_t> dropped_frames;
+    std::atomic<uint32_t> state;
+    uint32_t reserved;
+    alignas(64) std::atomic<uint64_t> head;
+    alignas(64) std::atomic<uint64_t> tail;
+} shm_ring_header_t;
+
+// the data area starts on its own page
+static constexpr size_t kShmRingDataOffset = 4096;
+static_assert(sizeof(shm_ring_header_t) <= kShmRingDataOffset, "ring header too large");
+
+typedef struct shm_ring_hello {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t pid;
+    uint32_t reserved;
+    // size of the whole mapping, header included
+    uint64_t map_size;
+    char session_name[128];
+} shm_ring_hello_t;
+
+#endif //QBDI_TRACER_SHM_RING_H
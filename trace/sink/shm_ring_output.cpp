@@ -0,0 +1,276 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shm_ring_output.h"
+#include <android/log.h>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#ifdef __ANDROID__
+#include <linux/ashmem.h>
+#endif
+
+#define LOG_TAG "QBDI"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#define LOGD(...) __android_log_print(ANDROID_LOG_DEBUG, LOG_TAG, __VA_ARGS__)
+
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+
+static int create_shared_memory(const std::string &name, size_t size) {
+#ifdef __NR_memfd_create
+    int fd = static_cast<int>(syscall(__NR_memfd_create, name.c_str(), MFD_CLOEXEC));
+    if (fd >= 0) {
+        if (ftruncate(fd, static_cast<off_t>(size)) == 0) {
+            return fd;
+        }
+        LOGE("ftruncate memfd failed: %s", strerror(errno));
+        close(fd);
+        return -1;
+    }
+#endif
+#ifdef __ANDROID__
+    // kernels before 3.17 have no memfd
+    int ashmem_fd = open("/dev/ashmem", O_RDWR | O_CLOEXEC);
+    if (ashmem_fd < 0) {
+        LOGE("open ashmem failed: %s", strerror(errno));
+        return -1;
+    }
+    char ashmem_name[ASHMEM_NAME_LEN] = {};
+    strncpy(ashmem_name, name.c_str(), sizeof(ashmem_name) - 1);
+    ioctl(ashmem_fd, ASHMEM_SET_NAME, ashmem_name);
+    if (ioctl(ashmem_fd, ASHMEM_SET_SIZE, size) < 0) {
+        LOGE("set ashmem size failed: %s", strerror(errno));
+        close(ashmem_fd);
+        return -1;
+    }
+    return ashmem_fd;
+#else
+    LOGE("memfd_create failed: %s", strerror(errno));
+    return -1;
+#endif
+}
+
+static int connect_collector(const std::string &collector_name) {
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        LOGE("create socket failed: %s", strerror(errno));
+        return -1;
+    }
+    struct sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    // abstract namespace, no file system permission needed
+    size_t name_size = std::min(collector_name.size(), sizeof(addr.sun_path) - 1);
+    memcpy(addr.sun_path + 1, collector_name.data(), name_size);
+    auto addr_size = static_cast<socklen_t>(offsetof(struct sockaddr_un, sun_path) + 1 + name_size);
+    if (connect(fd, reinterpret_cast<struct sockaddr *>(&addr), addr_size) != 0) {
+        LOGE("connect collector @%s failed: %s", collector_name.c_str(), strerror(errno));
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static bool send_ring_fd(int socket_fd, int mem_fd, const shm_ring_hello_t &hello) {
+    struct iovec iov{};
+    iov.iov_base = const_cast<shm_ring_hello_t *>(&hello);
+    iov.iov_len = sizeof(hello);
+    char control[CMSG_SPACE(sizeof(int))] = {};
+    struct msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(cmsg), &mem_fd, sizeof(int));
+    ssize_t sent;
+    do {
+        sent = sendmsg(socket_fd, &msg, MSG_NOSIGNAL);
+    } while (sent < 0 && errno == EINTR);
+    return sent == static_cast<ssize_t>(sizeof(hello));
+}
+
+std::shared_ptr<ShmRingOutput> ShmRingOutput::create(const std::string &collector_name,
+                                                     const std::string &session_name,
+                                                     size_t ring_size, uint32_t max_wait_ms) {
+    size_t page_size = sysconf(_SC_PAGESIZE);
+    ring_size = (ring_size + page_size - 1) & ~(page_size - 1);
+    size_t map_size = kShmRingDataOffset + ring_size;
+    int mem_fd = create_shared_memory("itrace:" + session_name, map_size);
+    if (mem_fd < 0) {
+        return nullptr;
+    }
+    void *map = mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, mem_fd, 0);
+    if (map == MAP_FAILED) {
+        LOGE("mmap trace ring failed: %s", strerror(errno));
+        ::close(mem_fd);
+        return nullptr;
+    }
+    auto ring = new(map) shm_ring_header_t();
+    ring->magic = kShmRingMagic;
+    ring->version = kShmRingVersion;
+    ring->capacity = ring_size;
+    ring->state.store(kRingOpen);
+
+    int socket_fd = connect_collector(collector_name);
+    if (socket_fd < 0) {
+        munmap(map, map_size);
+        ::close(mem_fd);
+        return nullptr;
+    }
+    shm_ring_hello_t hello{};
+    hello.magic = kShmRingMagic;
+    hello.version = kShmRingVersion;
+    hello.pid = getpid();
+    hello.map_size = map_size;
+    strncpy(hello.session_name, session_name.c_str(), sizeof(hello.session_name) - 1);
+    bool sent = send_ring_fd(socket_fd, mem_fd, hello);
+    // the collector holds its own reference now
+    ::close(mem_fd);
+    if (!sent) {
+        LOGE("send trace ring to collector failed: %s", strerror(errno));
+        munmap(map, map_size);
+        ::close(socket_fd);
+        return nullptr;
+    }
+    LOGI("trace ring %s attached to collector @%s, %zu bytes", session_name.c_str(),
+         collector_name.c_str(), ring_size);
+    return std::shared_ptr<ShmRingOutput>(
+            new ShmRingOutput(socket_fd, map, map_size, max_wait_ms));
+}
+
+ShmRingOutput::ShmRingOutput(int socket_fd, void *map, size_t map_size, uint32_t max_wait_ms)
+        : socket_fd(socket_fd), map(map), map_size(map_size), max_wait_ms(max_wait_ms) {
+    ring = reinterpret_cast<shm_ring_header_t *>(map);
+    data = reinterpret_cast<uint8_t *>(map) + kShmRingDataOffset;
+}
+
+ShmRingOutput::~ShmRingOutput() {
+    ring->state.store(kRingClosed, std::memory_order_release);
+    munmap(map, map_size);
+    ::close(socket_fd);
+}
+
+bool ShmRingOutput::is_collector_alive() {
+    struct pollfd pfd{};
+    pfd.fd = socket_fd;
+    pfd.events = POLLIN;
+    if (poll(&pfd, 1, 0) > 0 && (pfd.revents & (POLLHUP | POLLERR | POLLIN))) {
+        // the collector never writes, readable means closed
+        collector_gone = true;
+        LOGE("trace collector disconnected, dropping the rest of the trace");
+    }
+    return !collector_gone;
+}
+
+bool ShmRingOutput::wait_for_space(uint64_t needed) {
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    if (ring->capacity - (head - ring->tail.load(std::memory_order_acquire)) >= needed) {
+        return true;
+    }
+    uint32_t waited_us = 0;
+    uint32_t sleep_us = 50;
+    while (waited_us < max_wait_ms * 1000u) {
+        if (!is_collector_alive()) {
+            return false;
+        }
+        usleep(sleep_us);
+        waited_us += sleep_us;
+        sleep_us = std::min(sleep_us * 2, 2000u);
+        if (ring->capacity - (head - ring->tail.load(std::memory_order_acquire)) >= needed) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ShmRingOutput::write_frame(uint32_t type, const void *frame_data, size_t size,
+                                const void *extra_data, size_t extra_size) {
+    if (collector_gone) {
+        ring->dropped_frames.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    uint64_t frame_size = trace_frame_size(size + extra_size);
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    uint64_t offset = head % ring->capacity;
+    uint64_t room = ring->capacity - offset;
+    uint64_t needed = frame_size > room ? frame_size + room : frame_size;
+    if (frame_size > ring->capacity / 2 || !wait_for_space(needed)) {
+        ring->dropped_frames.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    if (frame_size > room) {
+        trace_frame_header_t padding{kFramePadding,
+                                   static_cast<uint32_t>(room - sizeof(trace_frame_header_t))};
+        memcpy(data + offset, &padding, sizeof(padding));
+        head += room;
+        offset = 0;
+    }
+    trace_frame_header_t frame{type, static_cast<uint32_t>(size + extra_size)};
+    auto cursor = data + offset;
+    memcpy(cursor, &frame, sizeof(frame));
+    memcpy(cursor + sizeof(frame), frame_data, size);
+    if (extra_size != 0) {
+        memcpy(cursor + sizeof(frame) + size, extra_data, extra_size);
+    }
+    ring->head.store(head + frame_size, std::memory_order_release);
+    return true;
+}
+
+bool ShmRingOutput::write_header(const serialize_file_t &header) {
+    return write_frame(kFrameHeader, &header, sizeof(header), nullptr, 0);
+}
+
+bool ShmRingOutput::write_chunk(const trace_chunk_header_t &header, const uint8_t *payload) {
+    return write_frame(kFrameChunk, &header, sizeof(header), payload, header.stored_size);
+}
+
+void ShmRingOutput::close(const serialize_file_t &header) {
+    // a second header frame replaces the first in the file, the collector keeps its own
+    // instruction count since it knows which chunks were dropped
+    if (!collector_gone && !write_header(header)) {
+        LOGW("final trace header dropped, the collector keeps the first one");
+    }
+    ring->state.store(kRingClosed, std::memory_order_release);
+    auto dropped = get_dropped_frames();
+    if (dropped != 0) {
+        LOGW("trace ring dropped %llu frames", static_cast<unsigned long long>(dropped));
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_SHM_RING_OUTPUT_H
+#define QBDI_TRACER_SHM_RING_OUTPUT_H
+
+#include <memory>
+#include <string>
+#include "shm_ring.h"
+#include "trace_output.h"
+
+/**
+ * Trace output that copies chunks into a memfd/ashmem ring drained by the
+ * itrace-collector process, see shm_ring.h. The traced thread only pays for
+ * the memcpy; it waits up to max_wait_ms for the collector when the ring is
+ * full and drops the chunk after that.
+ */
+class ShmRingOutput : public TraceOutput {
+public:
+    static constexpr uint32_t kDefaultMaxWaitMs = 1000;
+
+    static std::shared_ptr<ShmRingOutput> create(const std::string &collector_name,
+                                                 const std::string &session_name,
+                                                 size_t ring_size = kDefaultRingSize,
+                                                 uint32_t max_wait_ms = kDefaultMaxWaitMs);
+
+    ~ShmRingOutput() override;
+
+    bool write_header(const serialize_file_t &header) override;
+
+    bool write_chunk(const trace_chunk_header_t &header, const uint8_t *payload) override;
+
+    void close(const serialize_file_t &header) override;
+
+    [[nodiscard]] uint64_t get_dropped_frames() const {
+        return ring->dropped_frames.load(std::memory_order_relaxed);
+    }
+
+private:
+    ShmRingOutput(int socket_fd, void *map, size_t map_size, uint32_t max_wait_ms);
+
+    bool write_frame(uint32_t type, const void *data, size_t size,
+                     const void *extra_data, size_t extra_size);
+
+    bool wait_for_space(uint64_t needed);
+
+    bool is_collector_alive();
+
+private:
+    int socket_fd;
+    void *map;
+    size_t map_size;
+    uint32_t max_wait_ms;
+    shm_ring_header_t *ring;
+    uint8_t *data;
+    bool collector_gone = false;
+};
+
+
+#endif //QBDI_TRACER_SHM_RING_OUTPUT_H
@@ -0,0 +1,249 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "socket_trace_output.h"
+#include <android/log.h>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+
+#define LOG_TAG "QBDI"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#define LOGD(...) __android_log_print(ANDROID_LOG_DEBUG, LOG_TAG, __VA_ARGS__)
+
+// after a failed reconnect, chunks are dropped without retrying for this long
+static constexpr auto kReconnectBackoff = std::chrono::seconds(1);
+
+static int connect_unix(const std::string &name) {
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    struct sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    size_t name_size;
+    socklen_t addr_size;
+    if (!name.empty() && name[0] == '/') {
+        name_size = std::min(name.size(), sizeof(addr.sun_path) - 1);
+        memcpy(addr.sun_path, name.data(), name_size);
+        addr_size = static_cast<socklen_t>(sizeof(addr));
+    } else {
+        auto abstract_name = !name.empty() && name[0] == '@' ? name.substr(1) : name;
+        name_size = std::min(abstract_name.size(), sizeof(addr.sun_path) - 1);
+        memcpy(addr.sun_path + 1, abstract_name.data(), name_size);
+        addr_size = static_cast<socklen_t>(offsetof(struct sockaddr_un, sun_path) + 1 + name_size);
+    }
+    if (connect(fd, reinterpret_cast<struct sockaddr *>(&addr), addr_size) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static int connect_tcp(const std::string &host_port) {
+    auto pos = host_port.rfind(':');
+    if (pos == std::string::npos) {
+        errno = EINVAL;
+        return -1;
+    }
+    auto host = host_port.substr(0, pos);
+    auto port = host_port.substr(pos + 1);
+    struct addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    struct addrinfo *result = nullptr;
+    if (getaddrinfo(host.c_str(), port.c_str(), &hints, &result) != 0) {
+        errno = EHOSTUNREACH;
+        return -1;
+    }
+    int fd = -1;
+    for (auto info = result; info != nullptr; info = info->ai_next) {
+        fd = socket(info->ai_family, info->ai_socktype | SOCK_CLOEXEC, info->ai_protocol);
+        if (fd < 0) {
+            continue;
+        }
+        if (connect(fd, info->ai_addr, info->ai_addrlen) == 0) {
+            int one = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+            break;
+        }
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(result);
+    return fd;
+}
+
+std::shared_ptr<SocketTraceOutput> SocketTraceOutput::create(const std::string &address,
+                                                             const std::string &session_name,
+                                                             uint32_t reconnect_timeout_ms) {
+    auto output = std::shared_ptr<SocketTraceOutput>(
+            new SocketTraceOutput(address, session_name, reconnect_timeout_ms));
+    // a collector that is not up yet is fine, the first write retries
+    if (!output->connect_collector()) {
+        LOGW("trace collector %s not reachable yet: %s", address.c_str(), strerror(errno));
+    }
+    return output;
+}
+
+SocketTraceOutput::~SocketTraceOutput() {
+    disconnect();
+}
+
+void SocketTraceOutput::disconnect() {
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+bool SocketTraceOutput::connect_collector() {
+    disconnect();
+    if (address.rfind("tcp:", 0) == 0) {
+        fd = connect_tcp(address.substr(4));
+    } else if (address.rfind("unix:", 0) == 0) {
+        fd = connect_unix(address.substr(5));
+    } else {
+        fd = connect_unix(address);
+    }
+    if (fd < 0) {
+        return false;
+    }
+    trace_stream_hello_t hello{};
+    hello.magic = kStreamMagic;
+    hello.version = kStreamVersion;
+    hello.pid = getpid();
+    hello.flags = connected_once ? kStreamResume : 0;
+    strncpy(hello.session_name, session_name.c_str(), sizeof(hello.session_name) - 1);
+    if (!send_fully(&hello, sizeof(hello))) {
+        disconnect();
+        return false;
+    }
+    // the collector appends to the session file, but needs a header first
+    if (has_header && !send_frame(kFrameHeader, &file_header, sizeof(file_header), nullptr, 0)) {
+        disconnect();
+        return false;
+    }
+    connected_once = true;
+    LOGI("trace stream %s connected to %s", session_name.c_str(), address.c_str());
+    return true;
+}
+
+bool SocketTraceOutput::ensure_connected() {
+    if (fd >= 0) {
+        return true;
+    }
+    auto now = std::chrono::steady_clock::now();
+    if (now - last_failure < kReconnectBackoff) {
+        return false;
+    }
+    auto deadline = now + std::chrono::milliseconds(reconnect_timeout_ms);
+    auto delay = std::chrono::milliseconds(50);
+    while (true) {
+        if (connect_collector()) {
+            return true;
+        }
+        if (std::chrono::steady_clock::now() + delay > deadline) {
+            break;
+        }
+        std::this_thread::sleep_for(delay);
+        delay = std::min(delay * 2, std::chrono::milliseconds(1000));
+    }
+    LOGE("trace collector %s unreachable: %s", address.c_str(), strerror(errno));
+    last_failure = std::chrono::steady_clock::now();
+    return false;
+}
+
+bool SocketTraceOutput::send_fully(const void *data, size_t size) {
+    auto cursor = reinterpret_cast<const uint8_t *>(data);
+    while (size > 0) {
+        ssize_t sent = send(fd, cursor, size, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        cursor += sent;
+        size -= sent;
+    }
+    return true;
+}
+
+bool SocketTraceOutput::send_frame(uint32_t type, const void *data, size_t size,
+                                   const void *extra_data, size_t extra_size) {
+    static const uint8_t padding[8] = {};
+    trace_frame_header_t frame{type, static_cast<uint32_t>(size + extra_size)};
+    size_t padding_size = trace_frame_size(frame.size) - sizeof(frame) - frame.size;
+    return send_fully(&frame, sizeof(frame)) && send_fully(data, size) &&
+           (extra_size == 0 || send_fully(extra_data, extra_size)) &&
+           (padding_size == 0 || send_fully(padding, padding_size));
+}
+
+bool SocketTraceOutput::write_header(const serialize_file_t &header) {
+    file_header = header;
+    has_header = true;
+    if (!ensure_connected()) {
+        return false;
+    }
+    if (!send_frame(kFrameHeader, &file_header, sizeof(file_header), nullptr, 0)) {
+        disconnect();
+        // the next connect sends the header anyway
+        return false;
+    }
+    return true;
+}
+
+bool SocketTraceOutput::write_chunk(const trace_chunk_header_t &header, const uint8_t *payload) {
+    // one retry on a fresh connection, the collector drops the partial frame
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        if (!ensure_connected()) {
+            return false;
+        }
+        if (send_frame(kFrameChunk, &header, sizeof(header), payload, header.stored_size)) {
+            return true;
+        }
+        LOGW("trace stream to %s broken: %s", address.c_str(), strerror(errno));
+        disconnect();
+    }
+    return false;
+}
+
+void SocketTraceOutput::close(const serialize_file_t &header) {
+    if (fd >= 0) {
+        // the collector patches the instruction count into the file header on its own
+        shutdown(fd, SHUT_WR);
+    }
+    disconnect();
+}
@@ -0,0 +1,92 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_SOCKET_TRACE_OUTPUT_H
+#define QBDI_TRACER_SOCKET_TRACE_OUTPUT_H
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include "collector_protocol.h"
+#include "trace_output.h"
+
+/**
+ * Streams frames to itrace-collector over a unix or tcp socket, see
+ * collector_protocol.h. Addresses look like "unix:@name" (abstract),
+ * "unix:/path/to/socket" or "tcp:host:port"; a bare name is an abstract unix
+ * socket.
+ *
+ * Writes block, so the output is meant to be wrapped in AsyncTraceOutput,
+ * whose queue turns a slow or restarting collector into backpressure. A broken
+ * connection is re-established and the chunk resent; a chunk is given up after
+ * reconnect_timeout_ms.
+ */
+class SocketTraceOutput : public TraceOutput {
+public:
+    static constexpr uint32_t kDefaultReconnectTimeoutMs = 10000;
+
+    static std::shared_ptr<SocketTraceOutput> create(const std::string &address,
+                                                     const std::string &session_name,
+                                                     uint32_t reconnect_timeout_ms =
+                                                     kDefaultReconnectTimeoutMs);
+
+    ~SocketTraceOutput() override;
+
+    bool write_header(const serialize_file_t &header) override;
+
+    bool write_chunk(const trace_chunk_header_t &header, const uint8_t *payload) override;
+
+    void close(const serialize_file_t &header) override;
+
+private:
+    SocketTraceOutput(std::string address, std::string session_name,
+                      uint32_t reconnect_timeout_ms)
+            : address(std::move(address)), session_name(std::move(session_name)),
+              reconnect_timeout_ms(reconnect_timeout_ms) {}
+
+    bool connect_collector();
+
+    bool ensure_connected();
+
+    void disconnect();
+
+    bool send_fully(const void *data, size_t size);
+
+    bool send_frame(uint32_t type, const void *data, size_t size,
+                    const void *extra_data, size_t extra_size);
+
+private:
+    std::string address;
+    std::string session_name;
+    uint32_t reconnect_timeout_ms;
+    int fd = -1;
+    serialize_file_t file_header{};
+    bool has_header = false;
+    bool connected_once = false;
+    std::chrono::steady_clock::time_point last_failure{};
+};
+
+
+#endif //QBDI_TRACER_SOCKET_TRACE_OUTPUT_H
@@ -0,0 +1,51 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 g2wfw
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_TRACE_OUTPUT_H
+#define QBDI_TRACER_TRACE_OUTPUT_H
+
+#include <cstdint>
+#include "../record/trace_format.h"
+
+/**
+ * Destination of the binary trace stream produced by TraceRecordWriter.
+ * The header is written once before the first chunk.
+ */
+class TraceOutput {
+public:
+    virtual ~TraceOutput() = default;
+
+    virtual bool write_header(const serialize_file_t &header) = 0;
+
+    virtual bool write_chunk(const trace_chunk_header_t &header, const uint8_t *payload) = 0;
+
+    virtual void flush() {}
+
+    // called once when the writer is done, header carries the final counters
+    virtual void close(const serialize_file_t &header) {}
+};
+
+
+#endif //QBDI_TRACER_TRACE_OUTPUT_H
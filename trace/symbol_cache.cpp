@@ -0,0 +1,207 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2024 g2wfw
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "symbol_cache.h"
+#include <algorithm>
+#include <core/library.h>
+#include <spdlog/fmt/fmt.h>
+
+// pages of the negative cache
+static constexpr uintptr_t kUnknownPageBits = 12;
+
+SymbolCache::SymbolCache() {
+    // every path of a shared library contains .so
+    stl::Linker::getInstance()->add_library_monitor(".so", stl::DLOPEN_POST, on_library_loaded,
+                                                    this);
+}
+
+void SymbolCache::on_library_loaded(const char *path, stl::linker_type_t type, void *so_info,
+                                    void *user_data) {
+    // read from the soinfo, no xdl lookup while the linker is busy
+    auto range = stl::Library(path, so_info).get_library_range();
+    if (range.end() <= range.start()) {
+        // the soinfo layout of this release is unknown
+        static_cast<SymbolCache *>(user_data)->invalidate(0, UINTPTR_MAX);
+        return;
+    }
+    static_cast<SymbolCache *>(user_data)->invalidate(range.start(), range.end());
+}
+
+void SymbolCache::invalidate(uintptr_t start, uintptr_t end) {
+    std::lock_guard<std::mutex> lock(pending_mutex);
+    pending_ranges.emplace_back(start, end);
+    dirty.store(true, std::memory_order_release);
+}
+
+void SymbolCache::apply_pending_ranges() {
+    std::vector<std::pair<uintptr_t, uintptr_t>> ranges;
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex);
+        ranges.swap(pending_ranges);
+    }
+    for (const auto &[start, end]: ranges) {
+        modules.erase(std::remove_if(modules.begin(), modules.end(),
+                                     [start = start, end = end](const auto &module) {
+                                         return module->base < end && module->end > start;
+                                     }), modules.end());
+        if (end - start >> kUnknownPageBits >= unknown_pages.size()) {
+            for (auto it = unknown_pages.begin(); it != unknown_pages.end();) {
+                if (*it >= start >> kUnknownPageBits && *it <= (end - 1) >> kUnknownPageBits) {
+                    it = unknown_pages.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        } else {
+            for (auto page = start >> kUnknownPageBits; page <= (end - 1) >> kUnknownPageBits;
+                 ++page) {
+                unknown_pages.erase(page);
+            }
+        }
+    }
+}
+
+void SymbolCache::on_export(const char *symbol, uintptr_t address, size_t size,
+                            void *user_data) {
+    auto module = static_cast<module_symbols_t *>(user_data);
+#ifdef __arm__
+    // thumb functions carry the mode in bit 0, the pc of their code does not
+    address &= ~static_cast<uintptr_t>(1);
+#endif
+    // $a/$t/$d/$x are arm mapping symbols, they mark code and data, they do not name it
+    if (symbol == nullptr || *symbol == 0 || *symbol == '$' || address < module->base ||
+        address >= module->end) {
+        return;
+    }
+    module->exports.push_back({address, static_cast<uint32_t>(module->names.size()),
+                               static_cast<uint32_t>(std::min<size_t>(size, UINT32_MAX))});
+    module->names.append(symbol);
+    module->names.push_back(0);
+}
+
+const SymbolCache::module_symbols_t *SymbolCache::load_module(uintptr_t address) {
+    auto library = stl::Library::find_library(address);
+    if (library == nullptr) {
+        return nullptr;
+    }
+    auto range = library->get_library_range();
+    if (address < range.start() || address >= range.end()) {
+        return nullptr;
+    }
+    auto module = std::make_unique<module_symbols_t>();
+    module->base = range.start();
+    module->end = range.end();
+    auto path = library->get_library_name();
+    module->name = path.substr(path.find_last_of('/') + 1);
+    library->enumerate_symbols(on_export, module.get());
+    // .dynsym comes first, its name wins for an address .symtab lists again
+    std::stable_sort(module->exports.begin(), module->exports.end(),
+                     [](const export_entry_t &a, const export_entry_t &b) {
+                         return a.address < b.address;
+                     });
+    auto &exports = module->exports;
+    size_t kept = 0;
+    for (size_t i = 0; i < exports.size(); ++i) {
+        if (kept != 0 && exports[kept - 1].address == exports[i].address) {
+            // an alias may be the one that knows the size
+            exports[kept - 1].size = std::max(exports[kept - 1].size, exports[i].size);
+            continue;
+        }
+        exports[kept++] = exports[i];
+    }
+    exports.resize(kept);
+    exports.shrink_to_fit();
+    auto it = std::upper_bound(modules.begin(), modules.end(), module->base,
+                               [](uintptr_t base, const std::unique_ptr<module_symbols_t> &entry) {
+                                   return base < entry->base;
+                               });
+    return modules.insert(it, std::move(module))->get();
+}
+
+const SymbolCache::module_symbols_t *SymbolCache::find_module(uintptr_t address) {
+    if (dirty.exchange(false, std::memory_order_acquire)) {
+        apply_pending_ranges();
+    }
+    auto it = std::upper_bound(modules.begin(), modules.end(), address,
+                               [](uintptr_t value, const std::unique_ptr<module_symbols_t> &entry) {
+                                   return value < entry->base;
+                               });
+    if (it != modules.begin() && address < (*std::prev(it))->end) {
+        return std::prev(it)->get();
+    }
+    auto page = address >> kUnknownPageBits;
+    if (unknown_pages.count(page) != 0) {
+        return nullptr;
+    }
+    auto module = load_module(address);
+    if (module == nullptr) {
+        unknown_pages.insert(page);
+    }
+    return module;
+}
+
+bool SymbolCache::lookup(uintptr_t address, symbol_location_t *location) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto module = find_module(address);
+    if (module == nullptr) {
+        return false;
+    }
+    location->module = module->name;
+    location->module_base = module->base;
+    auto it = std::upper_bound(module->exports.begin(), module->exports.end(), address,
+                               [](uintptr_t value, const export_entry_t &entry) {
+                                   return value < entry.address;
+                               });
+    if (it != module->exports.begin()) {
+        --it;
+    }
+    if (it == module->exports.end() || address < it->address ||
+        address - it->address >= std::max<uint32_t>(it->size, 1)) {
+        location->symbol.clear();
+        location->offset = address - module->base;
+        return true;
+    }
+    location->symbol = module->names.c_str() + it->name;
+    location->offset = address - it->address;
+    return true;
+}
+
+std::string SymbolCache::format(uintptr_t address) {
+    symbol_location_t location;
+    if (!lookup(address, &location)) {
+        return fmt::format("{:#x}", address);
+    }
+    return format(location);
+}
+
+std::string SymbolCache::format(const symbol_location_t &location) {
+    if (location.symbol.empty()) {
+        return fmt::format("{}+{:#x}", location.module, location.offset);
+    }
+    if (location.offset == 0) {
+        return location.symbol;
+    }
+    return fmt::format("{}+{:#x}", location.symbol, location.offset);
+}
@@ -0,0 +1,123 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2024 g2wfw
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_SYMBOL_CACHE_H
+#define QBDI_TRACER_SYMBOL_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include <core/linker.h>
+#include "common.h"
+
+typedef struct symbol_location {
+    // file name of the module, empty outside every module
+    std::string module;
+    uintptr_t module_base = 0;
+    // export whose size covers the address, empty when there is none
+    std::string symbol;
+    // from symbol, or from module_base without one
+    uintptr_t offset = 0;
+} symbol_location_t;
+
+/**
+ * Names any code address of the process as module and the export it lies
+ * in, for call targets no dispatcher knows. An address past the end of the
+ * closest export is named by its module offset instead, stripped modules
+ * would otherwise name it after some far away export. A module is looked up with xdl once, on
+ * the first address that lands in it, and its exports are kept as one table
+ * sorted by address, so every later address of it costs a binary search.
+ * Addresses in no module, JIT code or anonymous trampolines, are remembered
+ * by page. Loading a library drops the modules and pages in its range, it
+ * may reuse the range of one unloaded before.
+ */
+class SymbolCache {
+public:
+    static SymbolCache *getInstance() {
+        static SymbolCache instance;
+        return &instance;
+    }
+
+    bool lookup(uintptr_t address, symbol_location_t *location);
+
+    // symbol+0x10, module+0x10 without a symbol, the address outside of a module
+    std::string format(uintptr_t address);
+
+    static std::string format(const symbol_location_t &location);
+
+    // drops what is cached for [start, end), applied on the next lookup
+    void invalidate(uintptr_t start, uintptr_t end);
+
+private:
+    typedef struct export_entry {
+        uintptr_t address;
+        // into module_symbols::names
+        uint32_t name;
+        // 0 when the ELF does not record one, only the address itself matches then
+        uint32_t size;
+    } export_entry_t;
+
+    typedef struct module_symbols {
+        uintptr_t base;
+        uintptr_t end;
+        std::string name;
+        // sorted by address, one entry per address
+        std::vector<export_entry_t> exports;
+        std::string names;
+    } module_symbols_t;
+
+    SymbolCache();
+
+    // nullptr when address is in no loaded library
+    const module_symbols_t *find_module(uintptr_t address);
+
+    const module_symbols_t *load_module(uintptr_t address);
+
+    void apply_pending_ranges();
+
+    static void on_export(const char *symbol, uintptr_t address, size_t size, void *user_data);
+
+    static void on_library_loaded(const char *path, stl::linker_type_t type, void *so_info,
+                                  void *user_data);
+
+private:
+    std::mutex mutex;
+    // sorted by base
+    std::vector<std::unique_ptr<module_symbols_t>> modules;
+    std::unordered_set<uintptr_t> unknown_pages;
+    // ranges of libraries loaded since the last lookup, the linker callback must not wait
+    // for mutex while a lookup holds it and asks the linker
+    std::mutex pending_mutex;
+    std::vector<std::pair<uintptr_t, uintptr_t>> pending_ranges;
+    std::atomic<bool> dirty{false};
+    DISALLOW_COPY_AND_ASSIGN(SymbolCache);
+};
+
+
+#endif //QBDI_TRACER_SYMBOL_CACHE_H
@@ -0,0 +1,361 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2024 g2wfw
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <elf.h>
+#include <fcntl.h>
+#include <link.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <spdlog/fmt/fmt.h>
+#include "trace_bundle.h"
+#include "instruction_dispatch_manager.h"
+
+#define LOG_TAG "QBDI"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#define LOGD(...) __android_log_print(ANDROID_LOG_DEBUG, LOG_TAG, __VA_ARGS__)
+
+static std::string file_name(const std::string &path) {
+    auto slash = path.find_last_of('/');
+    return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+static bool make_dir(const std::string &path) {
+    return mkdir(path.c_str(), 0755) == 0 || errno == EEXIST;
+}
+
+static bool file_exists(const std::string &path) {
+    struct stat info;
+    return stat(path.c_str(), &info) == 0;
+}
+
+static bool write_all(int fd, const void *data, size_t size) {
+    auto cursor = static_cast<const uint8_t *>(data);
+    while (size > 0) {
+        auto written = ::write(fd, cursor, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        cursor += written;
+        size -= written;
+    }
+    return true;
+}
+
+/**
+ * Bundle files are shared by sessions, so they are written next to their
+ * final name and renamed: a reader never sees half a file. The temp name
+ * carries the writer's pid and tid, so processes writing the same bundle
+ * never share one.
+ */
+class AtomicFile {
+public:
+    explicit AtomicFile(std::string path)
+            : path(std::move(path)),
+              temp_path(fmt::format("{}.{}.{}.tmp", this->path, getpid(), gettid())) {
+        fd = open(temp_path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+        if (fd < 0 && errno == EEXIST) {
+            // left behind by a killed writer with the same ids, ours to replace
+            unlink(temp_path.c_str());
+            fd = open(temp_path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+        }
+    }
+
+    ~AtomicFile() {
+        if (fd >= 0) {
+            close(fd);
+            unlink(temp_path.c_str());
+        }
+    }
+
+    [[nodiscard]] bool is_open() const {
+        return fd >= 0;
+    }
+
+    bool write(const void *data, size_t size) {
+        return fd >= 0 && write_all(fd, data, size);
+    }
+
+    bool write(const std::string &str) {
+        return write(str.data(), str.size());
+    }
+
+    bool commit() {
+        if (fd < 0) {
+            return false;
+        }
+        bool ok = close(fd) == 0;
+        fd = -1;
+        if (!ok || rename(temp_path.c_str(), path.c_str()) != 0) {
+            unlink(temp_path.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(AtomicFile);
+
+private:
+    std::string path;
+    std::string temp_path;
+    int fd = -1;
+};
+
+static bool copy_file(const std::string &from, AtomicFile &to) {
+    int fd = open(from.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    std::vector<uint8_t> buffer(64 * 1024);
+    bool ok = true;
+    while (ok) {
+        auto size = read(fd, buffer.data(), buffer.size());
+        if (size < 0 && errno == EINTR) {
+            continue;
+        }
+        if (size <= 0) {
+            ok = size == 0;
+            break;
+        }
+        ok = to.write(buffer.data(), size);
+    }
+    close(fd);
+    return ok;
+}
+
+static bool is_readable_code(const QBDI::MemoryMap &map, module_range_t range) {
+    return (map.permission & QBDI::PF_EXEC) && (map.permission & QBDI::PF_READ) &&
+           map.range.end() > range.base && map.range.start() < range.end;
+}
+
+static std::string find_build_id(uintptr_t base) {
+    auto ehdr = reinterpret_cast<const ElfW(Ehdr) *>(base);
+    if (memcmp(ehdr->e_ident, ELFMAG, SELFMAG) != 0) {
+        return "";
+    }
+    auto phdr = reinterpret_cast<const ElfW(Phdr) *>(base + ehdr->e_phoff);
+    // shared objects are linked at 0, but the first segment may not be
+    uintptr_t bias = base;
+    for (int i = 0; i < ehdr->e_phnum; ++i) {
+        if (phdr[i].p_type == PT_LOAD) {
+            bias = base - (phdr[i].p_vaddr & ~static_cast<ElfW(Addr)>(getpagesize() - 1));
+            break;
+        }
+    }
+    for (int i = 0; i < ehdr->e_phnum; ++i) {
+        if (phdr[i].p_type != PT_NOTE) {
+            continue;
+        }
+        auto cursor = bias + phdr[i].p_vaddr;
+        auto end = cursor + phdr[i].p_memsz;
+        while (cursor + sizeof(ElfW(Nhdr)) <= end) {
+            auto note = reinterpret_cast<const ElfW(Nhdr) *>(cursor);
+            auto name = cursor + sizeof(ElfW(Nhdr));
+            auto desc = name + ((note->n_namesz + 3) & ~3u);
+            if (note->n_type == NT_GNU_BUILD_ID && note->n_namesz == 4 &&
+                memcmp(reinterpret_cast<const void *>(name), "GNU", 4) == 0 &&
+                desc + note->n_descsz <= end) {
+                std::string id;
+                auto bytes = reinterpret_cast<const uint8_t *>(desc);
+                for (uint32_t j = 0; j < note->n_descsz; ++j) {
+                    id += fmt::format("{:02x}", bytes[j]);
+                }
+                return id;
+            }
+            cursor = desc + ((note->n_descsz + 3) & ~3u);
+        }
+    }
+    return "";
+}
+
+TraceBundleWriter::TraceBundleWriter(std::string itrace_dir, std::string session_dir)
+        : itrace_dir(std::move(itrace_dir)), session_dir(std::move(session_dir)) {}
+
+std::string TraceBundleWriter::get_build_id(module_range_t range,
+                                            const std::vector<QBDI::MemoryMap> &maps) {
+    auto build_id = find_build_id(range.base);
+    if (!build_id.empty()) {
+        return build_id;
+    }
+    // fnv-1a over the code keeps stripped modules apart
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (const auto &map: maps) {
+        if (!is_readable_code(map, range)) {
+            continue;
+        }
+        uint64_t start = std::max<uint64_t>(map.range.start(), range.base);
+        uint64_t end = std::min<uint64_t>(map.range.end(), range.end);
+        auto bytes = reinterpret_cast<const uint8_t *>(start);
+        for (uint64_t i = 0; i < end - start; ++i) {
+            hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+        }
+    }
+    return fmt::format("fnv-{:016x}", hash);
+}
+
+bool TraceBundleWriter::prepare_bundle_dir(const std::string &build_id,
+                                           std::string &bundle_dir) const {
+    std::string bundles = itrace_dir + "bundles/";
+    bundle_dir = bundles + build_id + "/";
+    if (!make_dir(bundles) || !make_dir(bundle_dir)) {
+        LOGE("mkdir failed %s: %s", bundle_dir.c_str(), strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+bool TraceBundleWriter::write_module_image(const std::string &bundle_dir,
+                                           const std::string &module_name,
+                                           module_range_t module_range,
+                                           const std::vector<QBDI::MemoryMap> &maps,
+                                           std::string &image_path) {
+    std::string disk_path;
+    for (const auto &map: maps) {
+        if (map.range.start() <= module_range.base && map.range.end() > module_range.base) {
+            disk_path = map.name;
+            break;
+        }
+    }
+    // libraries mapped straight out of an apk only have the apk as their file
+    bool on_disk = disk_path.size() > 3 &&
+                   disk_path.compare(disk_path.size() - 3, 3, ".so") == 0;
+    std::string file_path = bundle_dir + file_name(module_name);
+    std::string pages_path = bundle_dir + "code_pages.bin";
+    if (file_exists(file_path)) {
+        image_path = file_path;
+        return true;
+    }
+    if (file_exists(pages_path)) {
+        image_path = pages_path;
+        return true;
+    }
+    if (on_disk) {
+        AtomicFile file(file_path);
+        if (copy_file(disk_path, file) && file.commit()) {
+            image_path = file_path;
+            return true;
+        }
+        LOGW("copy %s failed, keeping the code pages instead", disk_path.c_str());
+    }
+    AtomicFile file(pages_path);
+    bool ok = file.is_open();
+    for (const auto &map: maps) {
+        if (!ok) {
+            break;
+        }
+        if (!is_readable_code(map, module_range)) {
+            continue;
+        }
+        uint64_t start = std::max<uint64_t>(map.range.start(), module_range.base);
+        uint64_t end = std::min<uint64_t>(map.range.end(), module_range.end);
+        uint64_t header[2] = {start - module_range.base, end - start};
+        ok = file.write(header, sizeof(header)) &&
+             file.write(reinterpret_cast<const void *>(start), end - start);
+    }
+    if (!ok || !file.commit()) {
+        LOGE("write %s failed", pages_path.c_str());
+        return false;
+    }
+    image_path = pages_path;
+    return true;
+}
+
+bool TraceBundleWriter::write_exports(const std::string &path, uintptr_t base,
+                                      const std::unordered_map<uintptr_t, std::string> &exports) {
+    if (file_exists(path)) {
+        return true;
+    }
+    std::vector<std::pair<uintptr_t, const std::string *>> sorted;
+    sorted.reserve(exports.size());
+    for (const auto &item: exports) {
+        sorted.emplace_back(item.first, &item.second);
+    }
+    std::sort(sorted.begin(), sorted.end());
+    std::string text;
+    for (const auto &item: sorted) {
+        // offsets stay valid for every process loading the same build
+        text += fmt::format("{:#x} {}\n", item.first - base, *item.second);
+    }
+    AtomicFile file(path);
+    return file.write(text) && file.commit();
+}
+
+bool TraceBundleWriter::write(const std::string &module_name, module_range_t module_range) {
+    auto maps = QBDI::getCurrentProcessMaps(true);
+    std::string manifest;
+    {
+        AtomicFile maps_file(session_dir + "maps.txt");
+        if (!copy_file("/proc/self/maps", maps_file) || !maps_file.commit()) {
+            LOGW("snapshot of /proc/self/maps failed");
+        }
+    }
+    auto build_id = get_build_id(module_range, maps);
+    std::string bundle_dir;
+    std::string image_path;
+    if (!prepare_bundle_dir(build_id, bundle_dir) ||
+        !write_module_image(bundle_dir, module_name, module_range, maps, image_path)) {
+        return false;
+    }
+    manifest += fmt::format("module {} {:#x} {:#x} {} {}\n", file_name(module_name),
+                            module_range.base, module_range.end, build_id, image_path);
+    for (auto dispatch: InstructionDispatchManager::getInstance()->get_dispatch_list()) {
+        // loading the exports takes a while, the session does not wait for it
+        if (!dispatch->is_loaded()) {
+            LOGW("exports of %s not loaded yet, left out of the bundle",
+                 dispatch->get_module_name().c_str());
+            continue;
+        }
+        const auto &range = dispatch->get_module_range();
+        if (range.base == 0) {
+            continue;
+        }
+        auto library_id = get_build_id(range, maps);
+        std::string library_dir;
+        if (!prepare_bundle_dir(library_id, library_dir)) {
+            continue;
+        }
+        std::string exports_path = library_dir + "exports.txt";
+        if (!write_exports(exports_path, range.base, dispatch->get_export_infos())) {
+            LOGW("write %s failed", exports_path.c_str());
+            continue;
+        }
+        manifest += fmt::format("library {} {:#x} {:#x} {} {}\n", dispatch->get_module_name(),
+                                range.base, range.end, library_id, exports_path);
+    }
+    manifest += fmt::format("maps {}maps.txt\n", session_dir);
+    AtomicFile file(session_dir + "bundle.txt");
+    if (!file.write(manifest) || !file.commit()) {
+        LOGE("write %sbundle.txt failed", session_dir.c_str());
+        return false;
+    }
+    LOGI("trace bundle %s%s", bundle_dir.c_str(), file_name(image_path).c_str());
+    return true;
+}
@@ -0,0 +1,78 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2024 g2wfw
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef QBDI_TRACER_TRACE_BUNDLE_H
+#define QBDI_TRACER_TRACE_BUNDLE_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <QBDI.h>
+#include "common.h"
+
+/**
+ * Writes what offline tools need besides the trace itself, once per session:
+ *
+ *   <itrace>/bundles/<build id>/<module>         on-disk copy of the module, or
+ *   <itrace>/bundles/<build id>/code_pages.bin   its readable executable pages
+ *   <itrace>/bundles/<build id>/exports.txt      exports of a dispatcher module
+ *   <session>/maps.txt                           /proc/self/maps at session start
+ *   <session>/bundle.txt                         manifest pointing at the above
+ *
+ * Bundle entries are keyed by the GNU build id and never written twice, so
+ * repeated sessions of the same app only add the small per session files.
+ * code_pages.bin is a sequence of uint64_t offset from the module base,
+ * uint64_t size and size bytes.
+ */
+class TraceBundleWriter {
+public:
+    TraceBundleWriter(std::string itrace_dir, std::string session_dir);
+
+    bool write(const std::string &module_name, module_range_t module_range);
+
+private:
+    // build id of the elf loaded at range, a hash of its code when it has none
+    static std::string get_build_id(module_range_t range,
+                                    const std::vector<QBDI::MemoryMap> &maps);
+
+    bool prepare_bundle_dir(const std::string &build_id, std::string &bundle_dir) const;
+
+    static bool write_module_image(const std::string &bundle_dir, const std::string &module_name,
+                                   module_range_t module_range,
+                                   const std::vector<QBDI::MemoryMap> &maps,
+                                   std::string &image_path);
+
+    static bool write_exports(const std::string &path, uintptr_t base,
+                              const std::unordered_map<uintptr_t, std::string> &exports);
+
+    DISALLOW_COPY_AND_ASSIGN(TraceBundleWriter);
+
+private:
+    std::string itrace_dir;
+    std::string session_dir;
+};
+
+
+#endif //QBDI_TRACER_TRACE_BUNDLE_H